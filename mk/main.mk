@@ -81,3 +81,10 @@ generate: generate-web-assets-cc generate-headers
 test: $(BUILD_DIR)/rethinkdb $(BUILD_DIR)/rethinkdb-unittest web-assets rb-driver py-driver
 	$P RUN-TESTS
 	MAKEFLAGS= $(TOP)/test/run -b $(BUILD_DIR)
+
+# Runs only the microbenchmarks (src/unittest/benchmark.cc). Each one prints a
+# machine-readable `BENCH\t<name>\t<iters>\t<min ns/op>\t<median ns/op>` line.
+.PHONY: bench
+bench: $(BUILD_DIR)/rethinkdb-unittest
+	$P RUN-BENCH
+	$(BUILD_DIR)/rethinkdb-unittest --gtest_filter='Benchmark*'
@@ -34,16 +34,17 @@ def main():
 prelude = """
 // Generated by scripts/compile-web-assets.py
 
-#include <map>
-#include <string>
+#include "http/web_assets.hpp"
 """
 
 def write_assets(asset_root, assets):
 
-    print('std::map<std::string, const std::string> static_web_assets = {')
+    # Assets are emitted as (string literal, length) segments pointing into
+    # the binary's read-only data; see the comment in src/http/web_assets.hpp.
+    print('std::map<std::string, const static_web_asset_t> static_web_assets = {')
     for i, asset in enumerate(assets):
 
-        print('    { ' + encode('/' + asset) + ', std::string(', end='')
+        print('    { ' + encode('/' + asset) + ', { { {', end='')
 
         data = open(os.path.join(asset_root, asset), "rb").read()
         position = 0 # track the position to keep lines short
@@ -84,21 +85,19 @@ def write_assets(asset_root, assets):
                 position = 0
                 if literal_size > MAX_LITERAL_SIZE - MAX_LINE_LENGTH:
                     print(',')
-                    print('      ' + str(literal_size) + ') + std::string(', end='')
+                    print('      ' + str(literal_size) + ' },')
+                    print('      {', end='')
                     literal_size = 0
 
 
         if position != 0:
             print('"', end='')
 
-        if not data:
+        if literal_size == 0:
             print('""', end='')
 
-        if literal_size:
-            print(',')
-            print('      ' + str(literal_size) + ' ) },')
-        else:
-            print('"") },')
+        print(',')
+        print('      ' + str(literal_size) + ' } } } },')
 
     print('};')
 
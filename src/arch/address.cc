@@ -17,7 +17,9 @@
 #include <functional>
 
 #include "arch/io/network.hpp"
+#include "arch/runtime/coroutines.hpp"
 #include "arch/runtime/thread_pool.hpp"
+#include "concurrency/pmap.hpp"
 #include "logger.hpp"
 
 host_lookup_exc_t::host_lookup_exc_t(const std::string &_host,
@@ -128,23 +130,54 @@ void hostname_to_ips_internal(const std::string &host,
 }
 
 std::set<ip_address_t> hostname_to_ips(const std::string &host) {
-    std::set<ip_address_t> ips;
-
     // Allow an error on one lookup, but not both
-    bool errored = false;
-
-    try {
-        hostname_to_ips_internal(host, AF_INET, &ips);
-    } catch (const host_lookup_exc_t &ex) {
-        errored = true;
+    bool v4_errored = false;
+    bool v6_errored = false;
+    std::exception_ptr v6_exc;
+    std::set<ip_address_t> v4_ips, v6_ips;
+
+    const auto v4_lookup = [&]() {
+        try {
+            hostname_to_ips_internal(host, AF_INET, &v4_ips);
+        } catch (const host_lookup_exc_t &) {
+            v4_errored = true;
+        }
+    };
+    const auto v6_lookup = [&]() {
+        try {
+            hostname_to_ips_internal(host, AF_INET6, &v6_ips);
+        } catch (const host_lookup_exc_t &) {
+            v6_errored = true;
+            v6_exc = std::current_exception();
+        }
+    };
+
+    if (coro_t::self() != nullptr) {
+        /* The A and AAAA lookups are independent DNS round trips; each one
+        only blocks its own blocker-pool thread, so there is no reason to pay
+        for them back to back.  Reconnect loops and `r.http` resolve on every
+        attempt, where the serialized second round trip was pure added
+        latency. */
+        pmap(2, [&](int i) {
+            if (i == 0) {
+                v4_lookup();
+            } else {
+                v6_lookup();
+            }
+        });
+    } else {
+        /* Startup code resolves before the thread pool exists; there are no
+        coroutines to fan out with, and nothing to unblock anyway. */
+        v4_lookup();
+        v6_lookup();
     }
 
-    try {
-        hostname_to_ips_internal(host, AF_INET6, &ips);
-    } catch (const host_lookup_exc_t &ex) {
-        if (errored) throw;
+    if (v4_errored && v6_errored) {
+        std::rethrow_exception(v6_exc);
     }
 
+    std::set<ip_address_t> ips(v4_ips.begin(), v4_ips.end());
+    ips.insert(v6_ips.begin(), v6_ips.end());
     return ips;
 }
 
@@ -14,6 +14,7 @@
 #define UNUSED __pragma(warning(suppress: 4100 4101))
 #define MUST_USE _Check_return_
 #define NOINLINE __declspec(noinline)
+#define PREFETCH_READ(ptr) ((void)0)
 
 #else // gcc, clang
 
@@ -32,6 +33,9 @@
 #define UNUSED __attribute__((unused))
 #define MUST_USE __attribute__((warn_unused_result))
 #define NOINLINE __attribute__((noinline))
+// Hints that `ptr` will soon be read.  Purely an optimization; `ptr` need not
+// even be a valid address.
+#define PREFETCH_READ(ptr) __builtin_prefetch((ptr), 0, 1)
 
 #endif
 
@@ -22,7 +22,9 @@
 #include "arch/runtime/runtime.hpp"
 #include "arch/io/disk/filestat.hpp"
 #include "arch/io/disk/pool.hpp"
+#include "arch/io/disk/io_uring.hpp"
 #include "arch/io/disk/conflict_resolving.hpp"
+#include "arch/io/disk/merger.hpp"
 #include "arch/io/disk/stats.hpp"
 #include "arch/io/disk/accounting.hpp"
 #include "backtrace.hpp"
@@ -35,6 +37,12 @@ void verify_aligned_file_access(DEBUG_VAR int64_t file_size, DEBUG_VAR int64_t o
                                 DEBUG_VAR size_t length,
                                 DEBUG_VAR const scoped_array_t<iovec> &bufs);
 
+static io_backend_t requested_io_backend = io_backend_t::pool;
+
+void set_requested_io_backend(io_backend_t backend) {
+    requested_io_backend = backend;
+}
+
 /* Disk manager object takes care of queueing operations, collecting statistics, preventing
    conflicts, and actually sending them to the disk. */
 class linux_disk_manager_t : public home_thread_mixin_t {
@@ -53,24 +61,64 @@ public:
                          perfmon_collection_t *stats) :
         stack_stats(stats, "stack"),
         conflict_resolver(stats),
+        write_merger(stats),
         accounter(batch_factor),
         backend_stats(stats, "backend", accounter.producer),
-        backend(queue, backend_stats.producer, max_concurrent_io_requests),
         outstanding_txn(0)
     {
+        /* Construct the backend that pops operations off the bottom of the
+        queue.  io_uring is only used when it was requested at startup and the
+        running kernel actually supports it; otherwise we quietly use the
+        thread pool, same as always. */
+        bool use_uring = false;
+#ifdef RDB_HAVE_IO_URING
+        if (requested_io_backend == io_backend_t::io_uring) {
+            if (io_uring_diskmgr_t::available()) {
+                uring_backend.init(new io_uring_diskmgr_t(
+                    queue, backend_stats.producer, max_concurrent_io_requests));
+                use_uring = true;
+            } else {
+                logWRN("io_uring is not supported by this kernel; "
+                       "falling back to the thread-pool disk backend.");
+            }
+        }
+#else
+        if (requested_io_backend == io_backend_t::io_uring) {
+            logWRN("io_uring is not supported on this platform; "
+                   "falling back to the thread-pool disk backend.");
+        }
+#endif
+        if (!use_uring) {
+            pool_backend.init(new pool_diskmgr_t(
+                queue, backend_stats.producer, max_concurrent_io_requests));
+        }
+
         /* Hook up the `submit_fun`s of the parts of the IO stack that are above the
         queue. (The parts below the queue use the `passive_producer_t` interface instead
         of a callback function.) */
         stack_stats.submit_fun = std::bind(&conflict_resolving_diskmgr_t::submit,
                                            &conflict_resolver, ph::_1);
-        conflict_resolver.submit_fun = std::bind(&accounting_diskmgr_t::submit,
-                                                 &accounter, ph::_1);
+        conflict_resolver.submit_fun = std::bind(&merger_diskmgr_t::submit,
+                                                 &write_merger, ph::_1);
+        write_merger.submit_fun = std::bind(&accounting_diskmgr_t::submit,
+                                            &accounter, ph::_1);
 
         /* Hook up everything's `done_fun`. */
-        backend.done_fun = std::bind(&stats_diskmgr_2_t::done, &backend_stats, ph::_1);
+#ifdef RDB_HAVE_IO_URING
+        if (uring_backend.has()) {
+            uring_backend->done_fun =
+                std::bind(&stats_diskmgr_2_t::done, &backend_stats, ph::_1);
+        }
+#endif
+        if (pool_backend.has()) {
+            pool_backend->done_fun =
+                std::bind(&stats_diskmgr_2_t::done, &backend_stats, ph::_1);
+        }
         backend_stats.done_fun = std::bind(&accounting_diskmgr_t::done, &accounter, ph::_1);
-        accounter.done_fun = std::bind(&conflict_resolving_diskmgr_t::done,
-                                       &conflict_resolver, ph::_1);
+        accounter.done_fun = std::bind(&merger_diskmgr_t::done,
+                                       &write_merger, ph::_1);
+        write_merger.done_fun = std::bind(&conflict_resolving_diskmgr_t::done,
+                                          &conflict_resolver, ph::_1);
         conflict_resolver.done_fun = std::bind(&stats_diskmgr_t::done, &stack_stats, ph::_1);
         stack_stats.done_fun = std::bind(&linux_disk_manager_t::done, this, ph::_1);
     }
@@ -191,10 +239,13 @@ private:
 
     stats_diskmgr_t stack_stats;
     conflict_resolving_diskmgr_t conflict_resolver;
+    merger_diskmgr_t write_merger;
     accounting_diskmgr_t accounter;
     stats_diskmgr_2_t backend_stats;
-    pool_diskmgr_t backend;
-
+    scoped_ptr_t<pool_diskmgr_t> pool_backend;
+#ifdef RDB_HAVE_IO_URING
+    scoped_ptr_t<io_uring_diskmgr_t> uring_backend;
+#endif
 
     intptr_t outstanding_txn;
 
@@ -23,6 +23,19 @@ class linux_iocallback_t;
 
 class linux_disk_manager_t;
 
+/* Which backend the disk managers use to actually perform IO.  `pool` hands
+operations to a pool of blocker threads that make blocking syscalls; `io_uring`
+submits them from the event loop through a kernel io_uring instance (Linux
+only; silently falls back to `pool` where unsupported). */
+enum class io_backend_t {
+    pool,
+    io_uring
+};
+
+/* Sets the backend that subsequently-constructed `io_backender_t`s will use.
+Called once at startup, before any files are opened. */
+void set_requested_io_backend(io_backend_t backend);
+
 class io_backender_t : public home_thread_mixin_debug_only_t {
 public:
     // This takes what is effectively a global flag whether to use O_DIRECT here.  Nothing technical
@@ -0,0 +1,342 @@
+// Copyright 2010-2013 RethinkDB, all rights reserved.
+#include "arch/io/disk/io_uring.hpp"
+
+#ifdef RDB_HAVE_IO_URING
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "arch/io/disk.hpp"
+#include "config/args.hpp"
+#include "logger.hpp"
+
+/* We invoke the io_uring syscalls directly rather than going through liburing,
+the same way the event queues invoke epoll directly.  This keeps us free of a
+build-time dependency that many of our supported distributions don't ship. */
+
+static int io_uring_setup_syscall(unsigned entries, struct io_uring_params *p) {
+    return syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int io_uring_enter_syscall(int fd, unsigned to_submit,
+                                  unsigned min_complete, unsigned flags) {
+    return syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+                   static_cast<void *>(nullptr), 0);
+}
+
+bool io_uring_diskmgr_t::available() {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = io_uring_setup_syscall(4, &params);
+    if (fd < 0) {
+        return false;
+    }
+    close(fd);
+    return true;
+}
+
+/* Each action turns into at most three sqes: an optional leading fsync, the
+read/write itself, and an optional trailing fsync. */
+static const unsigned MAX_SQES_PER_ACTION = 3;
+
+io_uring_diskmgr_t::io_uring_diskmgr_t(linux_event_queue_t *_queue,
+                                       passive_producer_t<action_t *> *_source,
+                                       int max_concurrent_io_requests)
+    : queue(_queue),
+      queue_depth(max_concurrent_io_requests),
+      source(_source),
+      sqes_pending_submit(0),
+      n_pending(0),
+      pumping(false) {
+    /* Size the ring so that a full complement of in-flight actions, each
+    expanded into a datasync link chain, still fits.  The kernel rounds up to a
+    power of two. */
+    unsigned entries = std::min<unsigned>(
+        32768, queue_depth * MAX_SQES_PER_ACTION);
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring_fd = io_uring_setup_syscall(entries, &params);
+    guarantee_err(ring_fd >= 0, "Could not set up io_uring instance");
+
+    sq_ring_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_map_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    sqes_map_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    sq_ring_map = mmap(nullptr, sq_ring_map_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+    guarantee_err(sq_ring_map != MAP_FAILED, "Could not mmap io_uring sq ring");
+    cq_ring_map = mmap(nullptr, cq_ring_map_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+    guarantee_err(cq_ring_map != MAP_FAILED, "Could not mmap io_uring cq ring");
+    sqes = static_cast<struct io_uring_sqe *>(
+        mmap(nullptr, sqes_map_size, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES));
+    guarantee_err(sqes != MAP_FAILED, "Could not mmap io_uring sqe array");
+
+    char *sq_base = static_cast<char *>(sq_ring_map);
+    sq_head = reinterpret_cast<unsigned *>(sq_base + params.sq_off.head);
+    sq_tail = reinterpret_cast<unsigned *>(sq_base + params.sq_off.tail);
+    sq_mask = reinterpret_cast<unsigned *>(sq_base + params.sq_off.ring_mask);
+    sq_array = reinterpret_cast<unsigned *>(sq_base + params.sq_off.array);
+
+    char *cq_base = static_cast<char *>(cq_ring_map);
+    cq_head = reinterpret_cast<unsigned *>(cq_base + params.cq_off.head);
+    cq_tail = reinterpret_cast<unsigned *>(cq_base + params.cq_off.tail);
+    cq_mask = reinterpret_cast<unsigned *>(cq_base + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<struct io_uring_cqe *>(cq_base + params.cq_off.cqes);
+
+    /* The ring fd polls readable whenever completions are pending, so we can
+    treat it like any other fd on the event queue. */
+    queue->watch_resource(ring_fd, poll_event_in, this);
+
+    if (source->available->get()) { pump(); }
+    source->available->set_callback(this);
+}
+
+io_uring_diskmgr_t::~io_uring_diskmgr_t() {
+    assert_thread();
+    rassert(n_pending == 0);
+    source->available->unset_callback();
+    queue->forget_resource(ring_fd, this);
+    munmap(sqes, sqes_map_size);
+    munmap(cq_ring_map, cq_ring_map_size);
+    munmap(sq_ring_map, sq_ring_map_size);
+    close(ring_fd);
+}
+
+void io_uring_diskmgr_t::on_source_availability_changed() {
+    assert_thread();
+    if (source->available->get()) { pump(); }
+}
+
+struct io_uring_sqe *io_uring_diskmgr_t::get_sqe() {
+    unsigned head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+    unsigned tail = *sq_tail + sqes_pending_submit;
+    if (tail - head > *sq_mask) {
+        return nullptr;
+    }
+    unsigned index = tail & *sq_mask;
+    struct io_uring_sqe *sqe = &sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sq_array[index] = index;
+    sqes_pending_submit++;
+    return sqe;
+}
+
+void io_uring_diskmgr_t::enter(unsigned to_submit) {
+    __atomic_store_n(sq_tail, *sq_tail + to_submit, __ATOMIC_RELEASE);
+    unsigned remaining = to_submit;
+    while (remaining > 0) {
+        int res = io_uring_enter_syscall(ring_fd, remaining, 0, 0);
+        if (res >= 0) {
+            remaining -= res;
+        } else if (get_errno() == EINTR) {
+            continue;
+        } else if (get_errno() == EBUSY) {
+            /* Completion queue is saturated; drain it and try again. */
+            on_event(poll_event_in);
+        } else {
+            crash("io_uring_enter failed: %s", errno_string(get_errno()).c_str());
+        }
+    }
+}
+
+void io_uring_diskmgr_t::pump() {
+    assert_thread();
+    /* `done_fun()` on the synchronous resize path below can release a queued
+    conflicting action and re-enter `pump()` through
+    `on_source_availability_changed()` while this batch's sqes have been
+    written but not yet entered.  A nested `enter()` would advance `sq_tail`
+    past only the nested batch's sqes, submitting a prefix of an earlier
+    action's `IOSQE_IO_LINK` chain -- link chains do not span submission
+    batches, so that would silently sever the fsync ordering of a
+    datasync-wrapped write.  The loop below re-checks availability on every
+    iteration, so the nested call can simply bail out and leave the released
+    action to the outer one. */
+    if (pumping) {
+        return;
+    }
+    pumping = true;
+    for (;;) {
+        unsigned submitted = 0;
+        while (source->available->get() && n_pending < queue_depth) {
+            /* Reserve room for a worst-case link chain before popping. */
+            unsigned head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+            unsigned used = (*sq_tail + sqes_pending_submit) - head;
+            if (used + MAX_SQES_PER_ACTION > *sq_mask + 1) {
+                break;
+            }
+            action_t *a = source->pop();
+            n_pending++;
+            unsigned before = sqes_pending_submit;
+            submit_action(a);
+            submitted += sqes_pending_submit - before;
+        }
+        if (submitted == 0) {
+            break;
+        }
+        sqes_pending_submit -= submitted;
+        enter(submitted);
+        /* `enter()` may have drained completions (on EBUSY) whose `done_fun`
+        released further actions while nested calls were suppressed, so check
+        the source again before returning. */
+    }
+    pumping = false;
+}
+
+void io_uring_diskmgr_t::submit_action(action_t *a) {
+    if (a->get_is_resize()) {
+        /* There is no ftruncate op in the rings we target.  Resizes only
+        happen when a file grows by a whole extent (or on shutdown), so doing
+        them synchronously on the event loop is acceptable. */
+        int64_t res;
+        if (a->get_ds_op() == datasync_op::wrap_in_datasyncs) {
+            int errcode = perform_datasync(a->get_fd());
+            if (errcode != 0) {
+                a->set_io_result(-errcode);
+                done_fun(a);
+                n_pending--;
+                return;
+            }
+        }
+        do {
+            res = ftruncate(a->get_fd(), a->get_offset());
+        } while (res == -1 && get_errno() == EINTR);
+        res = (res == 0) ? 0 : -get_errno();
+        if (res == 0
+            && (a->get_ds_op() == datasync_op::wrap_in_datasyncs
+                || a->get_ds_op() == datasync_op::datasync_after)) {
+            int errcode = perform_datasync(a->get_fd());
+            if (errcode != 0) { res = -errcode; }
+        }
+        a->set_io_result(res);
+        done_fun(a);
+        n_pending--;
+        return;
+    }
+
+    uring_tag_t *tag = new uring_tag_t();
+    tag->action = a;
+    tag->remaining = 0;
+    tag->first_error = 0;
+    tag->bytes_done = 0;
+
+    bool sync_before = (a->get_ds_op() == datasync_op::wrap_in_datasyncs);
+    bool sync_after = (a->get_ds_op() == datasync_op::wrap_in_datasyncs
+                       || a->get_ds_op() == datasync_op::datasync_after);
+
+    if (sync_before) {
+        struct io_uring_sqe *sqe = get_sqe();
+        guarantee(sqe != nullptr);
+        sqe->opcode = IORING_OP_FSYNC;
+        sqe->fd = a->get_fd();
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+        sqe->flags = IOSQE_IO_LINK;
+        sqe->user_data = reinterpret_cast<uint64_t>(tag);
+        tag->remaining++;
+    }
+
+    iovec *vecs;
+    size_t vecs_len;
+    a->get_bufs(&vecs, &vecs_len);
+    struct io_uring_sqe *sqe = get_sqe();
+    guarantee(sqe != nullptr);
+    sqe->opcode = a->get_is_read() ? IORING_OP_READV : IORING_OP_WRITEV;
+    sqe->fd = a->get_fd();
+    sqe->addr = reinterpret_cast<uint64_t>(vecs);
+    sqe->len = vecs_len;
+    sqe->off = a->get_offset();
+    if (sync_after) {
+        sqe->flags = IOSQE_IO_LINK;
+    }
+    sqe->user_data = reinterpret_cast<uint64_t>(tag);
+    tag->remaining++;
+
+    if (sync_after) {
+        struct io_uring_sqe *sync_sqe = get_sqe();
+        guarantee(sync_sqe != nullptr);
+        sync_sqe->opcode = IORING_OP_FSYNC;
+        sync_sqe->fd = a->get_fd();
+        sync_sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+        sync_sqe->user_data = reinterpret_cast<uint64_t>(tag);
+        tag->remaining++;
+    }
+}
+
+void io_uring_diskmgr_t::on_event(int events) {
+    assert_thread();
+    if (events & (poll_event_err | poll_event_hup)) {
+        /* The ring fd never hangs up on its own; this would be a bug. */
+        crash("Error condition on io_uring fd: events = %d", events);
+    }
+    /* The event queue is edge triggered, so drain the completion queue
+    completely before returning. */
+    for (;;) {
+        unsigned head = *cq_head;
+        unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+        if (head == tail) {
+            break;
+        }
+        while (head != tail) {
+            struct io_uring_cqe *cqe = &cqes[head & *cq_mask];
+            uint64_t user_data = cqe->user_data;
+            int32_t res = cqe->res;
+            head++;
+            __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+            process_cqe(user_data, res);
+        }
+    }
+    pump();
+}
+
+void io_uring_diskmgr_t::process_cqe(uint64_t user_data, int32_t res) {
+    uring_tag_t *tag = reinterpret_cast<uring_tag_t *>(user_data);
+    if (res < 0) {
+        /* -ECANCELED means a later link in our chain was cancelled because an
+        earlier one failed; the earlier failure is the interesting one. */
+        if (tag->first_error == 0 && res != -ECANCELED) {
+            tag->first_error = res;
+        }
+    } else {
+        tag->bytes_done += res;
+    }
+    tag->remaining--;
+    rassert(tag->remaining >= 0);
+    if (tag->remaining == 0) {
+        finish_tag(tag);
+    }
+}
+
+void io_uring_diskmgr_t::finish_tag(uring_tag_t *tag) {
+    action_t *a = tag->action;
+    int64_t count = static_cast<int64_t>(a->get_count());
+    if (tag->first_error != 0) {
+        a->set_io_result(tag->first_error);
+    } else if (tag->bytes_done < count) {
+        /* Short reads/writes on regular files mean EOF or a full disk; the
+        pool backend's retry loop reaches the same conclusion eventually. */
+        if (a->get_is_read()) {
+            logERR("Failed I/O: we tried to read from behind the end of the file. "
+                   "Either the file got truncated, or there is a bug in RethinkDB.");
+            a->set_io_result(-EINVAL);
+        } else {
+            logERR("Failed I/O: io_uring write of %" PRIi64 " bytes stopped after "
+                   "%" PRIi64 " bytes. Assuming we ran out of disk space.",
+                   count, tag->bytes_done);
+            a->set_io_result(-ENOSPC);
+        }
+    } else {
+        a->set_io_result(count);
+    }
+    delete tag;
+    n_pending--;
+    done_fun(a);
+}
+
+#endif  // RDB_HAVE_IO_URING
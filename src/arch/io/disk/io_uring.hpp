@@ -0,0 +1,98 @@
+// Copyright 2010-2013 RethinkDB, all rights reserved.
+#ifndef ARCH_IO_DISK_IO_URING_HPP_
+#define ARCH_IO_DISK_IO_URING_HPP_
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define RDB_HAVE_IO_URING 1
+#endif
+#endif
+
+#ifdef RDB_HAVE_IO_URING
+
+#include <linux/io_uring.h>
+#include <stdint.h>
+
+#include "arch/io/disk/pool.hpp"
+#include "arch/runtime/event_queue.hpp"
+#include "concurrency/queue/passive_producer.hpp"
+
+/* The io_uring disk manager is an alternative to `pool_diskmgr_t` that submits
+reads and writes through a kernel io_uring instance instead of handing them to a
+pool of blocker threads.  Submission and completion both happen on the event
+loop thread: we push sqes and call `io_uring_enter`, and the ring fd is
+registered with the thread's event queue so that completions wake us up like
+any other fd.  This saves the two cross-thread hops (and the blocker pool
+mutex) that every operation pays in the pool backend.
+
+It consumes the same `pool_diskmgr_t::action_t` objects as the pool backend, so
+the rest of the IO stack (conflict resolution, accounting, stats) is unchanged. */
+
+class io_uring_diskmgr_t : private availability_callback_t,
+                           private linux_event_callback_t,
+                           public home_thread_mixin_debug_only_t {
+public:
+    typedef pool_diskmgr_t::action_t action_t;
+
+    /* Returns false if the running kernel does not support io_uring (or it is
+    disabled by seccomp or sysctl), in which case callers should fall back to
+    the pool backend. */
+    static bool available();
+
+    io_uring_diskmgr_t(linux_event_queue_t *queue,
+                       passive_producer_t<action_t *> *source,
+                       int max_concurrent_io_requests);
+    std::function<void(action_t *)> done_fun;
+    ~io_uring_diskmgr_t();
+
+private:
+    /* One `uring_tag_t` is allocated per action.  An action can expand into
+    more than one sqe (datasync-wrapped writes become fsync/write/fsync link
+    chains), so we count outstanding cqes and deliver the action when the last
+    one arrives. */
+    struct uring_tag_t {
+        action_t *action;
+        int remaining;
+        int64_t first_error;  // 0, or the negated errno of the first failed cqe
+        int64_t bytes_done;   // accumulated result of the read/write cqe
+    };
+
+    void on_source_availability_changed();
+    void on_event(int events);
+
+    void pump();
+    void submit_action(action_t *a);
+    void process_cqe(uint64_t user_data, int32_t res);
+    void finish_tag(uring_tag_t *tag);
+
+    struct io_uring_sqe *get_sqe();
+    void enter(unsigned to_submit);
+
+    linux_event_queue_t *queue;
+    const int queue_depth;
+    passive_producer_t<action_t *> *source;
+
+    fd_t ring_fd;
+
+    // Mapped submission/completion queue state.
+    void *sq_ring_map;
+    size_t sq_ring_map_size;
+    void *cq_ring_map;
+    size_t cq_ring_map_size;
+    struct io_uring_sqe *sqes;
+    size_t sqes_map_size;
+
+    unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_cqe *cqes;
+
+    unsigned sqes_pending_submit;
+    int n_pending;
+    bool pumping;
+
+    DISABLE_COPYING(io_uring_diskmgr_t);
+};
+
+#endif  // RDB_HAVE_IO_URING
+
+#endif /* ARCH_IO_DISK_IO_URING_HPP_ */
@@ -0,0 +1,152 @@
+// Copyright 2010-2013 RethinkDB, all rights reserved.
+#include "arch/io/disk/merger.hpp"
+
+#include <limits.h>
+
+#include <algorithm>
+
+#include "arch/io/disk.hpp"
+#include "arch/runtime/runtime.hpp"
+
+merger_diskmgr_t::merger_diskmgr_t(perfmon_collection_t *stats)
+    : flush_scheduled(false),
+      merged_writes_stat(),
+      merged_writes_stat_membership(stats, &merged_writes_stat, "merged_writes") { }
+
+merger_diskmgr_t::~merger_diskmgr_t() {
+    rassert(pending_runs.empty());
+    rassert(in_flight_merges.empty());
+}
+
+bool merger_diskmgr_t::is_mergeable(const action_t *a) const {
+    /* Only plain writes can be merged.  A datasync-carrying write has ordering
+    semantics of its own, and reads complete too soon to be worth delaying. */
+    return a->get_is_write()
+        && a->get_ds_op() == datasync_op::no_datasyncs;
+}
+
+void merger_diskmgr_t::submit(action_t *action) {
+    if (!is_mergeable(action)) {
+        submit_fun(action);
+        return;
+    }
+
+    const std::pair<fd_t, int64_t> begin_key(action->get_fd(),
+                                             action->get_offset());
+    const int64_t action_end = action->get_offset()
+        + static_cast<int64_t>(action->get_count());
+
+    pending_run_t *run;
+    std::map<std::pair<fd_t, int64_t>, pending_run_t *>::iterator it =
+        pending_runs.find(begin_key);
+    if (it != pending_runs.end()
+        && it->second->members[0]->account == action->account
+        && it->second->end_offset - it->second->begin_offset
+               + static_cast<int64_t>(action->get_count())
+           <= static_cast<int64_t>(MAX_MERGED_BYTES)
+        && it->second->members.size() < static_cast<size_t>(IOV_MAX)) {
+        /* This write starts exactly where an existing run ends; append it.
+        (We only merge forward, which is the pattern the data block manager
+        produces during a flush.  Runs built backwards just don't merge.) */
+        run = it->second;
+        pending_runs.erase(it);
+        run->members.push_back(action);
+        run->end_offset = action_end;
+    } else {
+        run = new pending_run_t;
+        run->members.push_back(action);
+        run->begin_offset = action->get_offset();
+        run->end_offset = action_end;
+    }
+    pending_runs.insert(std::make_pair(
+        std::make_pair(action->get_fd(), run->end_offset), run));
+
+    if (!flush_scheduled) {
+        /* Flush at the end of the current event-loop iteration, after the
+        caller (and everything else running this iteration) has submitted the
+        rest of its writes. */
+        flush_scheduled = true;
+        call_later_on_this_thread(this);
+    }
+}
+
+void merger_diskmgr_t::on_thread_switch() {
+    flush_scheduled = false;
+    flush_pending();
+}
+
+void merger_diskmgr_t::flush_pending() {
+    while (!pending_runs.empty()) {
+        pending_run_t *run = pending_runs.begin()->second;
+        pending_runs.erase(pending_runs.begin());
+        flush_run(run);
+    }
+}
+
+void merger_diskmgr_t::flush_run(pending_run_t *run) {
+    if (run->members.size() == 1) {
+        /* Nothing merged; pass the write through as-is. */
+        submit_fun(run->members[0]);
+        delete run;
+        return;
+    }
+
+    /* Concatenate the members' buffers into one vectored write. */
+    size_t total_vecs = 0;
+    for (size_t i = 0; i < run->members.size(); ++i) {
+        iovec *vecs;
+        size_t vecs_len;
+        run->members[i]->get_bufs(&vecs, &vecs_len);
+        total_vecs += vecs_len;
+    }
+    scoped_array_t<iovec> bufs(total_vecs);
+    size_t vec_index = 0;
+    for (size_t i = 0; i < run->members.size(); ++i) {
+        iovec *vecs;
+        size_t vecs_len;
+        run->members[i]->get_bufs(&vecs, &vecs_len);
+        for (size_t j = 0; j < vecs_len; ++j) {
+            bufs[vec_index++] = vecs[j];
+        }
+    }
+
+    action_t *combined = new action_t;
+    combined->make_writev(run->members[0]->get_fd(), std::move(bufs),
+                          run->end_offset - run->begin_offset,
+                          run->begin_offset);
+    combined->account = run->members[0]->account;
+
+    merged_writes_stat += run->members.size() - 1;
+
+    in_flight_merges.insert(std::make_pair(combined, run));
+    submit_fun(combined);
+}
+
+void merger_diskmgr_t::done(action_t *payload) {
+    std::map<action_t *, pending_run_t *>::iterator it =
+        in_flight_merges.find(payload);
+    if (it == in_flight_merges.end()) {
+        /* A pass-through action; send it back up the chain. */
+        done_fun(payload);
+        return;
+    }
+
+    pending_run_t *run = it->second;
+    in_flight_merges.erase(it);
+
+    /* Distribute the combined result to the members.  On success every member
+    got all of its bytes written; on failure they all share the errno. */
+    const bool succeeded = payload->get_succeeded();
+    const int errsv = succeeded ? 0 : payload->get_io_errno();
+    for (size_t i = 0; i < run->members.size(); ++i) {
+        action_t *member = run->members[i];
+        if (succeeded) {
+            member->set_io_result(static_cast<int64_t>(member->get_count()));
+        } else {
+            member->set_io_result(-errsv);
+        }
+        done_fun(member);
+    }
+    delete run;
+    delete payload;
+}
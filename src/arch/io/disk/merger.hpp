@@ -0,0 +1,85 @@
+// Copyright 2010-2013 RethinkDB, all rights reserved.
+#ifndef ARCH_IO_DISK_MERGER_HPP_
+#define ARCH_IO_DISK_MERGER_HPP_
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "arch/io/disk/accounting.hpp"
+#include "arch/runtime/runtime_utils.hpp"
+#include "perfmon/perfmon.hpp"
+
+/* The merger disk manager sits between the conflict resolver and the
+accounter.  It coalesces physically adjacent plain write operations (same fd,
+same account, no datasync requirement) into a single vectored write, so that a
+flush which produces thousands of extent-adjacent 4KB datablock writes reaches
+the device as a handful of pwritev calls instead of a storm of individual
+IOPS.
+
+Writes that start or extend a mergeable run are held back until the end of the
+current event-loop iteration (via `call_later_on_this_thread`) and then
+submitted as one combined writev action.  This adds no latency beyond the
+iteration in which the writes were issued.  Reads, resizes and datasync-
+carrying writes are passed through untouched.
+
+The conflict resolver has already guaranteed that no two operations in flight
+overlap, so merging adjacent writes cannot reorder anything observable. */
+
+struct merger_diskmgr_t : private linux_thread_message_t {
+    explicit merger_diskmgr_t(perfmon_collection_t *stats);
+    ~merger_diskmgr_t();
+
+    typedef accounting_diskmgr_action_t action_t;
+
+    void submit(action_t *action);
+    std::function<void(action_t *)> done_fun;
+
+    /* Calls submit_fun() to send actions (possibly synthetic merged ones) down
+    to the next level.  The next level calls done() when an action completes. */
+    std::function<void(action_t *)> submit_fun;
+    void done(action_t *payload);
+
+    /* Submits all held-back writes immediately.  Normally this happens
+    automatically at the end of the event-loop iteration; it is public for the
+    benefit of the unit tests. */
+    void flush_pending();
+
+    /* The largest number of bytes we are willing to combine into one
+    submission.  Bigger writes than this gain nothing and just delay
+    completion of their first member. */
+    static const size_t MAX_MERGED_BYTES = 4 * MEGABYTE;
+
+private:
+    /* A run of adjacent writes that have not been flushed downwards yet. */
+    struct pending_run_t {
+        std::vector<action_t *> members;
+        int64_t begin_offset;
+        int64_t end_offset;
+    };
+
+    /* Flush message delivered at the end of the current event-loop batch. */
+    void on_thread_switch();
+
+    void flush_run(pending_run_t *run);
+
+    bool is_mergeable(const action_t *a) const;
+
+    /* Pending runs indexed by (fd, end offset), so that a write starting where
+    an existing run ends can find it in O(log n).  We only merge forward
+    (appends), which is the pattern the data block manager produces. */
+    std::map<std::pair<fd_t, int64_t>, pending_run_t *> pending_runs;
+
+    /* Synthetic combined actions currently in flight, mapped to the members
+    they carry. */
+    std::map<action_t *, pending_run_t *> in_flight_merges;
+
+    bool flush_scheduled;
+
+    perfmon_counter_t merged_writes_stat;
+    perfmon_membership_t merged_writes_stat_membership;
+
+    DISABLE_COPYING(merger_diskmgr_t);
+};
+
+#endif /* ARCH_IO_DISK_MERGER_HPP_ */
@@ -7,6 +7,9 @@
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <map>
+
+#include "arch/io/concurrency.hpp"
 #include "arch/io/disk.hpp"
 #include "config/args.hpp"
 #include "containers/printf_buffer.hpp"
@@ -148,9 +151,78 @@ int64_t pool_diskmgr_t::action_t::perform_read_write(iovec *vecs,
     return total_bytes;
 }
 
+/* Coalesces concurrent datasyncs on the same fd. An fdatasync makes durable
+everything that was written to the file before the call *started*, so a single
+sync can stand in for any number of requests that arrived while a previous sync
+was in flight. Under a hard-durability write load many pool threads ask for a
+sync on the data file at nearly the same time; without this, each of them pays
+for its own device flush.
+
+The rule is that a sync only covers a request if it started after the request
+arrived: a sync that was already running when we got here may predate our
+write, so such a request waits for the running sync to finish and then joins
+the next one. All requests that accumulate during a running sync are satisfied
+by one fdatasync. This runs on blocker-pool threads, hence the system mutex
+and condition variable rather than coroutine primitives. */
+class datasync_coalescer_t {
+public:
+    int perform(fd_t fd) {
+        fd_state_t *state;
+        {
+            system_mutex_t::lock_t map_acq(&map_mutex);
+            state = &states[fd];
+        }
+        {
+            system_mutex_t::lock_t acq(&state->mutex);
+            const uint64_t target
+                = state->generation + (state->sync_running ? 2 : 1);
+            while (state->generation < target && state->sync_running) {
+                state->done.wait(&state->mutex);
+            }
+            if (state->generation >= target) {
+                return state->first_error;
+            }
+            /* It's our turn to sync on behalf of everyone who arrived while
+            the previous sync was running. */
+            state->sync_running = true;
+        }
+        int errcode = perform_datasync(fd);
+        {
+            system_mutex_t::lock_t acq(&state->mutex);
+            state->sync_running = false;
+            ++state->generation;
+            if (errcode != 0 && state->first_error == 0) {
+                /* Errors are sticky: a later successful sync must not mask an
+                earlier failure (the kernel only reports a writeback error
+                once). In practice any error here is fatal upstream anyway. */
+                state->first_error = errcode;
+            }
+            state->done.broadcast();
+            return state->first_error;
+        }
+    }
+
+private:
+    struct fd_state_t {
+        system_mutex_t mutex;
+        system_cond_t done;
+        uint64_t generation = 0;
+        bool sync_running = false;
+        int first_error = 0;
+    };
+
+    system_mutex_t map_mutex;
+    /* Entries are never removed; there are only a handful of files per
+    process, and `std::map` nodes are stable so `fd_state_t`s can be used
+    outside `map_mutex`. */
+    std::map<fd_t, fd_state_t> states;
+};
+
+datasync_coalescer_t datasync_coalescer;
+
 void pool_diskmgr_t::action_t::run() {
     if (ds_op == datasync_op::wrap_in_datasyncs) {
-        int errcode = perform_datasync(fd);
+        int errcode = datasync_coalescer.perform(fd);
         if (errcode != 0) {
             io_result = -errcode;
             return;
@@ -196,7 +268,7 @@ void pool_diskmgr_t::action_t::run() {
 
     if (ds_op == datasync_op::wrap_in_datasyncs
         || ds_op == datasync_op::datasync_after) {
-        int errcode = perform_datasync(fd);
+        int errcode = datasync_coalescer.perform(fd);
         if (errcode != 0) {
             io_result = -errcode;
             return;
@@ -93,6 +93,11 @@ struct pool_diskmgr_action_t
     size_t get_count() const { return buf_and_count.iov_len; }
     int64_t get_offset() const { return offset; }
     int64_t get_size_change() const { return size_change; }
+    datasync_op get_ds_op() const { return ds_op; }
+
+    // Used by backends (such as the io_uring disk manager) that perform the
+    // IO themselves instead of calling `run()`.
+    void set_io_result(int64_t res) { io_result = res; }
 
     void set_successful_due_to_conflict() { io_result = get_count(); }
     bool get_succeeded() const { return io_result == static_cast<int64_t>(get_count()); }
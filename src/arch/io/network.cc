@@ -403,7 +403,7 @@ void linux_tcp_conn_t::read(void *buf, size_t size, signal_t *closer) THROWS_ONL
     read_op_wrapper_t sentry(this, closer);
 
     /* First, consume any data in the peek buffer */
-    int read_buffer_bytes = std::min(read_buffer.size(), size);
+    size_t read_buffer_bytes = std::min(read_buffer.size(), size);
     memcpy(buf, read_buffer.data(), read_buffer_bytes);
     read_buffer.erase_front(read_buffer_bytes);
     buf = reinterpret_cast<void *>(reinterpret_cast<char *>(buf) + read_buffer_bytes);
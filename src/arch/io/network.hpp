@@ -142,6 +142,11 @@ public:
     void write_buffered(const void *buf, size_t size, signal_t *closer)
         THROWS_ONLY(tcp_conn_write_closed_exc_t);
 
+    /* The size of the chunks that `write_buffered()` accumulates before pushing
+    them onto the write queue.  Writes of at least this size gain nothing from
+    buffering and are better off going through `write()` directly. */
+    static const size_t WRITE_CHUNK_SIZE = 8 * KILOBYTE;
+
     void writef(signal_t *closer, const char *format, ...)
         THROWS_ONLY(tcp_conn_write_closed_exc_t) ATTR_FORMAT(printf, 3, 4);
 
@@ -267,7 +272,6 @@ private:
     lazy_erase_vector_t<char> read_buffer;
 
     static const size_t WRITE_QUEUE_MAX_SIZE = 128 * KILOBYTE;
-    static const size_t WRITE_CHUNK_SIZE = 8 * KILOBYTE;
 
     /* Structs to avoid over-using dynamic allocation */
     struct write_buffer_t : public intrusive_list_node_t<write_buffer_t> {
@@ -476,7 +480,15 @@ private:
 
     /* accept_loop() runs in a separate coroutine. It repeatedly tries to accept
     new connections; when accept() blocks, then it waits for events from the
-    event loop. */
+    event loop.
+
+    A single accept loop is enough even under reconnect storms: the loop only
+    performs the accept() itself and hands the fd off, while everything
+    per-connection that is actually expensive (the TLS handshake, SCRAM
+    authentication, query parsing) happens after the connection has been moved
+    to its round-robin-chosen destination thread.  Sharding the listener with
+    SO_REUSEPORT would spread only the accept() syscalls, at the cost of
+    per-thread socket lifecycles and losing the even round-robin placement. */
     void accept_loop(auto_drainer_t::lock_t lock);
 
 #ifdef _WIN32
@@ -392,6 +392,42 @@ void artificial_stack_t::disable_overflow_protection() {
 #endif
 }
 
+void artificial_stack_t::free_unused_memory() {
+    /* Figure out where the stack pointer currently is. If we are running on
+    this very stack, take the address of a local variable; if the stack is
+    parked, use the stack pointer that was saved by the last context switch. */
+    char local;
+    const void *stack_pointer;
+    if (address_in_stack(&local)) {
+        stack_pointer = &local;
+    } else if (!context.is_nil() && address_in_stack(context.pointer)) {
+        stack_pointer = context.pointer;
+    } else {
+        return;
+    }
+
+    /* Leave one page of headroom below the stack pointer, so that we neither
+    discard data in the red zone nor the registers that the next context switch
+    is going to push. Everything below that is unused (though possibly dirty
+    from an earlier, deeper call chain) and can be handed back to the operating
+    system. */
+    const size_t page_size = getpagesize();
+    const uintptr_t keep_from = floor_aligned(
+        reinterpret_cast<uintptr_t>(stack_pointer) - page_size, page_size);
+    char *const bound = stack.get();
+    if (keep_from <= reinterpret_cast<uintptr_t>(bound)) {
+        return;
+    }
+
+    /* On OS X we use MADV_FREE. On Linux MADV_FREE is not available,
+    and we use MADV_DONTNEED instead. */
+#ifdef __MACH__
+    madvise(bound, keep_from - reinterpret_cast<uintptr_t>(bound), MADV_FREE);
+#else
+    madvise(bound, keep_from - reinterpret_cast<uintptr_t>(bound), MADV_DONTNEED);
+#endif
+}
+
 bool artificial_stack_t::address_in_stack(const void *addr) const {
     return reinterpret_cast<uintptr_t>(addr) >=
             reinterpret_cast<uintptr_t>(get_stack_bound())
@@ -28,6 +28,9 @@ public:
     I think fibers always have some overflow protection though? */
     void enable_overflow_protection() {}
     void disable_overflow_protection() {}
+
+    /* Not implemented for fiber stacks; the OS manages their memory. */
+    void free_unused_memory() {}
 };
 
 void context_switch(fiber_context_ref_t *current_context_out, fiber_context_ref_t *dest_context_in);
@@ -108,6 +111,13 @@ public:
     /* Disables stack-smashing protection for this stack, if currently enabled */
     void disable_overflow_protection();
 
+    /* Returns the memory backing the currently unused part of the stack to the
+    operating system, lowering the process's resident memory footprint. Safe to
+    call both while the stack is running and while it is parked. The stack
+    remains fully usable; discarded pages come back zero-filled if the stack
+    grows into them again. */
+    void free_unused_memory();
+
 private:
     scoped_page_aligned_ptr_t<char> stack;
     size_t stack_size;
@@ -228,6 +238,9 @@ public:
     void enable_overflow_protection() {}
     void disable_overflow_protection() {}
 
+    /* Not implemented for threaded stacks; the OS manages their memory. */
+    void free_unused_memory() {}
+
 private:
     static void *internal_run(void *p);
     void get_stack_addr_size(void **stackaddr_out, size_t *stacksize_out) const;
@@ -206,6 +206,13 @@ void coro_t::return_coro_to_free_list(coro_t *coro) {
     }
     rassert(cglobals->free_coros.size() < COROUTINE_FREE_LIST_SIZE);
     cglobals->free_coros.push_back(coro);
+
+    /* While `coro` sits on the free list, the pages that its last task dirtied
+    would otherwise stay resident. Hand everything below the (possibly still
+    live) stack pointer back to the operating system, so that bursts of
+    coroutines with deep call chains don't permanently inflate our memory
+    footprint. */
+    coro->stack.free_unused_memory();
 }
 
 coro_t::~coro_t() {
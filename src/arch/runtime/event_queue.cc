@@ -1,12 +1,18 @@
 // Copyright 2010-2012 RethinkDB, all rights reserved.
 #include "arch/runtime/event_queue.hpp"
 
+#include <inttypes.h>
 #include <string.h>
 
+#include <typeinfo>
+
 #include "arch/runtime/thread_pool.hpp"
 #include "concurrency/cond_var.hpp"
+#include "config/args.hpp"
+#include "logger.hpp"
 #include "utils.hpp"
 #include "perfmon/perfmon.hpp"
+#include "time.hpp"
 
 perfmon_duration_sampler_t *pm_eventloop_singleton_t::get() {
     static perfmon_duration_sampler_t pm_eventloop(secs_to_ticks(1));
@@ -15,6 +21,31 @@ perfmon_duration_sampler_t *pm_eventloop_singleton_t::get() {
     return &pm_eventloop;
 }
 
+perfmon_duration_sampler_t *pm_eventloop_callbacks_singleton_t::get() {
+    static perfmon_duration_sampler_t pm_eventloop_callbacks(secs_to_ticks(1));
+    static perfmon_membership_t pm_eventloop_callbacks_membership(
+        &get_global_perfmon_collection(), &pm_eventloop_callbacks,
+        "eventloop_callbacks");
+    return &pm_eventloop_callbacks;
+}
+
+void event_queue_dispatch_event(linux_event_callback_t *cb, int events) {
+    block_pm_duration callback_timer(pm_eventloop_callbacks_singleton_t::get());
+
+    const int64_t start_nanos = get_ticks().nanos;
+    cb->on_event(events);
+    const int64_t duration_nanos = get_ticks().nanos - start_nanos;
+
+    if (duration_nanos
+        >= EVENT_QUEUE_SLOW_CALLBACK_WARNING_MS * MILLION) {
+        // We can only attribute the time after the fact, but the callback's
+        // type usually narrows the culprit down enough to go look at it.
+        logWRN("An event callback (%s) blocked the event loop for %" PRIi64
+               " ms. Everything else on this thread was stalled meanwhile.",
+               typeid(*cb).name(), duration_nanos / MILLION);
+    }
+}
+
 std::string format_poll_event(int event) {
     std::string s;
     if (event & poll_event_in) {
@@ -21,6 +21,17 @@ struct pm_eventloop_singleton_t {
     static perfmon_duration_sampler_t *get();
 };
 
+// Per-callback counterpart to the per-iteration `eventloop` stat above.
+struct pm_eventloop_callbacks_singleton_t {
+    static perfmon_duration_sampler_t *get();
+};
+
+// Calls `cb->on_event(events)`, feeding its duration into the
+// `eventloop_callbacks` stat.  A callback that blocks the event loop for at
+// least EVENT_QUEUE_SLOW_CALLBACK_WARNING_MS also gets a log warning naming
+// its type, so slow callbacks show up before clients time out.
+void event_queue_dispatch_event(linux_event_callback_t *cb, int events);
+
 /* Pick the queue now*/
 
 #if defined(_WIN32)
@@ -112,7 +112,7 @@ void epoll_event_queue_t::run() {
                 if (events_gotten & poll_event_in) rassert(events_wanted & poll_event_in);
                 if (events_gotten & poll_event_out) rassert(events_wanted & poll_event_out);
 #endif
-                cb->on_event(events_gotten);
+                event_queue_dispatch_event(cb, events_gotten);
             }
         }
 
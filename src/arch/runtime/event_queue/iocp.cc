@@ -3,6 +3,7 @@
 #include <inttypes.h>
 
 #include "arch/timer.hpp"
+#include "arch/runtime/event_queue.hpp"
 #include "arch/runtime/event_queue/iocp.hpp"
 #include "arch/runtime/thread_pool.hpp"
 #include "arch/io/event_watcher.hpp"
@@ -176,7 +177,7 @@ void iocp_event_queue_t::run() {
                                   "GetQueuedCompletionStatus failed");
                 linux_event_callback_t *cb =
                     reinterpret_cast<linux_event_callback_t*>(overlapped);
-                cb->on_event(poll_event_in);
+                event_queue_dispatch_event(cb, poll_event_in);
                 break;
             }
 
@@ -77,7 +77,7 @@ void kqueue_event_queue_t::run() {
             } else {
                 linux_event_callback_t *cb =
                     reinterpret_cast<linux_event_callback_t *>(events[i].udata);
-                cb->on_event(kevent_filter_to_user(events[i].filter));
+                event_queue_dispatch_event(cb, kevent_filter_to_user(events[i].filter));
             }
         }
 
@@ -126,7 +126,7 @@ void poll_event_queue_t::run() {
         for (unsigned int i = 0; i < watched_fds.size(); i++) {
             if (watched_fds[i].revents != 0) {
                 linux_event_callback_t *cb = callbacks[watched_fds[i].fd];
-                cb->on_event(poll_to_user(watched_fds[i].revents));
+                event_queue_dispatch_event(cb, poll_to_user(watched_fds[i].revents));
                 count++;
             }
             if (count == res)
@@ -26,6 +26,11 @@ linux_message_hub_t::linux_message_hub_t(linux_event_queue_t *queue,
       is_woken_up_(false),
       current_thread_(current_thread) {
 
+    for (int i = 0; i < NUM_SCHEDULER_PRIORITIES; ++i) {
+        lifo_slots_[i] = nullptr;
+        lifo_grants_[i] = 0;
+    }
+
 #ifndef NDEBUG
     if(MESSAGE_SCHEDULER_GRANULARITY < (1 << (NUM_SCHEDULER_PRIORITIES))) {
         logWRN("MESSAGE_SCHEDULER_GRANULARITY is too small to honor some of the "
@@ -45,6 +50,7 @@ linux_message_hub_t::~linux_message_hub_t() {
          ++p) {
 
         guarantee(get_priority_msg_list(p).empty());
+        guarantee(get_lifo_slot(p) == nullptr);
     }
 
     guarantee(incoming_messages_.empty());
@@ -113,6 +119,12 @@ linux_message_hub_t::msg_list_t &linux_message_hub_t::get_priority_msg_list(int
     return priority_msg_lists_[priority - MESSAGE_SCHEDULER_MIN_PRIORITY];
 }
 
+linux_thread_message_t *&linux_message_hub_t::get_lifo_slot(int priority) {
+    rassert(priority >= MESSAGE_SCHEDULER_MIN_PRIORITY);
+    rassert(priority <= MESSAGE_SCHEDULER_MAX_PRIORITY);
+    return lifo_slots_[priority - MESSAGE_SCHEDULER_MIN_PRIORITY];
+}
+
 void linux_message_hub_t::on_event(int events) {
     if (events != poll_event_in) {
         logERR("Unexpected event mask: %d", events);
@@ -132,6 +144,7 @@ void linux_message_hub_t::on_event(int events) {
     size_t total_pending_msgs = 0;
     for (int i = 0; i < NUM_SCHEDULER_PRIORITIES; ++i) {
         total_pending_msgs += priority_msg_lists_[i].size();
+        total_pending_msgs += lifo_slots_[i] != nullptr ? 1 : 0;
     }
     const size_t effective_granularity = std::min(total_pending_msgs,
                                                   static_cast<size_t>(MESSAGE_SCHEDULER_GRANULARITY));
@@ -152,11 +165,27 @@ void linux_message_hub_t::on_event(int events) {
         size_t to_process_from_priority =
             std::max(static_cast<size_t>(1), effective_granularity >> priority_exponent);
 
-        for (linux_thread_message_t *m = get_priority_msg_list(current_priority).head();
-             m != nullptr && to_process_from_priority > 0;
-             m = get_priority_msg_list(current_priority).head()) {
-
-            get_priority_msg_list(current_priority).remove(m);
+        while (to_process_from_priority > 0) {
+            // Serve the LIFO slot (the newest unordered message, whose
+            // coroutine is still cache-hot) ahead of the FIFO backlog, unless
+            // it has already bypassed the backlog
+            // MESSAGE_SCHEDULER_LIFO_BURST times in a row.
+            linux_thread_message_t *m;
+            linux_thread_message_t *&slot = get_lifo_slot(current_priority);
+            int *grants = &lifo_grants_[current_priority - MESSAGE_SCHEDULER_MIN_PRIORITY];
+            if (slot != nullptr
+                && (*grants < MESSAGE_SCHEDULER_LIFO_BURST
+                    || get_priority_msg_list(current_priority).empty())) {
+                m = slot;
+                slot = nullptr;
+                ++*grants;
+            } else if (!get_priority_msg_list(current_priority).empty()) {
+                m = get_priority_msg_list(current_priority).head();
+                get_priority_msg_list(current_priority).remove(m);
+                *grants = 0;
+            } else {
+                break;
+            }
             --to_process_from_priority;
 
 #ifndef NDEBUG
@@ -174,7 +203,7 @@ void linux_message_hub_t::on_event(int events) {
     // We might have left some messages unprocessed.
     // Check if that is the case, and if yes, make sure we are called again.
     for (int i = 0; i < NUM_SCHEDULER_PRIORITIES; ++i) {
-        if (!priority_msg_lists_[i].empty()) {
+        if (!priority_msg_lists_[i].empty() || lifo_slots_[i] != nullptr) {
             // Place wakey_wakey and then yield to the event processing.
             // It will wake us up again immediately, but can handle a few
             // OS events (such as timers, network messages etc.) in the meantime.
@@ -216,8 +245,17 @@ void linux_message_hub_t::sort_incoming_messages_by_priority() {
             // ordered message.
             effective_priority = MESSAGE_SCHEDULER_ORDERED_PRIORITY;
             m->is_ordered = false;
+            get_priority_msg_list(effective_priority).push_back(m);
+        } else {
+            // Unordered messages may be delivered in any order, so the newest
+            // one claims the priority's LIFO slot and the previous occupant
+            // joins the back of the FIFO backlog.
+            linux_thread_message_t *&slot = get_lifo_slot(effective_priority);
+            if (slot != nullptr) {
+                get_priority_msg_list(effective_priority).push_back(slot);
+            }
+            slot = m;
         }
-        get_priority_msg_list(effective_priority).push_back(m);
     }
 }
 
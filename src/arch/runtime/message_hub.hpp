@@ -23,7 +23,15 @@ class linux_thread_pool_t;
 /* There is one message hub per thread, NOT one message hub for the entire program.
 
 Each message hub stores messages that are going from that message hub's home thread to
-other threads. It keeps a separate queue for messages destined for each other thread. */
+other threads. It keeps a separate queue for messages destined for each other thread.
+
+Note on cost: `store_message_ordered()` and `store_message_sometime()` only
+append to a thread-local list and take no locks.  The cross-thread handoff
+happens in `push_messages()`, once per event-loop iteration, which splices each
+destination's whole batch into that destination's `incoming_messages_` under a
+single spinlock acquisition and writes the destination's eventfd only if it
+isn't already awake (`is_woken_up_`).  So the per-message cost of cross-thread
+messaging is two pointer updates, regardless of message rate. */
 
 class linux_message_hub_t : private linux_event_callback_t {
 public:
@@ -87,6 +95,18 @@ private:
     // MESSAGE_SCHEDULER_ORDERED_PRIORITY)
     msg_list_t priority_msg_lists_[NUM_SCHEDULER_PRIORITIES];
 
+    // Per priority, a one-message slot holding the newest unordered message
+    // from the last `sort_incoming_messages_by_priority()`. `on_event()`
+    // serves it before the corresponding `priority_msg_lists_` entry (the
+    // just-unblocked coroutine is the cache-hot one), but at most
+    // MESSAGE_SCHEDULER_LIFO_BURST times in a row so the FIFO backlog cannot
+    // starve. Ordered messages never go through the slot; their delivery
+    // order is a guarantee.
+    linux_thread_message_t *lifo_slots_[NUM_SCHEDULER_PRIORITIES];
+    int lifo_grants_[NUM_SCHEDULER_PRIORITIES];
+
+    linux_thread_message_t *&get_lifo_slot(int priority);
+
     void on_event(int events);
 
     // The eventfd (or pipe-based alternative) notified after the first incoming
@@ -3,9 +3,13 @@
 
 #include <errno.h>
 #include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
+#include <vector>
+
 #ifndef _WIN32
 #include <sys/time.h>
 #endif
@@ -38,6 +42,59 @@ linux_thread_pool_t *linux_thread_pool_t::get_global_thread_pool() {
 
 THREAD_LOCAL linux_thread_pool_t *linux_thread_pool_t::thread_pool = nullptr;
 THREAD_LOCAL int linux_thread_pool_t::thread_id = -1;
+
+#ifdef _GNU_SOURCE
+// Returns the machine's CPUs grouped by NUMA node (all of node 0's CPUs first,
+// then node 1's, and so on), or an empty vector if the topology can't be read.
+// Pinning worker threads in this order keeps neighbouring threads -- which host
+// the CPU shards of the same tables -- on one socket, and first-touch
+// allocation then keeps each cache's memory on the socket that accesses it.
+// The kernel's default CPU numbering often interleaves sockets, which is why
+// plain round-robin pinning isn't enough on multi-socket machines.
+static std::vector<int> cpus_grouped_by_numa_node() {
+    std::vector<int> cpus;
+    for (int node = 0; ; ++node) {
+        char path[128];
+        snprintf(path, sizeof(path),
+                 "/sys/devices/system/node/node%d/cpulist", node);
+        FILE *f = fopen(path, "r");
+        if (f == nullptr) {
+            break;
+        }
+        char line[512];
+        const bool got_line = (fgets(line, sizeof(line), f) != nullptr);
+        fclose(f);
+        if (!got_line) {
+            return std::vector<int>();
+        }
+        // The cpulist format is comma-separated ranges, e.g. "0-7,16-23".
+        const char *p = line;
+        while (*p != '\0' && *p != '\n') {
+            char *end;
+            const long first = strtol(p, &end, 10);
+            if (end == p) {
+                return std::vector<int>();
+            }
+            long last = first;
+            if (*end == '-') {
+                p = end + 1;
+                last = strtol(p, &end, 10);
+                if (end == p) {
+                    return std::vector<int>();
+                }
+            }
+            for (long cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(static_cast<int>(cpu));
+            }
+            p = end;
+            if (*p == ',') {
+                ++p;
+            }
+        }
+    }
+    return cpus;
+}
+#endif  // _GNU_SOURCE
 THREAD_LOCAL linux_thread_t *linux_thread_pool_t::thread = nullptr;
 
 linux_thread_pool_t *linux_thread_pool_t::get_thread_pool() {
@@ -215,6 +272,10 @@ void linux_thread_pool_t::run_thread_pool(linux_thread_message_t *initial_messag
     // Start child threads
     thread_barrier_t barrier(n_threads + 1);
 
+#ifdef _GNU_SOURCE
+    const std::vector<int> numa_cpu_order = cpus_grouped_by_numa_node();
+#endif
+
     for (int i = 0; i < n_threads; i++) {
         bool is_utility_thread = (i == n_threads - 1);
         thread_data_t *tdata = new thread_data_t();
@@ -231,11 +292,17 @@ void linux_thread_pool_t::run_thread_pool(linux_thread_message_t *initial_messag
         if (do_set_affinity && !is_utility_thread) {
             // On Apple, the thread affinity API has awful documentation, so we don't even bother.
 #ifdef _GNU_SOURCE
-            // Distribute threads evenly among CPUs
-            int ncpus = get_cpu_count();
+            // Distribute threads evenly among CPUs, walking one NUMA node's
+            // CPUs at a time if we know the topology.
+            int cpu;
+            if (!numa_cpu_order.empty()) {
+                cpu = numa_cpu_order[i % numa_cpu_order.size()];
+            } else {
+                cpu = i % get_cpu_count();
+            }
             cpu_set_t mask;
             CPU_ZERO(&mask);
-            CPU_SET(i % ncpus, &mask);
+            CPU_SET(cpu, &mask);
             res = pthread_setaffinity_np(pthreads[i], sizeof(cpu_set_t), &mask);
             guarantee_xerr(res == 0, res, "Could not set thread affinity");
 #endif
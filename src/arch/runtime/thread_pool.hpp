@@ -37,7 +37,15 @@ struct coro_runtime_t {
 
 /* A thread pool represents a group of threads, each of which is associated with an
 event queue. There is one thread pool per server. It is responsible for starting up
-and shutting down the threads and event queues. */
+and shutting down the threads and event queues.
+
+Coroutines are deliberately pinned to threads; there is no work stealing.
+Almost every heap structure in the server (datums, btree buffers, perfmon
+membership, ...) relies on single-threaded reference counting and thread-local
+state, which is what lets the hot paths run without atomic operations or locks.
+Load is spread across cores one level up instead: each table shard is hash-split
+into CPU_SHARDING_FACTOR stores with different home threads, so a hot key range
+occupies several cores rather than one. */
 
 class linux_thread_pool_t {
 public:
@@ -3,17 +3,20 @@
 
 #include <algorithm>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 #include "arch/runtime/thread_pool.hpp"
 #include "time.hpp"
 #include "utils.hpp"
 
-class timer_token_t : public intrusive_priority_queue_node_t<timer_token_t> {
+class timer_token_t : public intrusive_list_node_t<timer_token_t> {
     friend class timer_handler_t;
 
 private:
-    timer_token_t() : interval_nanos(-1), next_time_in_nanos(-1), callback(nullptr) { }
-
-    friend bool left_is_higher_priority(const timer_token_t *left, const timer_token_t *right);
+    timer_token_t() : interval_nanos(-1), next_time_in_nanos(-1),
+                      wheel_level(-1), wheel_slot(-1), callback(nullptr) { }
 
     // The time between rings, if a repeating timer, otherwise zero.
     int64_t interval_nanos;
@@ -21,54 +24,197 @@ private:
     // The time of the next 'ring'.
     int64_t next_time_in_nanos;
 
+    // Which wheel slot the token currently sits in.
+    int wheel_level;
+    int wheel_slot;
+
     // The callback we call upon each 'ring'.
     timer_callback_t *callback;
 
     DISABLE_COPYING(timer_token_t);
 };
 
-bool left_is_higher_priority(const timer_token_t *left, const timer_token_t *right) {
-    return left->next_time_in_nanos < right->next_time_in_nanos;
+// Returns the index of the lowest set bit of `x`, which must be nonzero.
+static int lowest_set_bit(uint64_t x) {
+    rassert(x != 0);
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(x);
+#endif
 }
 
 timer_handler_t::timer_handler_t(linux_event_queue_t *queue)
     : timer_provider(queue),
-      expected_oneshot_time_in_nanos(0) {
-    // Right now, we have no tokens.  So we don't ask the timer provider to do anything for us.
+      expected_oneshot_time_in_nanos(0),
+      wheel_tick_(get_ticks().nanos / TIMER_WHEEL_SLOT_NANOS),
+      oneshot_scheduled_at_tick_(-1) {
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        wheel_occupancy_[level] = 0;
+    }
 }
 
 timer_handler_t::~timer_handler_t() {
-    guarantee(token_queue.empty());
+    guarantee(wheel_is_empty());
+}
+
+bool timer_handler_t::wheel_is_empty() const {
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        if (wheel_occupancy_[level] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void timer_handler_t::insert_into_wheel(timer_token_t *token) {
+    // The tick at which the token must ring: the first slot boundary at or
+    // after its deadline, so that timers never ring early.
+    int64_t deadline_tick =
+        (token->next_time_in_nanos + TIMER_WHEEL_SLOT_NANOS - 1)
+        / TIMER_WHEEL_SLOT_NANOS;
+    if (deadline_tick < wheel_tick_) {
+        // Overdue timers go into the wheel's current slot and ring at the next
+        // opportunity.
+        deadline_tick = wheel_tick_;
+    }
+
+    // Find the lowest level at which the deadline falls within one revolution
+    // ahead of the wheel's current position.  (At that level the token's slot
+    // is strictly ahead of the current slot, except for overdue timers, which
+    // end up in level 0's current slot.)
+    int level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1
+           && (deadline_tick >> (TIMER_WHEEL_SLOTS_LOG2 * level))
+                  - (wheel_tick_ >> (TIMER_WHEEL_SLOTS_LOG2 * level))
+              >= TIMER_WHEEL_SLOTS_PER_LEVEL) {
+        ++level;
+    }
+
+    const int shift = TIMER_WHEEL_SLOTS_LOG2 * level;
+    int64_t slot_quot = deadline_tick >> shift;
+    if (slot_quot - (wheel_tick_ >> shift) >= TIMER_WHEEL_SLOTS_PER_LEVEL) {
+        // The deadline is beyond even the top level's range.  Park the token in
+        // the slot just behind the current one; when the wheel gets there it
+        // re-inserts the token for another lap.
+        slot_quot = (wheel_tick_ >> shift) + TIMER_WHEEL_SLOTS_PER_LEVEL - 1;
+    }
+    const int slot = slot_quot & (TIMER_WHEEL_SLOTS_PER_LEVEL - 1);
+
+    token->wheel_level = level;
+    token->wheel_slot = slot;
+    wheel_slots_[level][slot].push_back(token);
+    wheel_occupancy_[level] |= uint64_t(1) << slot;
+}
+
+void timer_handler_t::remove_from_wheel(timer_token_t *token) {
+    rassert(token->wheel_level >= 0);
+    wheel_slots_[token->wheel_level][token->wheel_slot].remove(token);
+    if (wheel_slots_[token->wheel_level][token->wheel_slot].empty()) {
+        wheel_occupancy_[token->wheel_level] &=
+            ~(uint64_t(1) << token->wheel_slot);
+    }
+    token->wheel_level = -1;
+    token->wheel_slot = -1;
+}
+
+bool timer_handler_t::next_pending_tick(int64_t *tick_out) const {
+    bool found = false;
+    int64_t best = 0;
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        const uint64_t occupancy = wheel_occupancy_[level];
+        if (occupancy == 0) {
+            continue;
+        }
+        const int shift = TIMER_WHEEL_SLOTS_LOG2 * level;
+        const int64_t cursor_quot = wheel_tick_ >> shift;
+        const int cursor = cursor_quot & (TIMER_WHEEL_SLOTS_PER_LEVEL - 1);
+
+        // The next occupied slot at or ahead of the cursor, wrapping around to
+        // the next revolution if there is none.
+        const uint64_t at_or_ahead = occupancy & (~uint64_t(0) << cursor);
+        int64_t slot_quot;
+        if (at_or_ahead != 0) {
+            slot_quot = cursor_quot - cursor + lowest_set_bit(at_or_ahead);
+        } else {
+            slot_quot = cursor_quot - cursor + TIMER_WHEEL_SLOTS_PER_LEVEL
+                + lowest_set_bit(occupancy);
+        }
+
+        const int64_t tick = std::max(wheel_tick_, slot_quot << shift);
+        if (!found || tick < best) {
+            found = true;
+            best = tick;
+        }
+    }
+    if (found) {
+        *tick_out = best;
+    }
+    return found;
 }
 
 void timer_handler_t::on_oneshot() {
+    oneshot_scheduled_at_tick_ = -1;
+
     // If the timer_provider tends to return its callback a touch early, we don't want to make a
     // bunch of calls to it, returning a tad early over and over again, leading up to a ticks
-    // threshold.  So we bump the real time up to the threshold when processing the priority queue.
+    // threshold.  So we bump the real time up to the threshold when processing the wheel.
     int64_t real_ticks = get_ticks().nanos;
     int64_t ticks = std::max(real_ticks, expected_oneshot_time_in_nanos);
+    const int64_t target_tick = ticks / TIMER_WHEEL_SLOT_NANOS;
 
-    while (!token_queue.empty() && token_queue.peek()->next_time_in_nanos <= ticks) {
-        timer_token_t *token = token_queue.pop();
+    int64_t pending_tick;
+    while (next_pending_tick(&pending_tick) && pending_tick <= target_tick) {
+        wheel_tick_ = pending_tick;
 
-        // Put the repeating timer back on the queue before the callback can be called (so that it
-        // may be canceled).
-        if (token->interval_nanos != 0) {
-            token->next_time_in_nanos = real_ticks + token->interval_nanos;
-            token_queue.push(token);
+        // Cascade every higher-level slot whose boundary we have just reached
+        // down into the finer-grained levels below it.
+        for (int level = TIMER_WHEEL_LEVELS - 1; level >= 1; --level) {
+            const int shift = TIMER_WHEEL_SLOTS_LOG2 * level;
+            if ((wheel_tick_ & ((int64_t(1) << shift) - 1)) != 0) {
+                continue;
+            }
+            const int slot = (wheel_tick_ >> shift)
+                & (TIMER_WHEEL_SLOTS_PER_LEVEL - 1);
+            if ((wheel_occupancy_[level] & (uint64_t(1) << slot)) == 0) {
+                continue;
+            }
+            intrusive_list_t<timer_token_t> *list = &wheel_slots_[level][slot];
+            while (timer_token_t *token = list->head()) {
+                remove_from_wheel(token);
+                insert_into_wheel(token);
+            }
         }
 
-        token->callback->on_timer(ticks_t{real_ticks});
+        // Ring the level 0 slot we have arrived at.
+        const int slot = wheel_tick_ & (TIMER_WHEEL_SLOTS_PER_LEVEL - 1);
+        intrusive_list_t<timer_token_t> *list = &wheel_slots_[0][slot];
+        while (timer_token_t *token = list->head()) {
+            remove_from_wheel(token);
+
+            // Put the repeating timer back on the wheel before the callback can be
+            // called (so that it may be canceled).  Its next ring is at least one
+            // slot ahead of `target_tick`, so it cannot ring again in this pass.
+            if (token->interval_nanos != 0) {
+                token->next_time_in_nanos = real_ticks + token->interval_nanos;
+                insert_into_wheel(token);
+            }
+
+            token->callback->on_timer(ticks_t{real_ticks});
 
-        // Delete nonrepeating timer tokens.
-        if (token->interval_nanos == 0) {
-            delete token;
+            // Delete nonrepeating timer tokens.
+            if (token->interval_nanos == 0) {
+                delete token;
+            }
         }
     }
 
     // We've processed young tokens.  Now schedule a new one-shot (if necessary).
-    if (!token_queue.empty()) {
-        timer_provider.schedule_oneshot(token_queue.peek()->next_time_in_nanos, this);
+    if (next_pending_tick(&pending_tick)) {
+        timer_provider.schedule_oneshot(pending_tick * TIMER_WHEEL_SLOT_NANOS, this);
+        oneshot_scheduled_at_tick_ = pending_tick;
     }
 }
 
@@ -83,22 +229,27 @@ timer_token_t *timer_handler_t::add_timer_internal(
     token->next_time_in_nanos = next_time.nanos;
     token->callback = callback;
 
-    const timer_token_t *top_entry = token_queue.peek();
-    token_queue.push(token);
+    insert_into_wheel(token);
 
-    if (top_entry == nullptr || next_time.nanos < top_entry->next_time_in_nanos) {
-        timer_provider.schedule_oneshot(next_time.nanos, this);
+    int64_t pending_tick;
+    const bool have_pending = next_pending_tick(&pending_tick);
+    guarantee(have_pending);
+    if (oneshot_scheduled_at_tick_ == -1
+        || pending_tick < oneshot_scheduled_at_tick_) {
+        timer_provider.schedule_oneshot(pending_tick * TIMER_WHEEL_SLOT_NANOS, this);
+        oneshot_scheduled_at_tick_ = pending_tick;
     }
 
     return token;
 }
 
 void timer_handler_t::cancel_timer(timer_token_t *token) {
-    token_queue.remove(token);
+    remove_from_wheel(token);
     delete token;
 
-    if (token_queue.empty()) {
+    if (wheel_is_empty()) {
         timer_provider.unschedule_oneshot();
+        oneshot_scheduled_at_tick_ = -1;
     }
 }
 
@@ -3,7 +3,7 @@
 #define ARCH_TIMER_HPP_
 
 #include "arch/io/timer_provider.hpp"
-#include "containers/intrusive_priority_queue.hpp"
+#include "containers/intrusive_list.hpp"
 #include "time.hpp"
 
 class timer_token_t;
@@ -30,8 +30,27 @@ public:
     void cancel_timer(timer_token_t *timer);
 
 private:
+    // The timer wheel's geometry: each level has 64 slots, level 0 slots are one
+    // millisecond wide, and each level above covers 64 times the span of the one
+    // below it (so the six levels together span about two years; timers further
+    // out than that park in the top level and take an extra lap).
+    static const int TIMER_WHEEL_SLOTS_LOG2 = 6;
+    static const int TIMER_WHEEL_SLOTS_PER_LEVEL = 1 << TIMER_WHEEL_SLOTS_LOG2;
+    static const int TIMER_WHEEL_LEVELS = 6;
+    static const int64_t TIMER_WHEEL_SLOT_NANOS = 1000 * 1000;
+
     void on_oneshot();
 
+    // Puts the token into the wheel slot appropriate for its deadline, relative
+    // to the wheel's current position.
+    void insert_into_wheel(timer_token_t *token);
+    void remove_from_wheel(timer_token_t *token);
+    bool wheel_is_empty() const;
+
+    // Sets *tick_out to the next level 0 tick at which some wheel slot needs to
+    // be fired or cascaded.  Returns false if the wheel is empty.
+    bool next_pending_tick(int64_t *tick_out) const;
+
     // The timer provider, a platform-dependent typedef for interfacing with the OS.
     timer_provider_t timer_provider;
 
@@ -39,8 +58,22 @@ private:
     // than this time, we pretend that it had arrived on time.
     int64_t expected_oneshot_time_in_nanos;
 
-    // A priority queue of timer tokens, ordered by the soonest.
-    intrusive_priority_queue_t<timer_token_t> token_queue;
+    // A hierarchical timer wheel of timer tokens.  Insertion and cancellation
+    // are O(1); expiry work is proportional to the number of timers that are
+    // actually due (plus an occasional cascade of a higher-level slot).
+    intrusive_list_t<timer_token_t>
+        wheel_slots_[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS_PER_LEVEL];
+
+    // One bit per slot of each level, set iff the slot's list is non-empty.
+    uint64_t wheel_occupancy_[TIMER_WHEEL_LEVELS];
+
+    // The wheel's current position, in units of TIMER_WHEEL_SLOT_NANOS.  Only
+    // moves forward, inside `on_oneshot()`.
+    int64_t wheel_tick_;
+
+    // The tick for which we last asked the timer provider for a oneshot, or -1
+    // if we don't have one scheduled.
+    int64_t oneshot_scheduled_at_tick_;
 
     DISABLE_COPYING(timer_handler_t);
 };
@@ -653,6 +653,12 @@ private:
     backfill_item_memory_tracker_t *memory_tracker;
 };
 
+/* Although this starts a traversal over the whole `range`, it doesn't visit most of it
+when the replica was only briefly out of date. Internal nodes carry a recency timestamp
+per child block, so `filter_range_ts()` prunes every subtree whose most recent change is
+at or before `reference_timestamp` (unless a pre-item forces us into it). Those per-block
+recencies are our persistent changed-block map; only changed subtrees and leaves whose
+deletion history has been garbage-collected get read. */
 continue_bool_t btree_send_backfill(
         superblock_t *superblock,
         release_superblock_t release_superblock,
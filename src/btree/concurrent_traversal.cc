@@ -82,6 +82,11 @@ public:
     }
 
     virtual continue_bool_t handle_pair(scoped_key_value_t &&keyvalue, signal_t *) {
+        if (!cb_->is_key_interesting(keyvalue.key())) {
+            return failure_cond_->is_pulsed()
+                ? continue_bool_t::ABORT : continue_bool_t::CONTINUE;
+        }
+
         // First thing first: Get in line with the token enforcer.
 
         fifo_enforcer_write_token_t token = source_.enter_write();
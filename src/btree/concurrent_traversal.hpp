@@ -44,6 +44,14 @@ public:
         *skip_out = false;
     }
 
+    /* Called synchronously for every pair before a coroutine gets spawned for
+    `handle_pair()`.  Returning `false` drops the pair without paying for the
+    coroutine spawn or a trip through the fifo enforcer.  Implementations must
+    be cheap and must not block. */
+    virtual bool is_key_interesting(UNUSED const btree_key_t *key) {
+        return true;
+    }
+
     // Passes a keyvalue and a callback.  waiter.wait_interruptible() must be called to
     // begin the region of "exclusive access", which only handle_pair implementation
     // can enters at a time.  (This should happen after loading the value from disk
@@ -7,6 +7,11 @@
 #include "concurrency/interruptor.hpp"
 #include "rdb_protocol/profile.hpp"
 
+// How many sibling subtrees' root blocks we acquire (and thereby start
+// reading from disk) ahead of the subtree we're currently descending into.
+// Emission order is unaffected; this only overlaps the disk reads.
+static const size_t DEPTH_FIRST_TRAVERSAL_LOOKAHEAD = 4;
+
 scoped_key_value_t::scoped_key_value_t(const btree_key_t *_key,
                                        const void *_value,
                                        movable_t<counted_buf_lock_and_read_t> &&buf)
@@ -181,6 +186,19 @@ continue_bool_t btree_depth_first_traversal(
             r.decrement();
             end_index = internal_node::get_offset_index(inode, r.btree_key()) + 1;
         }
+
+        // Collect the children we're going to visit, in visit order.  The
+        // range filters run up front, which is within their contract (they
+        // are promised to be called before traversing into any child).  The
+        // key pointers stay valid because we hold `block`'s lock for the
+        // whole loop below.
+        struct child_t {
+            counted_t<counted_buf_lock_and_read_t> lock;
+            block_id_t block_id;
+            const btree_key_t *left_excl_or_null;
+            const btree_key_t *right_incl;
+        };
+        std::vector<child_t> children;
         for (int i = 0; i < end_index - start_index; ++i) {
             int true_index = (direction == FORWARD ? start_index + i : (end_index - 1) - i);
             const btree_internal_pair *pair = internal_node::get_pair_by_index(inode, true_index);
@@ -197,22 +215,42 @@ continue_bool_t btree_depth_first_traversal(
                 return continue_bool_t::ABORT;
             }
             if (!skip) {
-                counted_t<counted_buf_lock_and_read_t> lock;
-                {
-                    PROFILE_STARTER_IF_ENABLED(
-                        cb->get_trace() != nullptr,
-                        "Acquire block for read.",
-                        cb->get_trace());
-                    lock = make_counted<counted_buf_lock_and_read_t>(
-                        &block->lock, pair->lnode, access);
-                    wait_interruptible(lock->lock.read_acq_signal(), interruptor);
-                }
-                if (continue_bool_t::ABORT == btree_depth_first_traversal(
-                        std::move(lock), range, cb, access, direction,
-                        child_left_excl_or_null, child_right_incl, interruptor)) {
-                    return continue_bool_t::ABORT;
+                child_t child;
+                child.block_id = pair->lnode;
+                child.left_excl_or_null = child_left_excl_or_null;
+                child.right_incl = child_right_incl;
+                children.push_back(std::move(child));
+            }
+        }
+
+        // Visit the children strictly in order, but start the block
+        // acquisitions (and hence the disk reads) up to
+        // DEPTH_FIRST_TRAVERSAL_LOOKAHEAD children ahead of the one we're
+        // descending into, so that a scan keeps more than one read in
+        // flight per level.
+        for (size_t i = 0; i < children.size(); ++i) {
+            for (size_t j = i;
+                 j < children.size() && j <= i + DEPTH_FIRST_TRAVERSAL_LOOKAHEAD;
+                 ++j) {
+                if (!children[j].lock.has()) {
+                    children[j].lock = make_counted<counted_buf_lock_and_read_t>(
+                        &block->lock, children[j].block_id, access);
                 }
             }
+            {
+                PROFILE_STARTER_IF_ENABLED(
+                    cb->get_trace() != nullptr,
+                    "Acquire block for read.",
+                    cb->get_trace());
+                wait_interruptible(children[i].lock->lock.read_acq_signal(),
+                                   interruptor);
+            }
+            if (continue_bool_t::ABORT == btree_depth_first_traversal(
+                    std::move(children[i].lock), range, cb, access, direction,
+                    children[i].left_excl_or_null, children[i].right_incl,
+                    interruptor)) {
+                return continue_bool_t::ABORT;
+            }
         }
         return continue_bool_t::CONTINUE;
     } else {
@@ -8,6 +8,17 @@
 #include "buffer_cache/alt.hpp"
 #include "utils.hpp"
 
+/* A note on cost, because "distribution read" sounds like a table scan: it
+isn't one.  The total key count comes from the stat block, a persistent
+counter maintained on every write, and the split-point candidates are the
+boundary keys of internal nodes down to `depth_limit` -- the rebalancer asks
+for depth 2 (see split_points.cc), so the traversal touches O(fanout^2)
+blocks regardless of table size and only ever reaches leaves on trees shallow
+enough to fit inside the limit.  Boundary keys of a balanced btree are
+already an approximately evenly-weighted sample of the keyspace, which is the
+same thing a write-maintained reservoir sample would give us; per-subtree
+persistent counts would buy more accuracy per bucket, but they'd be an
+on-disk change to the internal node format. */
 class get_distribution_traversal_helper_t : public btree_traversal_helper_t, public home_thread_mixin_debug_only_t {
 public:
     get_distribution_traversal_helper_t(int _depth_limit, std::vector<store_key_t> *_keys)
@@ -357,7 +357,29 @@ btree_internal_pair *get_pair_by_index(internal_node_t *node, int index) {
 }
 
 int get_offset_index(const internal_node_t *node, const btree_key_t *key) {
-    return std::lower_bound(node->pair_offsets, node->pair_offsets+node->npairs-1, (uint16_t) internal_key_comp::faux_offset, internal_key_comp(node, key)) - node->pair_offsets;
+    // A hand-rolled lower_bound.  The pair offsets are contiguous, but the
+    // keys they point at are scattered through the block, so every probe's
+    // comparison is a dependent cache miss.  Before comparing the current
+    // probe's key we issue prefetches for the keys at both possible next
+    // probes, overlapping their misses with the current one.  Every read in
+    // the system passes through this search once per tree level.
+    int beg = 0;
+    int end = node->npairs - 1;
+    while (beg < end) {
+        const int test_point = beg + (end - beg) / 2;
+        // The next probe is the midpoint of either [beg, test_point) or
+        // [test_point + 1, end).
+        PREFETCH_READ(get_pair_by_index(node, beg + (test_point - beg) / 2));
+        PREFETCH_READ(get_pair_by_index(
+            node, test_point + 1 + (end - test_point - 1) / 2));
+        const btree_key_t *ek = &get_pair_by_index(node, test_point)->key;
+        if (btree_key_cmp(ek, key) < 0) {
+            beg = test_point + 1;
+        } else {
+            end = test_point;
+        }
+    }
+    return beg;
 }
 
 int nodecmp(const internal_node_t *node1, const internal_node_t *node2) {
@@ -1177,6 +1177,23 @@ bool is_mergable(value_sizer_t *sizer, const leaf_node_t *node, const leaf_node_
     return is_underfull(sizer, node) && is_underfull(sizer, sibling);
 }
 
+// Compares `key` against `ek`, skipping the first `skip` bytes, which the
+// caller knows to be equal in both keys.  Sets `*lcp_out` to the length of
+// the longest common prefix of the two keys (always >= skip).
+int key_cmp_skip_prefix(const btree_key_t *key, const btree_key_t *ek,
+                        int skip, int *lcp_out) {
+    const int min_len = std::min<int>(key->size, ek->size);
+    int i = skip;
+    while (i < min_len && key->contents[i] == ek->contents[i]) {
+        ++i;
+    }
+    *lcp_out = i;
+    if (i == min_len) {
+        return key->size - ek->size;
+    }
+    return key->contents[i] < ek->contents[i] ? -1 : 1;
+}
+
 // Sets *index_out to the index for the live entry or deletion entry
 // for the key, or to the index the key would have if it were
 // inserted.  Returns true if the key at said index is actually equal.
@@ -1187,20 +1204,32 @@ bool find_key(const leaf_node_t *node, const btree_key_t *key, int *index_out) {
     // beg == 0 or key > *(beg - 1).
     // end == num_pairs or key < *end.
 
+    // Lengths of the longest common prefix of `key` with *(beg - 1) and with
+    // *end.  The entries are sorted, so every entry in [beg, end) shares at
+    // least min(beg_lcp, end_lcp) leading bytes with `key`, and comparisons
+    // may skip those bytes.  Keys that share long prefixes (uuid- or
+    // time-prefixed primary keys) otherwise spend most of every comparison
+    // rescanning the shared region.
+    int beg_lcp = 0;
+    int end_lcp = 0;
+
     while (beg < end) {
         // when (end - beg) > 0, (end - beg) / 2 is always less than (end - beg).  So beg <= test_point < end.
         int test_point = beg + (end - beg) / 2;
 
         const btree_key_t *ek = entry_key(get_entry(node, node->pair_offsets[test_point]));
 
-        int res = btree_key_cmp(key, ek);
+        int lcp;
+        int res = key_cmp_skip_prefix(key, ek, std::min(beg_lcp, end_lcp), &lcp);
 
         if (res < 0) {
             // key < *test_point.
             end = test_point;
+            end_lcp = lcp;
         } else if (res > 0) {
             // key > *test_point.  Since test_point < end, we have test_point + 1 <= end.
             beg = test_point + 1;
+            beg_lcp = lcp;
         } else {
             // We found the key!
             *index_out = test_point;
@@ -1215,13 +1244,17 @@ bool find_key(const leaf_node_t *node, const btree_key_t *key, int *index_out) {
     return false;
 }
 
-bool lookup(value_sizer_t *sizer, const leaf_node_t *node, const btree_key_t *key, void *value_out) {
+bool lookup(value_sizer_t *sizer, const leaf_node_t *node, const btree_key_t *key,
+            scoped_malloc_t<void> *value_out) {
     int index;
     if (find_key(node, key, &index)) {
         const entry_t *ent = get_entry(node, node->pair_offsets[index]);
         if (entry_is_live(ent)) {
             const void *val = entry_value(ent);
-            memcpy(value_out, val, sizer->size(val));
+            const int size = sizer->size(val);
+            scoped_malloc_t<void> value(size);
+            memcpy(value.get(), val, size);
+            *value_out = std::move(value);
             return true;
         }
     }
@@ -1724,6 +1757,14 @@ iterator &iterator::operator++() {
               "Trying to increment past the end of an iterator.");
     do {
         ++index_;
+        // The pair offsets are contiguous but the entries they point at are
+        // scattered through the block, so each step's liveness check is a
+        // dependent cache miss.  Warm the following entry while the caller
+        // is still working on this one; range reads walk every pair through
+        // this loop.
+        if (index_ + 1 < node_->num_pairs) {
+            PREFETCH_READ(get_entry(node_, node_->pair_offsets[index_ + 1]));
+        }
     } while (index_ < node_->num_pairs && !entry_is_live(get_entry(node_, node_->pair_offsets[index_])));
     return *this;
 }
@@ -1732,6 +1773,9 @@ iterator &iterator::operator--() {
     guarantee(index_ > -1, "Trying to decrement past the beginning of an iterator.");
     do {
         --index_;
+        if (index_ - 1 >= 0) {
+            PREFETCH_READ(get_entry(node_, node_->pair_offsets[index_ - 1]));
+        }
     } while (index_ >= 0 && !entry_is_live(get_entry(node_, node_->pair_offsets[index_])));
     return *this;
 }
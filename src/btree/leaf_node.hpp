@@ -10,6 +10,7 @@
 #include "btree/types.hpp"
 #include "buffer_cache/types.hpp"
 #include "containers/optional.hpp"
+#include "containers/scoped.hpp"
 
 class value_sizer_t;
 struct btree_key_t;
@@ -126,7 +127,12 @@ bool is_mergable(value_sizer_t *sizer, const leaf_node_t *node, const leaf_node_
 
 bool find_key(const leaf_node_t *node, const btree_key_t *key, int *index_out);
 
-bool lookup(value_sizer_t *sizer, const leaf_node_t *node, const btree_key_t *key, void *value_out);
+// On a hit, allocates a buffer of exactly the value's size into `*value_out`
+// and copies the value into it.  On a miss, returns false without allocating
+// anything -- point lookups for absent keys are common, and they used to pay
+// a `max_possible_size()` allocation just to throw it away.
+bool lookup(value_sizer_t *sizer, const leaf_node_t *node, const btree_key_t *key,
+            scoped_malloc_t<void> *value_out);
 
 void insert(
         value_sizer_t *sizer,
@@ -438,12 +438,22 @@ void find_keyvalue_location_for_write(
         // isn't strictly necessary, but it makes the timestamps slightly tighter.
         buf.set_recency(superceding_recency(buf.get_recency(), timestamp));
 
-        // Look up and acquire the next node.
+        // Look up and acquire the next node.  While we're at it, remember the
+        // separator we descend through; it bounds the keys of the leaf we'll
+        // end up at.  (It may become conservative if the child gets leveled
+        // with a sibling further down, but it never becomes too loose.)
         block_id_t node_id;
         {
             buf_read_t read(&buf);
             auto node = static_cast<const internal_node_t *>(read.get_data_read());
-            node_id = internal_node::lookup(node, key);
+            const int index = internal_node::get_offset_index(node, key);
+            const btree_internal_pair *pair
+                = internal_node::get_pair_by_index(node, index);
+            if (index < node->npairs - 1) {
+                keyvalue_location_out->upper_bound
+                    = make_optional(store_key_t(&pair->key));
+            }
+            node_id = pair->lnode;
         }
         rassert(node_id != NULL_BLOCK_ID && node_id != SUPERBLOCK_ID);
 
@@ -457,12 +467,13 @@ void find_keyvalue_location_for_write(
     }
 
     {
-        scoped_malloc_t<void> tmp(sizer->max_possible_size());
-
         // We've gone down the tree and gotten to a leaf. Now look up the key.
+        // `leaf::lookup` only allocates on a hit, so a lookup for an absent
+        // key doesn't touch the heap.
+        scoped_malloc_t<void> tmp;
         buf_read_t read(&buf);
         auto node = static_cast<const leaf_node_t *>(read.get_data_read());
-        bool key_found = leaf::lookup(sizer, node, key, tmp.get());
+        bool key_found = leaf::lookup(sizer, node, key, &tmp);
 
         if (key_found) {
             keyvalue_location_out->there_originally_was_value = true;
@@ -537,14 +548,16 @@ void find_keyvalue_location_for_read(
 #endif  // NDEBUG
     }
 
-    // Got down to the leaf, now probe it.
-    scoped_malloc_t<void> value(sizer->max_possible_size());
+    // Got down to the leaf, now probe it.  `leaf::lookup` only allocates on a
+    // hit; most point reads for absent keys end right here, and they used to
+    // pay a `max_possible_size()` allocation for nothing.
+    scoped_malloc_t<void> value;
     bool value_found;
     {
         buf_read_t read(&buf);
         const leaf_node_t *leaf
             = static_cast<const leaf_node_t *>(read.get_data_read());
-        value_found = leaf::lookup(sizer, leaf, key, value.get());
+        value_found = leaf::lookup(sizer, leaf, key, &value);
     }
     if (value_found) {
         keyvalue_location_out->buf = std::move(buf);
@@ -663,3 +676,96 @@ void apply_keyvalue_change(
         stat_block_buf->population += population_change;
     }
 }
+
+void apply_sorted_keyvalue_inserts(
+        value_sizer_t *sizer,
+        superblock_t *superblock,
+        const std::vector<std::pair<const btree_key_t *, const void *> > &kvs,
+        repli_timestamp_t tstamp,
+        const value_deleter_t *balancing_detacher) {
+    size_t i = 0;
+    while (i < kvs.size()) {
+        promise_t<superblock_t *> return_superblock;
+        {
+            keyvalue_location_t kv_loc;
+            find_keyvalue_location_for_write(sizer, superblock, kvs[i].first,
+                                             tstamp, balancing_detacher,
+                                             &kv_loc, nullptr,
+                                             &return_superblock);
+            guarantee(!kv_loc.there_originally_was_value,
+                      "apply_sorted_keyvalue_inserts encountered a key that "
+                      "was already present");
+
+            // Make room for the first key of the run.  After a split `buf` is
+            // the side the key belongs on, but `upper_bound` may now be looser
+            // than the leaf's true range, so we insert just this one key and
+            // descend again.
+            bool split_happened = false;
+            {
+                buf_read_t read(&kv_loc.buf);
+                auto leaf = static_cast<const leaf_node_t *>(read.get_data_read());
+                split_happened = leaf::is_full(sizer, leaf, kvs[i].first,
+                                               kvs[i].second);
+            }
+            if (split_happened) {
+                check_and_handle_split(sizer, &kv_loc.buf, &kv_loc.last_buf,
+                                       kv_loc.superblock, kvs[i].first,
+                                       const_cast<void *>(kvs[i].second),
+                                       balancing_detacher);
+            }
+
+            int64_t population_change = 0;
+            for (;;) {
+                const repli_timestamp_t previous_leaf_recency
+                    = kv_loc.buf.get_recency();
+                kv_loc.buf.set_recency(superceding_recency(
+                    tstamp, previous_leaf_recency));
+                {
+                    buf_write_t write(&kv_loc.buf);
+                    auto leaf = static_cast<leaf_node_t *>(write.get_data_write());
+#ifndef NDEBUG
+                    int index;
+                    rassert(!leaf::find_key(leaf, kvs[i].first, &index),
+                            "apply_sorted_keyvalue_inserts encountered a key "
+                            "that was already present");
+#endif
+                    leaf::insert(sizer, leaf, kvs[i].first, kvs[i].second,
+                                 tstamp, previous_leaf_recency);
+                }
+                ++population_change;
+                ++i;
+
+                if (i == kvs.size() || split_happened) {
+                    break;
+                }
+                rassert(btree_key_cmp(kvs[i - 1].first, kvs[i].first) < 0,
+                        "apply_sorted_keyvalue_inserts requires strictly "
+                        "ascending keys");
+                // The next key stays in this run only if it belongs to this
+                // leaf and fits without a split.
+                if (kv_loc.upper_bound.has_value()
+                    && btree_key_cmp(kvs[i].first,
+                                     kv_loc.upper_bound->btree_key()) > 0) {
+                    break;
+                }
+                buf_read_t read(&kv_loc.buf);
+                auto leaf = static_cast<const leaf_node_t *>(read.get_data_read());
+                if (leaf::is_full(sizer, leaf, kvs[i].first, kvs[i].second)) {
+                    break;
+                }
+            }
+
+            // One stat block update per run rather than per key.
+            if (kv_loc.stat_block != NULL_BLOCK_ID) {
+                buf_lock_t stat_block(buf_parent_t(kv_loc.buf.txn()),
+                                      kv_loc.stat_block, access_t::write);
+                buf_write_t stat_block_write(&stat_block);
+                auto stat_block_buf = static_cast<btree_statblock_t *>(
+                        stat_block_write.get_data_write(BTREE_STATBLOCK_SIZE));
+                stat_block_buf->population += population_change;
+            }
+        }
+        superblock = return_superblock.wait();
+    }
+    superblock->release();
+}
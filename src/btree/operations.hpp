@@ -13,6 +13,7 @@
 #include "concurrency/new_semaphore.hpp"
 #include "concurrency/promise.hpp"
 #include "containers/archive/stl_types.hpp"
+#include "containers/optional.hpp"
 #include "containers/scoped.hpp"
 #include "perfmon/perfmon.hpp"
 #include "repli_timestamp.hpp"
@@ -89,6 +90,14 @@ public:
     // value, otherwise NULL.
     scoped_malloc_t<void> value;
 
+    // An inclusive upper bound on the keys that belong in `buf`'s leaf, taken
+    // from the internal node separators passed on the way down (empty if the
+    // leaf is on the rightmost path).  The bound may be tighter than the
+    // leaf's true range, but never looser.  `apply_sorted_keyvalue_inserts()`
+    // uses it to tell that a subsequent sorted key lands in the same leaf
+    // without descending from the root again.
+    optional<store_key_t> upper_bound;
+
     template <class T>
     T *value_as() { return static_cast<T *>(value.get()); }
 
@@ -168,4 +177,17 @@ void apply_keyvalue_change(
         const value_deleter_t *balancing_detacher,
         delete_mode_t delete_mode);
 
+/* Inserts a run of strictly ascending keys that are not already present in
+the tree (not even as tombstones).  Descends from the root once per leaf
+instead of once per key: after locating the leaf for the first key of a run,
+subsequent keys are appended directly for as long as they fall within the
+leaf's range and fit without a split.  Sorted bulk imports are the intended
+caller.  Releases `superblock` before returning. */
+void apply_sorted_keyvalue_inserts(
+        value_sizer_t *sizer,
+        superblock_t *superblock,
+        const std::vector<std::pair<const btree_key_t *, const void *> > &kvs,
+        repli_timestamp_t tstamp,
+        const value_deleter_t *balancing_detacher);
+
 #endif  // BTREE_OPERATIONS_HPP_
@@ -130,6 +130,11 @@ block_id_t sindex_superblock_t::get_sindex_block_id() {
 // Run backfilling at a reduced priority
 #define BACKFILL_CACHE_PRIORITY 10
 
+// Run backfilling at a drastically reduced priority while the backfillee's
+// item queue is full; the replica can't apply items any faster, so disk
+// bandwidth spent getting further ahead just comes out of foreground reads.
+#define CONGESTED_BACKFILL_CACHE_PRIORITY 2
+
 void btree_slice_t::init_real_superblock(real_superblock_t *superblock,
                                          const std::vector<char> &metainfo_key,
                                          const binary_blob_t &metainfo_value) {
@@ -173,7 +178,9 @@ btree_slice_t::btree_slice_t(cache_t *c, perfmon_collection_t *parent,
     : stats(parent,
             (index_type == index_type_t::SECONDARY ? "index-" : "") + identifier),
       cache_(c),
-      backfill_account_(cache()->create_cache_account(BACKFILL_CACHE_PRIORITY)) { }
+      backfill_account_(cache()->create_cache_account(BACKFILL_CACHE_PRIORITY)),
+      congested_backfill_account_(
+          cache()->create_cache_account(CONGESTED_BACKFILL_CACHE_PRIORITY)) { }
 
 btree_slice_t::~btree_slice_t() { }
 
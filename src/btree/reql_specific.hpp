@@ -97,6 +97,9 @@ public:
 
     cache_t *cache() { return cache_; }
     cache_account_t *get_backfill_account() { return &backfill_account_; }
+    cache_account_t *get_congested_backfill_account() {
+        return &congested_backfill_account_;
+    }
 
     btree_stats_t stats;
 
@@ -106,6 +109,10 @@ private:
     // Cache account to be used when backfilling.
     cache_account_t backfill_account_;
 
+    // An even lower-priority account, used when the backfillee's apply queue
+    // is full and reading faster would only lengthen it.
+    cache_account_t congested_backfill_account_;
+
     DISABLE_COPYING(btree_slice_t);
 };
 
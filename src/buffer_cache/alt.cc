@@ -216,6 +216,16 @@ void cache_t::remove_snapshot_node(block_id_t block_id, alt_snapshot_node_t *nod
     }
 }
 
+/* Read transactions are already decoupled from writes to the extent the
+cache's consistency model allows: they never touch the write throttler (see
+`help_construct()`), and a reader that calls `buf_lock_t::snapshot_subdag()`
+-- which the rdb read path does for range scans -- pins block *versions*
+through `alt_snapshot_node_t`s and drops out of the `current_page_t`
+acquirer queues, so subsequent writes to the same blocks proceed against the
+live version without waiting for it. The only remaining contact points are
+the brief initial superblock acquisition (which is what gives reads a
+consistent point in time to snapshot at) and the memory held by old block
+versions while a long scan is in flight. */
 txn_t::txn_t(cache_conn_t *cache_conn,
              read_access_t)
     : cache_(cache_conn->cache()),
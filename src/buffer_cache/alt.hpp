@@ -20,6 +20,16 @@ class alt_snapshot_node_t;
 class perfmon_collection_t;
 class cache_balancer_t;
 
+/* Write throttling is already per table (in fact per shard): every store has
+its own cache_t and therefore its own throttler, and the throttler's capacity
+scales with the memory the cache balancer has assigned to that cache (see
+`inform_memory_limit_change()`). So one table's unwritten-change backlog never
+consumes another table's throttle budget directly. The remaining coupling is
+the balancer itself, which hands more memory -- and thus a looser throttle --
+to whichever caches show the most activity; containing an ingest-heavy
+neighbor by policy would mean a per-table weight or ceiling in `table_config`
+plumbed down to `alt_cache_balancer_t`'s rebalance pass, which is
+configuration surface rather than throttler mechanics. */
 class alt_txn_throttler_t {
 public:
     explicit alt_txn_throttler_t(int64_t minimum_unwritten_changes_limit);
@@ -31,6 +41,12 @@ public:
     void inform_memory_limit_change(uint64_t memory_limit,
                                     block_size_t max_block_size);
 
+    // The current capacity of the unwritten block changes semaphore.  The page
+    // cache uses this to decide when to start a soft durability flush early.
+    int64_t unwritten_changes_limit() const {
+        return unwritten_block_changes_semaphore_.capacity();
+    }
+
 private:
     const int64_t minimum_unwritten_changes_limit_;
 
@@ -587,13 +587,41 @@ void traverse_index(buf_parent_t parent, int levels, block_id_t *block_ids,
     if (sub_smaller_size > 0) {
         if (levels > 1) {
             buf_lock_t lock(parent, block_ids[index], access_t::write);
-            buf_write_t write(&lock);
-            void *b = write.get_data_write();
 
-            block_id_t *subids = blob::internal_node_block_ids(b);
-            traverse_recursively(buf_parent_t(&lock), levels - 1, subids,
+            // The recursion only writes to this node's buf when it allocates
+            // or deletes children, so we hand it a copy of the block id array
+            // and only dirty the node if the array actually changed.  This
+            // keeps a small append from rewriting every interior node on the
+            // boundary path of a big blob.
+            const int64_t count = blob::internal_node_count(block_size);
+            scoped_array_t<block_id_t> subids_copy(count);
+            {
+                buf_read_t read(&lock);
+                const block_id_t *subids
+                    = blob::internal_node_block_ids(read.get_data_read());
+                memcpy(subids_copy.data(), subids, count * sizeof(block_id_t));
+            }
+
+            traverse_recursively(buf_parent_t(&lock), levels - 1,
+                                 subids_copy.data(),
                                  sub_smaller_size, sub_bigger_size,
                                  helper);
+
+            bool subids_changed;
+            {
+                buf_read_t read(&lock);
+                const block_id_t *subids
+                    = blob::internal_node_block_ids(read.get_data_read());
+                subids_changed = memcmp(subids, subids_copy.data(),
+                                        count * sizeof(block_id_t)) != 0;
+            }
+            if (subids_changed) {
+                buf_write_t write(&lock);
+                void *b = write.get_data_write();
+                memcpy(blob::internal_node_block_ids(b),
+                       subids_copy.data(),
+                       count * sizeof(block_id_t));
+            }
         }
 
     } else {
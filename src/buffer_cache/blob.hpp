@@ -119,8 +119,12 @@ const block_id_t *internal_node_block_ids(const void *buf);
 // Returns offset and size, clamped to and relative to the index'th subtree.
 void shrink(max_block_size_t block_size, int levels, int64_t offset, int64_t size, int index, int64_t *suboffset_out, int64_t *subsize_out);
 
-// The maxreflen value (allegedly) appropriate for use with rdb_protocol btrees.
-// It's 251.  This should be renamed.
+// The maxreflen value appropriate for use with rdb_protocol btrees.  It's 251,
+// which means a leaf node pair never carries more than 251 bytes of value:
+// anything bigger is spilled into a separate chain of blob blocks, and the ref
+// in the leaf holds just the size, offset and block ids.  That keeps leaf
+// fanout high for mid-size values and lets key-only operations skip loading
+// values entirely (see `lazy_btree_val_t`).  This should be renamed.
 extern int btree_maxreflen;
 
 // The size of a blob, equivalent to blob_t(ref, maxreflen).valuesize().
@@ -0,0 +1,121 @@
+#include "buffer_cache/compressed_tier.hpp"
+
+#include <string.h>
+#include <zlib.h>
+
+namespace alt {
+
+// How long an entry may sit in the tier.  Entries pin their block token, which
+// keeps the corresponding on-disk block live, so we don't let one linger
+// forever just because nobody inserts after it.
+const int64_t COMPRESSED_PAGE_TTL_NANOS = 60 * BILLION;
+
+// The approximate memory usage of an entry: the compressed payload plus a
+// rough count of the list node, index node, and entry fields around it.
+size_t entry_memory_usage(size_t compressed_len) {
+    return compressed_len + 96;
+}
+
+compressed_page_tier_t::compressed_page_tier_t()
+    : memory_limit_(0), size_(0) { }
+
+compressed_page_tier_t::~compressed_page_tier_t() {
+    assert_thread();
+}
+
+void compressed_page_tier_t::insert(const counted_t<block_token_t> &token,
+                                    const buf_ptr_t &buf) {
+    assert_thread();
+    if (memory_limit_ == 0) {
+        return;
+    }
+    rassert(token->block_size() == buf.block_size());
+
+    const uLong src_len = buf.block_size().ser_value();
+    uLongf dest_len = compressBound(src_len);
+    scoped_array_t<char> scratch(dest_len);
+    const int res = compress2(reinterpret_cast<Bytef *>(scratch.data()),
+                              &dest_len,
+                              reinterpret_cast<const Bytef *>(buf.ser_buffer()),
+                              src_len,
+                              Z_BEST_SPEED);
+    if (res != Z_OK || dest_len >= src_len - src_len / 8) {
+        // Not compressible enough to be worth keeping.
+        return;
+    }
+
+    const int64_t offset = token->offset();
+    auto existing = index_.find(offset);
+    if (existing != index_.end()) {
+        size_ -= entry_memory_usage(existing->second->second.data.size());
+        entries_.erase(existing->second);
+        index_.erase(existing);
+    }
+
+    compressed_page_t entry;
+    entry.token = token;
+    entry.data.init(dest_len);
+    memcpy(entry.data.data(), scratch.data(), dest_len);
+    entry.insertion_time = get_ticks();
+
+    entries_.push_front(std::make_pair(offset, std::move(entry)));
+    index_[offset] = entries_.begin();
+    size_ += entry_memory_usage(dest_len);
+
+    trim();
+}
+
+bool compressed_page_tier_t::lookup(const counted_t<block_token_t> &token,
+                                    buf_ptr_t *buf_out) {
+    assert_thread();
+    auto it = index_.find(token->offset());
+    if (it == index_.end()) {
+        return false;
+    }
+    const compressed_page_t *entry = &it->second->second;
+    rassert(entry->token->block_size() == token->block_size());
+
+    const block_size_t block_size = entry->token->block_size();
+    buf_ptr_t buf = buf_ptr_t::alloc_uninitialized(block_size);
+    uLongf dest_len = block_size.ser_value();
+    const int res
+        = uncompress(reinterpret_cast<Bytef *>(buf.ser_buffer()),
+                     &dest_len,
+                     reinterpret_cast<const Bytef *>(entry->data.data()),
+                     entry->data.size());
+    guarantee(res == Z_OK && dest_len == block_size.ser_value(),
+              "Could not decompress a cached compressed page.");
+    buf.fill_padding_zero();
+
+    size_ -= entry_memory_usage(entry->data.size());
+    entries_.erase(it->second);
+    index_.erase(it);
+
+    *buf_out = std::move(buf);
+    return true;
+}
+
+void compressed_page_tier_t::update_memory_limit(uint64_t new_memory_limit) {
+    assert_thread();
+    memory_limit_ = new_memory_limit;
+    trim();
+}
+
+void compressed_page_tier_t::trim() {
+    const ticks_t now = get_ticks();
+    while (!entries_.empty()
+           && (size_ > memory_limit_
+               || now.nanos - entries_.back().second.insertion_time.nanos
+                   > COMPRESSED_PAGE_TTL_NANOS)) {
+        remove_oldest_entry();
+    }
+}
+
+void compressed_page_tier_t::remove_oldest_entry() {
+    rassert(!entries_.empty());
+    size_ -= entry_memory_usage(entries_.back().second.data.size());
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+}
+
+}  // namespace alt
@@ -0,0 +1,77 @@
+#ifndef BUFFER_CACHE_COMPRESSED_TIER_HPP_
+#define BUFFER_CACHE_COMPRESSED_TIER_HPP_
+
+#include <stdint.h>
+
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "containers/counted.hpp"
+#include "containers/scoped.hpp"
+#include "serializer/buf_ptr.hpp"
+#include "serializer/types.hpp"
+#include "threading.hpp"
+#include "time.hpp"
+
+namespace alt {
+
+// A second-tier cache of compressed pages.  When the evicter drops a loaded,
+// disk-backed page, we keep a compressed copy of its buf, keyed by the block
+// token's disk offset, and the page load paths check here before going to the
+// serializer.  Entries hold a reference to their block token, which keeps the
+// offset from being reused by the garbage collector, so an offset match is
+// always the current data for that offset.  (The flip side is that an entry
+// keeps its on-disk block live, so entries also expire after a while.)
+//
+// Like the evicter, this lives on its page cache's thread and is only used
+// from there.
+class compressed_page_tier_t : public home_thread_mixin_debug_only_t {
+public:
+    compressed_page_tier_t();
+    ~compressed_page_tier_t();
+
+    // Compresses the buf and stores it under the token's disk offset.  May
+    // decline to store incompressible data, and drops the stalest entries when
+    // over the memory limit.
+    void insert(const counted_t<block_token_t> &token, const buf_ptr_t &buf);
+
+    // If a compressed copy for the token's offset is stored, decompresses it
+    // into *buf_out, drops the stored entry (the page is going back to the hot
+    // tier), and returns true.
+    bool lookup(const counted_t<block_token_t> &token, buf_ptr_t *buf_out);
+
+    void update_memory_limit(uint64_t new_memory_limit);
+
+    uint64_t size() const { return size_; }
+
+private:
+    struct compressed_page_t {
+        counted_t<block_token_t> token;
+        scoped_array_t<char> data;
+        ticks_t insertion_time;
+    };
+
+    // Drops expired entries, and the least recently inserted entries while
+    // over the memory limit.
+    void trim();
+
+    void remove_oldest_entry();
+
+    uint64_t memory_limit_;
+
+    // The approximate memory usage of the entries.
+    uint64_t size_;
+
+    // Most recently inserted entries at the front.
+    std::list<std::pair<int64_t, compressed_page_t> > entries_;
+    std::unordered_map<
+        int64_t,
+        std::list<std::pair<int64_t, compressed_page_t> >::iterator> index_;
+
+    DISABLE_COPYING(compressed_page_tier_t);
+};
+
+}  // namespace alt
+
+#endif  // BUFFER_CACHE_COMPRESSED_TIER_HPP_
@@ -1,5 +1,7 @@
 #include "buffer_cache/evicter.hpp"
 
+#include <vector>
+
 #include "arch/runtime/coroutines.hpp"
 #include "buffer_cache/alt.hpp"
 #include "buffer_cache/page.hpp"
@@ -8,6 +10,13 @@
 
 namespace alt {
 
+// How many pages one randomized sampling pass of evict_if_necessary selects.
+const size_t EVICTION_BATCH_SIZE = 8;
+
+// The compressed second tier gets this fraction of the balancer-assigned
+// memory limit, on top of the limit itself.
+const uint64_t COMPRESSED_TIER_MEMORY_FRACTION = 4;
+
 evicter_t::evicter_t()
     : initialized_(false),
       page_cache_(nullptr),
@@ -43,6 +52,8 @@ void evicter_t::initialize(page_cache_t *page_cache,
     balancer_notify_activity_boolean_
         = balancer_->notify_activity_boolean(get_thread_id());
     balancer_->add_evicter(this);
+    page_cache_->compressed_tier()->update_memory_limit(
+        memory_limit_ / COMPRESSED_TIER_MEMORY_FRACTION);
     throttler_->inform_memory_limit_change(memory_limit_,
                                            page_cache_->max_block_size());
 }
@@ -60,6 +71,8 @@ void evicter_t::update_memory_limit(uint64_t new_memory_limit,
     bytes_loaded_counter_ -= bytes_loaded_accounted_for;
     access_count_counter_ -= access_count_accounted_for;
     memory_limit_ = new_memory_limit;
+    page_cache_->compressed_tier()->update_memory_limit(
+        memory_limit_ / COMPRESSED_TIER_MEMORY_FRACTION);
     evict_if_necessary();
 
     throttler_->inform_memory_limit_change(memory_limit_,
@@ -195,15 +208,30 @@ void evicter_t::evict_if_necessary() THROWS_NOTHING {
     // currently being written for the purpose of eviction.
 
     evict_if_necessary_active_ = true;
-    page_t *page;
+    // We evict in batches -- one sampling pass picks several oldish pages,
+    // which is cheaper than drawing a fresh set of random samples for every
+    // single page when we're many pages over the limit.
+    std::vector<page_t *> batch;
     while (in_memory_size() > memory_limit_
-           && eviction_bag_t::select_oldish(
-                &evictable_disk_backed_, access_time_counter_, &page)) {
-        uint32_t mem_usage = page->hypothetical_memory_usage(page_cache_);
-        evictable_disk_backed_.remove(page, mem_usage);
-        evicted_.add(page, mem_usage);
-        page->evict_self(page_cache_);
-        page_cache_->consider_evicting_current_page(page->block_id());
+           && eviction_bag_t::select_oldish_batch(
+                &evictable_disk_backed_, access_time_counter_,
+                EVICTION_BATCH_SIZE, &batch)) {
+        for (page_t *page : batch) {
+            if (in_memory_size() <= memory_limit_) {
+                break;
+            }
+            // Evicting one page can move others out of the bag as a side
+            // effect, so re-check membership before touching the page.
+            if (!evictable_disk_backed_.has_page(page)) {
+                continue;
+            }
+            uint32_t mem_usage = page->hypothetical_memory_usage(page_cache_);
+            evictable_disk_backed_.remove(page, mem_usage);
+            evicted_.add(page, mem_usage);
+            page->evict_self(page_cache_);
+            page_cache_->consider_evicting_current_page(page->block_id());
+        }
+        batch.clear();
     }
 
     if (in_memory_size() > memory_limit_) {
@@ -2,6 +2,8 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
+
 #include "buffer_cache/page.hpp"
 #include "random.hpp"
 #include "utils.hpp"
@@ -59,6 +61,40 @@ bool eviction_bag_t::select_oldish(eviction_bag_t *eb, uint64_t access_time_offs
     return true;
 }
 
+bool eviction_bag_t::select_oldish_batch(eviction_bag_t *eb,
+                                         uint64_t access_time_offset,
+                                         size_t max_pages,
+                                         std::vector<page_t *> *pages_out) {
+    if (eb->bag_.size() == 0) {
+        return false;
+    }
+    // We draw the same number of random samples per page as select_oldish, but
+    // in one pass for the whole batch, and keep the oldest max_pages of them.
+    const size_t num_randoms = 5;
+    const size_t num_samples = std::min(eb->bag_.size(), max_pages * num_randoms);
+    std::vector<page_t *> candidates;
+    candidates.reserve(num_samples);
+    for (size_t i = 0; i < num_samples; ++i) {
+        candidates.push_back(eb->bag_.access_random(randsize(eb->bag_.size())));
+    }
+    // We compare relative to the access time offset, so that in the unlikely
+    // event of a 64-bit overflow, performance degradation is "smooth".
+    std::sort(candidates.begin(), candidates.end(),
+              [access_time_offset](page_t *a, page_t *b) {
+                  return access_time_offset - a->access_time()
+                      > access_time_offset - b->access_time();
+              });
+    // Random sampling can return the same page twice.  Duplicates have equal
+    // access times, so they end up adjacent after the sort.
+    candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+    if (candidates.size() > max_pages) {
+        candidates.resize(max_pages);
+    }
+    *pages_out = std::move(candidates);
+    return true;
+}
+
 template <class T>
 T access_random2(const backindex_bag_t<T> &b1, const backindex_bag_t<T> &b2,
                  size_t index) {
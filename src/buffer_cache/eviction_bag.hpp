@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include "containers/backindex_bag.hpp"
 
 namespace alt {
@@ -38,6 +40,13 @@ public:
         eviction_bag_t *eb1, eviction_bag_t *eb2, uint64_t access_time_offset,
         page_t **page_out);
 
+    // Collects up to max_pages distinct oldish pages into pages_out (oldest
+    // first), using one sampling pass for the whole batch.  Returns false if
+    // the bag is empty.
+    static bool select_oldish_batch(
+        eviction_bag_t *eb, uint64_t access_time_offset, size_t max_pages,
+        std::vector<page_t *> *pages_out);
+
 private:
     backindex_bag_t<page_t *> bag_;
     // The size in memory.
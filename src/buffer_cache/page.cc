@@ -151,12 +151,18 @@ void page_t::load_from_copyee(page_t *page, page_t *copyee,
 
         ASSERT_FINITE_CORO_WAITING;
         if (!loader.abandon_page()) {
-            // KSI: If somehow there are no snapshotters of copyee now (besides
-            // ourself), maybe we could avoid copying this memory.  We need to
-            // carefully track snapshotters anyway, once we're comfortable with that,
-            // we could do it.
-
-            {
+            if (copyee->num_snapshot_references() == 1
+                && copyee->block_token_.has()) {
+                // The snapshotters that forced this copy released the copyee
+                // while we waited for its buf -- our copyee_ptr holds the only
+                // remaining reference.  The buf still matches the block token
+                // (the token is reset before a buf gets written to), so
+                // instead of copying the buf we take it, leaving the copyee in
+                // the evicted category once our page_acq_t lets go of it.
+                usage_adjuster_t adjuster(page_cache, page);
+                page->buf_ = std::move(copyee->buf_);
+                page->loader_ = nullptr;
+            } else {
                 usage_adjuster_t adjuster(page_cache, page);
                 page->buf_ = buf_ptr_t::alloc_copy(copyee->buf_);
                 page->loader_ = nullptr;
@@ -349,11 +355,18 @@ void page_t::load_with_block_id(page_t *page, block_id_t block_id,
     buf_ptr_t buf;
     counted_t<block_token_t> block_token;
 
+    serializer_t *const serializer = page_cache->serializer();
     {
-        serializer_t *const serializer = page_cache->serializer();
         on_thread_t th(serializer->home_thread());
         block_token = serializer->index_read(block_id);
         rassert(block_token.has());
+    }
+
+    // Check the compressed tier (on our own thread) before paying for a block
+    // read.  On a miss this costs an extra round trip to the serializer
+    // thread, which is noise next to the disk read the miss is about to do.
+    if (!page_cache->compressed_tier()->lookup(block_token, &buf)) {
+        on_thread_t th(serializer->home_thread());
         buf = serializer->block_read(block_token,
                                      account->get());
     }
@@ -446,7 +459,7 @@ void page_t::load_using_block_token(page_t *page, page_cache_t *page_cache,
     rassert(block_token.has());
 
     buf_ptr_t buf;
-    {
+    if (!page_cache->compressed_tier()->lookup(block_token, &buf)) {
         serializer_t *const serializer = page_cache->serializer();
 
         on_thread_t th(serializer->home_thread());
@@ -550,7 +563,7 @@ void page_t::remove_waiter(page_acq_t *acq) {
     rassert(snapshot_refcount_ > 0);
 }
 
-void page_t::evict_self(DEBUG_VAR page_cache_t *page_cache) {
+void page_t::evict_self(page_cache_t *page_cache) {
     // A page_t can only self-evict if it has a block token (for now).
     rassert(waiters_.empty());
     rassert(block_token_.has());
@@ -559,6 +572,9 @@ void page_t::evict_self(DEBUG_VAR page_cache_t *page_cache) {
 #ifndef NDEBUG
     const uint32_t usage_before = hypothetical_memory_usage(page_cache);
 #endif
+    // Keep a compressed copy around, so a warm re-access of this block doesn't
+    // have to pay for a disk read.
+    page_cache->compressed_tier()->insert(block_token_, buf_);
     buf_.reset();
     // Hypothetical memory usage shouldn't have changed -- the block token has the
     // same block size.
@@ -11,6 +11,7 @@
 #include "arch/runtime/runtime_utils.hpp"
 #include "concurrency/auto_drainer.hpp"
 #include "concurrency/new_mutex.hpp"
+#include "buffer_cache/alt.hpp"
 #include "buffer_cache/cache_balancer.hpp"
 #include "do_on_thread.hpp"
 #include "serializer/serializer.hpp"
@@ -244,7 +245,10 @@ page_cache_t::page_cache_t(serializer_t *_serializer,
                            cache_balancer_t *balancer,
                            alt_txn_throttler_t *throttler)
     : max_block_size_(_serializer->max_block_size()),
+      num_active_asap_false_flushes_(false),
+      last_soft_flush_duration_nanos_(0),
       serializer_(_serializer),
+      throttler_(throttler),
       // Start the counter at 1 so we can distinguish empty values.
       next_block_version_(block_version_t().subsequent()),
       free_list_(_serializer),
@@ -1852,8 +1856,14 @@ void page_cache_t::do_flush_txn_set(
     // Okay, yield, thank you.
     coro_t::yield();
 
+    const ticks_t flush_start = get_ticks();
+
     do_flush_changes(page_cache, &coltx, index_write_token, asap, soft_deadline);
 
+    if (!asap) {
+        page_cache->last_soft_flush_duration_nanos_
+            = get_ticks().nanos - flush_start.nanos;
+    }
     page_cache->num_active_asap_false_flushes_ -= (asap ? 0 : 1);
 
     // Flush complete.
@@ -2007,6 +2017,30 @@ void page_cache_t::merge_into_waiting_for_spawn_flush(scoped_ptr_t<page_txn_t> &
     last->merge(std::move(base));
 }
 
+void page_cache_t::consider_early_interval_flush() {
+    assert_thread();
+    page_txn_t *waiting = waiting_for_spawn_flush_.tail();
+    if (waiting == nullptr) {
+        return;
+    }
+    // A bursty workload can dirty the throttler's entire unwritten-changes
+    // window within one flush interval, and the oversized flush the timer
+    // eventually starts then stalls every writer that's queued up behind the
+    // semaphore.  So once the merged txn holds a good chunk of the window, we
+    // start the flush now instead of waiting for soft_durability_flusher_.
+    // When the previous flush took longer than the flush interval the disk is
+    // already saturated and smaller batches would just cost us write merging,
+    // so in that case we let the backlog grow to half the window first.
+    const int64_t limit = throttler_->unwritten_changes_limit();
+    const int64_t threshold
+        = last_soft_flush_duration_nanos_ > DEFAULT_FLUSH_INTERVAL * MILLION
+        ? limit / 2
+        : limit / 4;
+    if (static_cast<int64_t>(waiting->dirtied_page_count()) >= threshold) {
+        soft_durability_interval_flush(ticks_t{0});
+    }
+}
+
 void page_cache_t::begin_waiting_for_flush(
         scoped_ptr_t<page_txn_t> &&base, write_durability_t durability) {
     assert_thread();
@@ -2023,6 +2057,7 @@ void page_cache_t::begin_waiting_for_flush(
     base->began_waiting_for_flush_ = true;
     if (!base->throttler_acq_.pre_spawn_flush()) {
         merge_into_waiting_for_spawn_flush(std::move(base));
+        consider_early_interval_flush();
     } else {
         page_txn_t *base_unscoped = base.release();
         want_to_spawn_flush_.push_back(base_unscoped);
@@ -11,6 +11,7 @@
 
 #include "buffer_cache/block_version.hpp"
 #include "buffer_cache/cache_account.hpp"
+#include "buffer_cache/compressed_tier.hpp"
 #include "buffer_cache/evicter.hpp"
 #include "buffer_cache/free_list.hpp"
 #include "buffer_cache/page.hpp"
@@ -484,6 +485,8 @@ public:
 
     evicter_t &evicter() { return evicter_; }
 
+    compressed_page_tier_t *compressed_tier() { return &compressed_tier_; }
+
     auto_drainer_t::lock_t drainer_lock() { return drainer_->lock(); }
     serializer_t *serializer() { return serializer_; }
 
@@ -589,6 +592,10 @@ private:
 
     void merge_into_waiting_for_spawn_flush(scoped_ptr_t<page_txn_t> &&base);
 
+    // Starts a soft durability flush ahead of the flush timer if the merged
+    // waiting txn has accumulated enough dirty pages.
+    void consider_early_interval_flush();
+
     static flush_prep_t prep_flush_changes(
         page_cache_t *page_cache,
         const std::unordered_map<block_id_t, block_change_t> &changes);
@@ -612,9 +619,14 @@ private:
     // Number of flushes started, not yet completed, that are asap=false.
     bool num_active_asap_false_flushes_;
 
+    // Wall-clock duration of the most recent completed asap=false flush.  Used
+    // by consider_early_interval_flush to adapt its early-flush threshold.
+    int64_t last_soft_flush_duration_nanos_;
+
     scoped_ptr_t<page_cache_index_write_sink_t> index_write_sink_;
 
     serializer_t *serializer_;
+    alt_txn_throttler_t *throttler_;
     segmented_vector_t<repli_timestamp_t> recencies_;
 
     std::unordered_map<block_id_t, current_page_t *> current_pages_;
@@ -642,6 +654,9 @@ private:
 
     evicter_t evicter_;
 
+    // Compressed copies of pages the evicter dropped from memory.
+    compressed_page_tier_t compressed_tier_;
+
     // KSI: I bet this read_ahead_cb_ and read_ahead_cb_existence_ type could be
     // packaged in some new cross_thread_ptr type.
     page_read_ahead_cb_t *read_ahead_cb_;
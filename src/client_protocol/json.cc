@@ -45,22 +45,21 @@ scoped_ptr_t<ql::query_params_t> json_protocol_t::parse_query_from_buffer(
     return res;
 }
 
-scoped_ptr_t<ql::query_params_t> json_protocol_t::parse_query(
+scoped_array_t<char> json_protocol_t::read_query_frame(
         tcp_conn_t *conn,
         signal_t *interruptor,
-        ql::query_cache_t *query_cache) {
-    int64_t token;
+        int64_t *token_out) {
     uint32_t size;
-    conn->read_buffered(&token, sizeof(token), interruptor);
+    conn->read_buffered(token_out, sizeof(*token_out), interruptor);
     conn->read_buffered(&size, sizeof(size), interruptor);
-    ql::response_t error;
 
 #ifdef __s390x__
-    token = __builtin_bswap64(token);
+    *token_out = __builtin_bswap64(*token_out);
     size = __builtin_bswap32(size);
 #endif
 
     if (size >= wire_protocol_t::TOO_LARGE_QUERY_SIZE) {
+        ql::response_t error;
         error.fill_error(Response::CLIENT_ERROR,
                          Response::RESOURCE_LIMIT,
                          wire_protocol_t::too_large_query_message(size),
@@ -75,7 +74,7 @@ scoped_ptr_t<ql::query_params_t> json_protocol_t::parse_query(
             conn->pop(size, &pop_interruptor);
         }
 
-        send_response(&error, token, conn, interruptor);
+        send_response(&error, *token_out, conn, interruptor);
         throw tcp_conn_read_closed_exc_t();
     }
 
@@ -86,14 +85,7 @@ scoped_ptr_t<ql::query_params_t> json_protocol_t::parse_query(
     // avoid an extra copy.
     conn->read(data.data(), size, interruptor);
     data[size] = 0; // Null terminate the string, which the json parser requires
-
-    scoped_ptr_t<ql::query_params_t> res =
-        parse_query_from_buffer(std::move(data), 0, query_cache, token, &error);
-
-    if (!res.has()) {
-        send_response(&error, token, conn, interruptor);
-    }
-    return res;
+    return data;
 }
 
 void write_response_internal(ql::response_t *response,
@@ -201,6 +193,13 @@ void json_protocol_t::write_response_to_buffer(ql::response_t *response,
 #endif
 }
 
+/* A response is materialized fully before any byte hits the socket. That's forced by
+the framing: each response is `token + uint32 length + payload`, so the length has to be
+known up front, and drivers rely on it to split the stream. Streaming rows within a
+response would be a client protocol change. In practice the cost is bounded -- a batch
+is limited in rows and bytes by its `batchspec_t`, the first batch of a stream is
+deliberately scaled down to shorten time-to-first-row, and the per-batch CONTINUE
+round trip is the backpressure that keeps a slow client from buffering the world. */
 void json_protocol_t::send_response(ql::response_t *response,
                                     int64_t token,
                                     tcp_conn_t *conn,
@@ -247,6 +246,17 @@ void json_protocol_t::send_response(ql::response_t *response,
             reinterpret_cast<const char *>(&data_size)[i];
     }
 
-    conn->write(buffer.GetString(), buffer.GetSize(), interruptor);
+    // Under pipelined load several responses are usually waiting on the send
+    // mutex.  Pushing small responses through the connection's chunk buffer and
+    // flushing without waiting for the socket lets consecutive responses go out
+    // in a single write() call instead of one syscall each; the write queue's
+    // semaphore still provides backpressure.  Large responses skip the extra
+    // copy and are written directly.
+    if (buffer.GetSize() < tcp_conn_t::WRITE_CHUNK_SIZE) {
+        conn->write_buffered(buffer.GetString(), buffer.GetSize(), interruptor);
+        conn->flush_buffer_eventually(interruptor);
+    } else {
+        conn->write(buffer.GetString(), buffer.GetSize(), interruptor);
+    }
 }
 
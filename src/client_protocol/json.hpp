@@ -25,9 +25,15 @@ public:
             ql::query_cache_t *query_cache, int64_t token,
             ql::response_t *error_out);
 
-    static scoped_ptr_t<ql::query_params_t> parse_query(tcp_conn_t *conn,
-                                                        signal_t *interruptor,
-                                                        ql::query_cache_t *query_cache);
+    // Reads one query frame (token + size + raw query bytes) off the
+    // connection and returns the null-terminated query bytes.  Parsing is the
+    // caller's job (via `parse_query_from_buffer`), so the read loop can go
+    // back to the socket while another coroutine chews on the bytes.
+    // Over-sized queries are answered with an error and terminate the
+    // connection.
+    static scoped_array_t<char> read_query_frame(tcp_conn_t *conn,
+                                                 signal_t *interruptor,
+                                                 int64_t *token_out);
 
     // Used by the HTTP ReQL server to write the query response into the HTTP response
     static void write_response_to_buffer(ql::response_t *response,
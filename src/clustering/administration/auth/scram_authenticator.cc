@@ -85,6 +85,14 @@ std::string scram_authenticator_t::next_message(std::string const &message)
                     throw authentication_error_t(17, "Unknown user");
                 }
 
+                /* Note that the expensive part of SCRAM -- the PBKDF2 iterations
+                that produce SaltedPassword -- never runs here. `m_password`'s hash
+                is the PBKDF2 output, computed once when the password was set and
+                stored in the auth metadata. What follows is a handful of SHA-256
+                operations per handshake; it's the *client* that re-derives
+                SaltedPassword on every connect, and any caching of it keyed by
+                (salt, iteration count) belongs in the drivers. */
+
                 // ClientKey := HMAC(SaltedPassword, "Client Key")
                 std::array<unsigned char, SHA256_DIGEST_LENGTH> client_key =
                     crypto::hmac_sha256(m_password.get_hash(), "Client Key");
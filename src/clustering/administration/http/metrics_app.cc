@@ -0,0 +1,64 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "clustering/administration/http/metrics_app.hpp"
+
+#include <string>
+
+#include "perfmon/collect.hpp"
+#include "rdb_protocol/datum.hpp"
+#include "utils.hpp"
+
+/* Prometheus metric names may only contain `[a-zA-Z0-9_:]`; anything else in
+a stat name (UUIDs in table stats contain dashes, for example) is replaced
+with an underscore. */
+static void append_sanitized_name(const datum_string_t &name, std::string *out) {
+    const char *data = name.data();
+    for (size_t i = 0; i < name.size(); ++i) {
+        char c = data[i];
+        bool ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+            || (c >= '0' && c <= '9') || c == '_' || c == ':';
+        out->push_back(ok ? c : '_');
+    }
+}
+
+/* Flattens the stats tree into exposition lines.  Only numeric leaves are
+exported; strings (version, uptime formatting, etc.) have no Prometheus
+representation and are skipped. */
+static void append_metrics(const ql::datum_t &stats,
+                           const std::string &prefix,
+                           std::string *out) {
+    switch (stats.get_type()) {
+    case ql::datum_t::R_OBJECT:
+        for (size_t i = 0; i < stats.obj_size(); ++i) {
+            std::pair<datum_string_t, ql::datum_t> pair = stats.get_pair(i);
+            std::string name = prefix;
+            name.push_back('_');
+            append_sanitized_name(pair.first, &name);
+            append_metrics(pair.second, name, out);
+        }
+        break;
+    case ql::datum_t::R_NUM:
+        out->append(prefix);
+        out->append(strprintf(" %.17g\n", stats.as_num()));
+        break;
+    case ql::datum_t::R_ARRAY:   // fallthru
+    case ql::datum_t::R_BINARY:  // fallthru
+    case ql::datum_t::R_BOOL:    // fallthru
+    case ql::datum_t::R_NULL:    // fallthru
+    case ql::datum_t::R_STR:     // fallthru
+    case ql::datum_t::MINVAL:    // fallthru
+    case ql::datum_t::MAXVAL:    // fallthru
+    case ql::datum_t::UNINITIALIZED:
+        break;
+    default:
+        unreachable();
+    }
+}
+
+void metrics_http_app_t::handle(const http_req_t &,
+                                http_res_t *result,
+                                signal_t *) {
+    std::string body;
+    append_metrics(perfmon_get_stats(), "rethinkdb", &body);
+    result->code = http_status_code_t::OK;
+    result->set_body("text/plain; version=0.0.4", body);
+}
@@ -0,0 +1,23 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef CLUSTERING_ADMINISTRATION_HTTP_METRICS_APP_HPP_
+#define CLUSTERING_ADMINISTRATION_HTTP_METRICS_APP_HPP_
+
+#include "http/http.hpp"
+
+/* This is an `http_app_t` that serves this server's perfmon stats in the
+Prometheus text exposition format, so monitoring systems can scrape the server
+directly instead of polling the `stats` system table through a sidecar.  The
+stats tree is flattened into metric names: `query_engine -> queries_per_sec`
+becomes `rethinkdb_query_engine_queries_per_sec`.  Only the local node's stats
+are served; a scraper is expected to hit each server. */
+class metrics_http_app_t : public http_app_t {
+public:
+    metrics_http_app_t() { }
+
+    void handle(const http_req_t &req, http_res_t *result, signal_t *interruptor);
+
+private:
+    DISABLE_COPYING(metrics_http_app_t);
+};
+
+#endif /* CLUSTERING_ADMINISTRATION_HTTP_METRICS_APP_HPP_ */
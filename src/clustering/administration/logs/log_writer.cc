@@ -549,7 +549,9 @@ TLS_with_init(auto_drainer_t *, global_log_drainer, nullptr);
 TLS_with_init(int, log_writer_block, 0);
 
 thread_pool_log_writer_t::thread_pool_log_writer_t()
-        : has_parse_error(false) {
+        : has_parse_error(false),
+          dropped_messages(0),
+          flush_in_progress(false) {
     pmap(
         get_num_threads(),
         std::bind(&thread_pool_log_writer_t::install_on_thread, this, ph::_1));
@@ -623,21 +625,61 @@ void thread_pool_log_writer_t::uninstall_on_thread(int i) {
     TLS_set_global_log_drainer(nullptr);
 }
 
+/* The queue only grows while a flush's blocker-pool trip is in flight, so it
+takes a sustained error storm outrunning the disk to fill it. */
+static const size_t MAX_QUEUED_LOG_MESSAGES = 1000;
+
 void thread_pool_log_writer_t::write(const log_message_t &lm) {
-    mutex_t::acq_t write_mutex_acq(&write_mutex);
-    std::string error_message;
-    bool ok;
-    thread_pool_t::run_in_blocker_pool(std::bind(&thread_pool_log_writer_t::write_blocking, this, lm, &error_message, &ok));
-    if (ok) {
-        log_write_issue_tracker.report_success();
-    } else {
-        log_write_issue_tracker.report_error(error_message);
+    assert_thread();
+    if (queued_messages.size() >= MAX_QUEUED_LOG_MESSAGES) {
+        ++dropped_messages;
+        return;
+    }
+    queued_messages.push_back(lm);
+    if (!flush_in_progress) {
+        flush_in_progress = true;
+        coro_t::spawn_sometime(std::bind(
+            &thread_pool_log_writer_t::flush_queue, this, drainer.lock()));
     }
 }
 
-void thread_pool_log_writer_t::write_blocking(const log_message_t &msg, std::string *error_out, bool *ok_out) {
-    *ok_out = fallback_log_writer.write(msg, error_out);
-    return;
+void thread_pool_log_writer_t::flush_queue(auto_drainer_t::lock_t) {
+    assert_thread();
+    while (!queued_messages.empty() || dropped_messages > 0) {
+        std::vector<log_message_t> batch;
+        batch.swap(queued_messages);
+        if (dropped_messages > 0) {
+            batch.push_back(fallback_log_writer.assemble_log_message(
+                log_level_warn,
+                strprintf("Log writer overloaded; dropped %zu messages.",
+                          dropped_messages)));
+            dropped_messages = 0;
+        }
+        std::string error_message;
+        bool ok;
+        thread_pool_t::run_in_blocker_pool(std::bind(
+            &thread_pool_log_writer_t::write_blocking,
+            this, &batch, &error_message, &ok));
+        if (ok) {
+            log_write_issue_tracker.report_success();
+        } else {
+            log_write_issue_tracker.report_error(error_message);
+        }
+    }
+    flush_in_progress = false;
+}
+
+void thread_pool_log_writer_t::write_blocking(
+        const std::vector<log_message_t> *msgs,
+        std::string *error_out, bool *ok_out) {
+    *ok_out = true;
+    for (const log_message_t &msg : *msgs) {
+        std::string error_message;
+        if (!fallback_log_writer.write(msg, &error_message)) {
+            *ok_out = false;
+            *error_out = error_message;
+        }
+    }
 }
 
 void thread_pool_log_writer_t::tail_blocking(
@@ -11,6 +11,7 @@
 
 #include "arch/io/io_utils.hpp"
 #include "clustering/administration/issues/log_write.hpp"
+#include "concurrency/auto_drainer.hpp"
 #include "containers/scoped.hpp"
 #include "logger.hpp"
 #include "rpc/mailbox/typed.hpp"
@@ -81,8 +82,13 @@ private:
     friend void vlog_internal(const char *src_file, int src_line, log_level_t level, const char *format, va_list args);
     void install_on_thread(int i);
     void uninstall_on_thread(int i);
+    /* Queues the message for the flush coroutine; never blocks on IO.  If the
+    queue is full (the disk can't keep up with an error storm) the message is
+    dropped and accounted for in a summary line instead. */
     void write(const log_message_t &msg);
-    void write_blocking(const log_message_t &msg, std::string *error_out, bool *ok_out);
+    void flush_queue(auto_drainer_t::lock_t lock);
+    void write_blocking(const std::vector<log_message_t> *msgs,
+                        std::string *error_out, bool *ok_out);
     void tail_blocking(int max_lines,
                        struct timespec min_timestamp,
                        struct timespec max_timestamp,
@@ -91,10 +97,21 @@ private:
                        std::string *error_out,
                        bool *ok_out);
 
-    mutex_t write_mutex;
     log_write_issue_tracker_t log_write_issue_tracker;
     bool has_parse_error;
 
+    /* Messages queued on the home thread awaiting the flush coroutine.  The
+    single flusher preserves write order, and each of its blocker-pool trips
+    writes out everything queued while the previous trip was on the disk, so
+    the file sees batches instead of one syscall round trip per message. */
+    std::vector<log_message_t> queued_messages;
+    size_t dropped_messages;
+    bool flush_in_progress;
+
+    /* Destroyed first, so the destructor waits for the flush coroutine to
+    write out whatever is still queued. */
+    auto_drainer_t drainer;
+
     DISABLE_COPYING(thread_pool_log_writer_t);
 };
 
@@ -57,6 +57,7 @@
 #include "clustering/administration/logs/log_writer.hpp"
 #include "clustering/administration/main/path.hpp"
 #include "clustering/administration/persist/file.hpp"
+#include "clustering/administration/persist/table_interface.hpp"
 #include "clustering/administration/persist/file_keys.hpp"
 #include "clustering/administration/persist/migrate/migrate_v1_16.hpp"
 #include "clustering/administration/persist/migrate/migrate_v2_1.hpp"
@@ -1407,6 +1408,16 @@ options::help_section_t get_file_options(std::vector<options::option_t> *options
                                              strprintf("%d", DEFAULT_MAX_CONCURRENT_IO_REQUESTS)));
     help.add("--io-threads n",
              "how many simultaneous I/O operations can happen at the same time");
+    options_out->push_back(options::option_t(options::names_t("--io-backend"),
+                                             options::OPTIONAL,
+                                             "pool"));
+    help.add("--io-backend backend",
+             "event backend to use: io_uring or pool (Linux only; defaults to pool)");
+    options_out->push_back(options::option_t(options::names_t("--serializer-stripes"),
+                                             options::OPTIONAL,
+                                             "1"));
+    help.add("--serializer-stripes n",
+             "how many files to stripe each newly created table across");
 #ifndef _WIN32
     // TODO WINDOWS: accept this option, but error out if it is passed
     options_out->push_back(options::option_t(options::names_t("--direct-io"),
@@ -1887,6 +1898,31 @@ MUST_USE bool parse_io_threads_option(const std::map<std::string, options::value
     return true;
 }
 
+MUST_USE bool parse_io_backend_option(const std::map<std::string, options::values_t> &opts) {
+    std::string io_backend = get_single_option(opts, "--io-backend");
+    if (io_backend == "pool") {
+        set_requested_io_backend(io_backend_t::pool);
+    } else if (io_backend == "io_uring") {
+        set_requested_io_backend(io_backend_t::io_uring);
+    } else {
+        fprintf(stderr, "ERROR: io-backend must be 'pool' or 'io_uring'\n");
+        return false;
+    }
+    return true;
+}
+
+MUST_USE bool parse_serializer_stripes_option(
+        const std::map<std::string, options::values_t> &opts) {
+    int stripes = get_single_int(opts, "--serializer-stripes");
+    if (stripes < 1 || stripes > MAXIMUM_SERIALIZER_STRIPES) {
+        fprintf(stderr, "ERROR: serializer-stripes must be between 1 and %d\n",
+                MAXIMUM_SERIALIZER_STRIPES);
+        return false;
+    }
+    set_table_serializer_stripes(stripes);
+    return true;
+}
+
 update_check_t parse_update_checking_option(const std::map<std::string, options::values_t> &opts) {
     return exists_option(opts, "--no-update-check")
         ? update_check_t::do_not_perform
@@ -1928,6 +1964,12 @@ int main_rethinkdb_create(int argc, char *argv[]) {
         if (!parse_io_threads_option(opts, &max_concurrent_io_requests)) {
             return EXIT_FAILURE;
         }
+        if (!parse_io_backend_option(opts)) {
+            return EXIT_FAILURE;
+        }
+        if (!parse_serializer_stripes_option(opts)) {
+            return EXIT_FAILURE;
+        }
 
         const int num_workers = get_cpu_count();
 
@@ -2056,6 +2098,12 @@ int main_rethinkdb_serve(int argc, char *argv[]) {
         if (!parse_io_threads_option(opts, &max_concurrent_io_requests)) {
             return EXIT_FAILURE;
         }
+        if (!parse_io_backend_option(opts)) {
+            return EXIT_FAILURE;
+        }
+        if (!parse_serializer_stripes_option(opts)) {
+            return EXIT_FAILURE;
+        }
 
         update_check_t do_update_checking = parse_update_checking_option(opts);
 
@@ -2327,6 +2375,12 @@ int main_rethinkdb_porcelain(int argc, char *argv[]) {
         if (!parse_io_threads_option(opts, &max_concurrent_io_requests)) {
             return EXIT_FAILURE;
         }
+        if (!parse_io_backend_option(opts)) {
+            return EXIT_FAILURE;
+        }
+        if (!parse_serializer_stripes_option(opts)) {
+            return EXIT_FAILURE;
+        }
 
         update_check_t do_update_checking = parse_update_checking_option(opts);
 
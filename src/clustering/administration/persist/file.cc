@@ -261,6 +261,19 @@ metadata_file_t::write_txn_t::write_txn_t(
     read_txn_t(_file, write_access_t::write, interruptor)
     { }
 
+void metadata_file_t::write_txn_t::commit() {
+    /* Release the file lock before waiting on durability. The in-memory state
+    is fully updated at this point, and the cache orders the flushes of
+    successive transactions on the same `cache_conn_t`, so the next transaction
+    can safely begin while this one waits for disk. Holding the lock across the
+    wait would serialize every metadata writer behind a full disk sync each;
+    releasing it first lets concurrent writers -- e.g. the Raft instances of
+    many tables during a rebalance -- accumulate their changes in the page
+    cache and have them written and synced as one combined flush. */
+    rwlock_acq.reset();
+    txn.commit();
+}
+
 void metadata_file_t::write_txn_t::write_bin(
         const store_key_t &key,
         const write_message_t *msg,
@@ -186,9 +186,7 @@ public:
     // This acts as a safety check to make sure a transaction
     // is not interrupted in the middle, which could leave the
     // metadata in an inconsistent state.
-    void commit() {
-        txn.commit();
-    }
+    void commit();
 
 private:
     friend class ::metadata_file_t;
@@ -14,6 +14,25 @@
 #include "serializer/merger.hpp"
 #include "serializer/translator.hpp"
 
+/* How many serializer files to stripe newly created tables across. The
+serializer multiplexer distributes the CPU shards over all of the files, so a
+single hot table can use the i/o queue depth of more than one file. */
+static int table_serializer_stripes = 1;
+
+void set_table_serializer_stripes(int stripes) {
+    rassert(stripes >= 1);
+    table_serializer_stripes = stripes;
+}
+
+/* The first stripe lives at the table's regular file name; additional stripes
+get a `.stripe_<n>` suffix. */
+static serializer_filepath_t stripe_file_name(const base_path_t &base_path,
+                                              const namespace_id_t &table_id,
+                                              int stripe) {
+    return serializer_filepath_t(
+        base_path, uuid_to_str(table_id) + strprintf(".stripe_%d", stripe));
+}
+
 class real_multistore_ptr_t :
     public multistore_ptr_t {
 public:
@@ -44,34 +63,57 @@ public:
         // exists and then assume it exists or does not exist when
         // loading or creating it.
 
-        // TODO: We should use N slices on M serializers, not N slices
-        // on 1 serializer.
-
         int res = access(path.permanent_path().c_str(), R_OK | W_OK);
         bool create = (res != 0);
 
         on_thread_t thread_switcher(serializer_thread_allocation->get_thread());
-        filepath_file_opener_t file_opener(path, io_backender);
 
+        /* Figure out which stripe files this table consists of. On creation we
+        stripe across as many files as were requested at startup; an existing
+        table always opens with the stripe files it was created with (the
+        multiplexer's config blocks double-check the file count). */
+        std::vector<serializer_filepath_t> stripe_paths;
+        stripe_paths.push_back(path);
         if (create) {
-            log_serializer_t::create(
-                &file_opener,
-                log_serializer_t::static_config_t());
+            for (int i = 1; i < table_serializer_stripes; ++i) {
+                stripe_paths.push_back(stripe_file_name(base_path, table_id, i));
+            }
+        } else {
+            for (int i = 1; ; ++i) {
+                serializer_filepath_t stripe
+                    = stripe_file_name(base_path, table_id, i);
+                if (access(stripe.permanent_path().c_str(), R_OK | W_OK) != 0) {
+                    break;
+                }
+                stripe_paths.push_back(stripe);
+            }
         }
 
-        // TODO: Could we handle failure when loading the serializer?  Right
+        // TODO: Could we handle failure when loading the serializers?  Right
         // now, we don't.
 
-        scoped_ptr_t<serializer_t> inner_serializer(new log_serializer_t(
-            log_serializer_t::dynamic_config_t(),
-            &file_opener,
-            perfmon_collection_serializers));
-        serializer.init(new merger_serializer_t(
-            std::move(inner_serializer),
-            MERGER_SERIALIZER_MAX_ACTIVE_WRITES));
-
+        std::vector<scoped_ptr_t<filepath_file_opener_t> > file_openers;
         std::vector<serializer_t *> ptrs;
-        ptrs.push_back(serializer.get());
+        for (const serializer_filepath_t &stripe_path : stripe_paths) {
+            file_openers.push_back(make_scoped<filepath_file_opener_t>(
+                stripe_path, io_backender));
+
+            if (create) {
+                log_serializer_t::create(
+                    file_openers.back().get(),
+                    log_serializer_t::static_config_t());
+            }
+
+            scoped_ptr_t<serializer_t> inner_serializer(new log_serializer_t(
+                log_serializer_t::dynamic_config_t(),
+                file_openers.back().get(),
+                perfmon_collection_serializers));
+            serializers.push_back(make_scoped<merger_serializer_t>(
+                std::move(inner_serializer),
+                MERGER_SERIALIZER_MAX_ACTIVE_WRITES));
+            ptrs.push_back(serializers.back().get());
+        }
+
         if (create) {
             serializer_multiplexer_t::create(ptrs, CPU_SHARDING_FACTOR);
         }
@@ -115,7 +157,9 @@ public:
         });
 
         if (create) {
-            file_opener.move_serializer_file_to_permanent_location();
+            for (const auto &file_opener : file_openers) {
+                file_opener->move_serializer_file_to_permanent_location();
+            }
         }
     }
 
@@ -130,12 +174,12 @@ public:
                 stores[ix].reset();
             }
         });
-        if (serializer.has()) {
-            on_thread_t thread_switcher(serializer->home_thread());
+        if (!serializers.empty()) {
+            on_thread_t thread_switcher(serializers[0]->home_thread());
             if (multiplexer.has()) {
                 multiplexer.reset();
             }
-            serializer.reset();
+            serializers.clear();
         }
     }
 
@@ -144,7 +188,7 @@ public:
     }
 
     serializer_t *get_serializer() {
-        return serializer.get_or_null();
+        return serializers.empty() ? nullptr : serializers[0].get();
     }
 
     store_view_t *get_cpu_sharded_store(size_t i) {
@@ -157,16 +201,19 @@ public:
 
     bool is_gc_active() {
         rassert(!drainer.is_draining());
-        if (serializer.has()) {
-            return serializer->is_gc_active();
-        } else {
-            return false;
+        for (const auto &serializer : serializers) {
+            if (serializer->is_gc_active()) {
+                return true;
+            }
         }
+        return false;
     }
 
 private:
     scoped_ptr_t<real_branch_history_manager_t> branch_history_manager;
-    scoped_ptr_t<serializer_t> serializer;
+    /* One serializer per stripe file; all of them live on the serializer
+    thread. */
+    std::vector<scoped_ptr_t<serializer_t> > serializers;
     scoped_ptr_t<serializer_multiplexer_t> multiplexer;
     scoped_ptr_t<store_t> stores[CPU_SHARDING_FACTOR];
 
@@ -202,12 +249,24 @@ void real_table_persistence_interface_t::read_all_metadata(
         },
         interruptor);
     storage_interfaces.clear();
-    for (const auto &pair : active_tables) {
-        storage_interfaces[pair.first].init(new table_raft_storage_interface_t(
-            metadata_file, &read_txn, pair.first, interruptor));
+    /* Bring the active tables up concurrently. Nearly all of the time here is
+    each table's serializer and LBA load, which is independent per table, so on
+    a node with many tables a serial loop turns restart into a sum of every
+    table's load time. The cap keeps the number of simultaneous serializer
+    loads within a sane i/o budget. The callbacks all run in coroutines on this
+    thread and each one touches only its own table's state, so interleaving
+    them is safe; `read_txn` stays open until every table has been loaded. */
+    static const int64_t MAX_CONCURRENT_TABLE_LOADS = 16;
+    std::vector<std::pair<namespace_id_t, table_active_persistent_state_t> >
+        active_list(active_tables.begin(), active_tables.end());
+    throttled_pmap(active_list.size(), [&](int64_t i) {
+        const namespace_id_t &table_id = active_list[i].first;
+        storage_interfaces[table_id].init(new table_raft_storage_interface_t(
+            metadata_file, &read_txn, table_id, interruptor));
         active_cb(
-            pair.first, pair.second, storage_interfaces[pair.first].get(), &read_txn);
-    }
+            table_id, active_list[i].second, storage_interfaces[table_id].get(),
+            &read_txn);
+    }, MAX_CONCURRENT_TABLE_LOADS);
 
     read_txn.read_many<table_inactive_persistent_state_t>(
         mdprefix_table_inactive(),
@@ -326,6 +385,19 @@ void real_table_persistence_interface_t::destroy_multistore(
     const int res = ::unlink(filepath.c_str());
     guarantee_err(res == 0 || get_errno() == ENOENT,
                   "unlink failed for file %s", filepath.c_str());
+
+    /* Remove any stripe files the table was striped across. */
+    for (int i = 1; ; ++i) {
+        std::string stripe_path
+            = stripe_file_name(base_path, table_id, i).permanent_path();
+        const int stripe_res = ::unlink(stripe_path.c_str());
+        if (stripe_res != 0) {
+            guarantee_err(get_errno() == ENOENT,
+                          "unlink failed for file %s", stripe_path.c_str());
+            break;
+        }
+        logNTC("Removing file %s\n", stripe_path.c_str());
+    }
 }
 
 serializer_filepath_t real_table_persistence_interface_t::file_name_for(
@@ -335,7 +407,7 @@ serializer_filepath_t real_table_persistence_interface_t::file_name_for(
 
 bool real_table_persistence_interface_t::is_gc_active() const {
     for (int thread = 0; thread < get_num_db_threads(); ++thread) {
-        std::map<serializer_t *, auto_drainer_t::lock_t> serializers_copy;
+        std::map<real_multistore_ptr_t *, auto_drainer_t::lock_t> multistores_copy;
 
         // Note the copy in the loop below is intentional, one of the members is a
         // `auto_drainer_t::lock_t` that we want to hold.
@@ -346,14 +418,17 @@ bool real_table_persistence_interface_t::is_gc_active() const {
                     serializer->home_thread() != threadnum_t(thread)) {
                 continue;
             }
-            serializers_copy.insert(
-                std::make_pair(serializer, real_multistore.second.second));
+            multistores_copy.insert(
+                std::make_pair(real_multistore.second.first,
+                               real_multistore.second.second));
         }
 
         {
             on_thread_t on_thread((threadnum_t(thread)));
-            for (auto const &serializer : serializers_copy) {
-                if (serializer.first->is_gc_active()) {
+            for (auto const &multistore : multistores_copy) {
+                // This checks all of the multistore's stripe serializers (they
+                // share one home thread).
+                if (multistore.first->is_gc_active()) {
                     return true;
                 }
             }
@@ -11,6 +11,14 @@ class metadata_file_t;
 class real_multistore_ptr_t;
 class table_raft_storage_interface_t;
 
+const int MAXIMUM_SERIALIZER_STRIPES = 16;
+
+/* Sets how many serializer files newly created tables are striped across.
+Configured at startup from the `--serializer-stripes` command line option.
+Tables that already exist on disk always open with however many stripe files
+they were created with. */
+void set_table_serializer_stripes(int stripes);
+
 class real_table_persistence_interface_t :
     public table_persistence_interface_t {
 public:
@@ -12,6 +12,7 @@
 #include "clustering/administration/tables/table_config.hpp"
 #include "clustering/table_manager/table_meta_client.hpp"
 #include "concurrency/cross_thread_signal.hpp"
+#include "concurrency/pmap.hpp"
 #include "containers/archive/string_stream.hpp"
 #include "rdb_protocol/artificial_table/artificial_table.hpp"
 #include "rdb_protocol/env.hpp"
@@ -781,6 +782,13 @@ bool real_reql_cluster_interface_t::table_reconfigure(
         "The table may or may not have been reconfigured.")
 }
 
+/* How many tables a database-wide operation works on at once.  Every table is
+its own Raft cluster, so the per-table config changes are independent
+consensus rounds; doing them one at a time serializes hundreds of
+commit-plus-propagation latencies on a big database.  The cap bounds how many
+table leaders we're talking to at any moment. */
+static const int64_t DB_WIDE_OP_CONCURRENCY = 16;
+
 bool real_reql_cluster_interface_t::db_reconfigure(
         auth::user_context_t const &user_context,
         counted_t<const ql::db_t> db,
@@ -805,30 +813,57 @@ bool real_reql_cluster_interface_t::db_reconfigure(
 
     user_context.require_config_permission(m_rdb_context, db->id, table_ids);
 
-    ql::datum_t combined_stats = ql::datum_t::empty_object();
-    for (const auto &table_id : table_ids) {
-        ql::datum_t stats;
+    std::vector<namespace_id_t> table_vec(table_ids.begin(), table_ids.end());
+    std::vector<ql::datum_t> stats_vec(table_vec.size());
+    bool all_succeeded = true;
+    std::exception_ptr first_exc;
+    throttled_pmap(0, static_cast<int64_t>(table_vec.size()), [&](int64_t i) {
+        /* Returns `false` on a per-table failure, mirroring the enclosing
+        function's convention so that `CATCH_OP_ERRORS` can be reused. */
+        auto one_table = [&](ql::datum_t *stats_out) -> bool {
+            try {
+                reconfigure_internal(
+                    user_context,
+                    db,
+                    table_vec[i],
+                    params,
+                    dry_run,
+                    &interruptor_on_home,
+                    stats_out);
+            } catch (const no_such_table_exc_t &) {
+                /* The table got deleted during the reconfiguration. It would be weird
+                if `r.db('foo').reconfigure()` produced an error complaining that some
+                table `foo.bar` did not exist. So we just skip the table, as though it
+                were deleted before the operation even began. */
+                *stats_out = ql::datum_t::empty_object();
+            } catch (const admin_op_exc_t &admin_op_exc) {
+                *error_out = admin_op_exc.to_admin_err();
+                return false;
+            } CATCH_OP_ERRORS(db->name, table_names.at(table_vec[i]).name, error_out,
+                "The tables may or may not have been reconfigured.",
+                "The tables may or may not have been reconfigured.")
+            return true;
+        };
         try {
-            reconfigure_internal(
-                user_context,
-                db,
-                table_id,
-                params,
-                dry_run,
-                &interruptor_on_home,
-                &stats);
-        } catch (const no_such_table_exc_t &) {
-            /* The table got deleted during the reconfiguration. It would be weird if
-            `r.db('foo').reconfigure()` produced an error complaining that some table
-            `foo.bar` did not exist. So we just skip the table, as though it were
-            deleted before the operation even began. */
-            continue;
-        } catch (const admin_op_exc_t &admin_op_exc) {
-            *error_out = admin_op_exc.to_admin_err();
-            return false;
-        } CATCH_OP_ERRORS(db->name, table_names.at(table_id).name, error_out,
-            "The tables may or may not have been reconfigured.",
-            "The tables may or may not have been reconfigured.")
+            if (!one_table(&stats_vec[i])) {
+                all_succeeded = false;
+            }
+        } catch (...) {
+            /* Probably `interrupted_exc_t`; it must not escape the worker
+            coroutine, so it is rethrown below. */
+            if (first_exc == nullptr) {
+                first_exc = std::current_exception();
+            }
+        }
+    }, DB_WIDE_OP_CONCURRENCY);
+    if (first_exc != nullptr) {
+        std::rethrow_exception(first_exc);
+    }
+    if (!all_succeeded) {
+        return false;
+    }
+    ql::datum_t combined_stats = ql::datum_t::empty_object();
+    for (const ql::datum_t &stats : stats_vec) {
         std::set<std::string> dummy_conditions;
         combined_stats = combined_stats.merge(stats, &ql::stats_merge,
             ql::configured_limits_t::unlimited, &dummy_conditions);
@@ -1092,21 +1127,45 @@ bool real_reql_cluster_interface_t::db_rebalance(
 
     user_context.require_config_permission(m_rdb_context, db->id, table_ids);
 
-    ql::datum_t combined_stats = ql::datum_t::empty_object();
-    for (const auto &table_id : table_ids) {
-        ql::datum_t stats;
+    std::vector<namespace_id_t> table_vec(table_ids.begin(), table_ids.end());
+    std::vector<ql::datum_t> stats_vec(table_vec.size());
+    bool all_succeeded = true;
+    std::exception_ptr first_exc;
+    throttled_pmap(0, static_cast<int64_t>(table_vec.size()), [&](int64_t i) {
+        auto one_table = [&](ql::datum_t *stats_out) -> bool {
+            try {
+                rebalance_internal(
+                    user_context, table_vec[i], &interruptor_on_home, stats_out);
+            } catch (const no_such_table_exc_t &) {
+                /* This table was deleted while we were iterating over the tables
+                list. So just ignore it to avoid making a confusing error message. */
+                *stats_out = ql::datum_t::empty_object();
+            } catch (const admin_op_exc_t &admin_op_exc) {
+                *error_out = admin_op_exc.to_admin_err();
+                return false;
+            } CATCH_OP_ERRORS(db->name, table_names.at(table_vec[i]).name, error_out,
+                "The tables may or may not have been rebalanced.",
+                "The tables may or may not have been rebalanced.")
+            return true;
+        };
         try {
-            rebalance_internal(user_context, table_id, &interruptor_on_home, &stats);
-        } catch (const no_such_table_exc_t &) {
-            /* This table was deleted while we were iterating over the tables list. So
-            just ignore it to avoid making a confusing error message. */
-            continue;
-        } catch (const admin_op_exc_t &admin_op_exc) {
-            *error_out = admin_op_exc.to_admin_err();
-            return false;
-        } CATCH_OP_ERRORS(db->name, table_names.at(table_id).name, error_out,
-            "The tables may or may not have been rebalanced.",
-            "The tables may or may not have been rebalanced.")
+            if (!one_table(&stats_vec[i])) {
+                all_succeeded = false;
+            }
+        } catch (...) {
+            if (first_exc == nullptr) {
+                first_exc = std::current_exception();
+            }
+        }
+    }, DB_WIDE_OP_CONCURRENCY);
+    if (first_exc != nullptr) {
+        std::rethrow_exception(first_exc);
+    }
+    if (!all_succeeded) {
+        return false;
+    }
+    ql::datum_t combined_stats = ql::datum_t::empty_object();
+    for (const ql::datum_t &stats : stats_vec) {
         std::set<std::string> dummy_conditions;
         combined_stats = combined_stats.merge(stats, &ql::stats_merge,
             ql::configured_limits_t::unlimited, &dummy_conditions);
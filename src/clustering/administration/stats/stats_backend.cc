@@ -19,6 +19,7 @@ stats_artificial_table_backend_t::stats_artificial_table_backend_t(
         admin_identifier_format_t _admin_format) :
     timer_cfeed_artificial_table_backend_t(
         name_string_t::guarantee_valid("stats"), rdb_context, name_resolver),
+    cached_rows_time(kiloticks_t{0}),
     directory_view(_directory_view),
     cluster_sl_view(_cluster_sl_view),
     server_config_client(_server_config_client),
@@ -106,6 +107,23 @@ bool stats_artificial_table_backend_t::read_all_rows_as_vector(
     on_thread_t rethreader(home_thread());
     rows_out->clear();
 
+    /* Monitoring systems poll this table at short intervals, and every full
+    read fans a stats request out to every server in the cluster.  Rapid-fire
+    polls don't learn anything from distinct sweeps -- the perfmon rates are
+    themselves computed over windows -- so full-table reads within
+    `STATS_CACHE_VALID_USECS` share one sweep's result.  The mutex also
+    coalesces concurrent readers: whoever gets it first performs the sweep,
+    and the others find a fresh cache when their turn comes.  Single-row
+    reads stay uncached; they only contact the servers the row asks about. */
+    static const int64_t STATS_CACHE_VALID_USECS = 1000 * 1000;
+    new_mutex_in_line_t cache_spot(&cached_rows_mutex);
+    wait_interruptible(cache_spot.acq_signal(), &interruptor_on_home);
+    if (get_kiloticks().micros - cached_rows_time.micros
+            < STATS_CACHE_VALID_USECS) {
+        *rows_out = cached_rows;
+        return true;
+    }
+
     cluster_semilattice_metadata_t metadata = cluster_sl_view->get();
 
     std::set<std::vector<std::string> > filter = stats_request_t::global_stats_filter();
@@ -149,6 +167,9 @@ bool stats_artificial_table_backend_t::read_all_rows_as_vector(
         }
     }
 
+    cached_rows = *rows_out;
+    cached_rows_time = get_kiloticks();
+
     return true;
 }
 
@@ -9,7 +9,9 @@
 #include "rdb_protocol/artificial_table/caching_cfeed_backend.hpp"
 #include "clustering/administration/metadata.hpp"
 #include "clustering/administration/servers/config_client.hpp"
+#include "concurrency/new_mutex.hpp"
 #include "concurrency/watchable.hpp"
+#include "time.hpp"
 
 class stats_artificial_table_backend_t :
     public timer_cfeed_artificial_table_backend_t
@@ -63,6 +65,13 @@ private:
                                std::vector<ql::datum_t> *results_out,
                                signal_t *interruptor_on_home);
 
+    // Full-table reads within a short window share one cluster-wide stats
+    // sweep; see the comment in `read_all_rows_as_vector`.  All three members
+    // are only touched on the home thread, under `cached_rows_mutex`.
+    new_mutex_t cached_rows_mutex;
+    std::vector<ql::datum_t> cached_rows;
+    kiloticks_t cached_rows_time;
+
     clone_ptr_t<watchable_t<change_tracking_map_t<peer_id_t,
         cluster_directory_metadata_t> > > directory_view;
     std::shared_ptr<semilattice_read_view_t<cluster_semilattice_metadata_t> >
@@ -518,6 +518,10 @@ void raft_member_t<state_t>::on_request_vote_rpc(
     DEBUG_ONLY_CODE(check_invariants(&mutex_acq));
 }
 
+/* Note that the snapshot travels in the RPC as one blob, not in chunks like the Raft
+paper suggests. That's deliberate: our `state_t`s are table configuration states, which
+are small compared to the data they describe, so the chunking and flow control machinery
+would cost more than it saves. */
 template<class state_t>
 void raft_member_t<state_t>::on_install_snapshot_rpc(
         const typename raft_rpc_request_t<state_t>::install_snapshot_t &request,
@@ -1132,7 +1136,10 @@ void raft_member_t<state_t>::update_commit_index(
 
     /* This implementation deviates from the Raft paper in that we persist the commit
     index to disk whenever it changes. This ensures that the state machine never appears
-    to go backwards. */
+    to go backwards.
+    Note that when the commit index advances past several entries at once (which is the
+    common case when we're catching up), this is still a single persistent-state write,
+    and `apply_log_entries()` below applies the whole batch in one pass. */
     storage->write_commit_index(new_commit_index);
 
     /* Raft paper, Figure 2: "If commitIndex > lastApplied: increment lastApplied, apply
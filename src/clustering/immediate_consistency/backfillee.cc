@@ -23,7 +23,14 @@ and ack-items messages to the backfiller. Whenever the backfiller sends messages
 by calling `on_items()` and `on_ack_end_session()`. The `backfillee_t` calls
 `wait_done()` in a separate coroutine to wait for the session to finish, then destroys
 the session after it returns. If the backfillee is destroyed, then `wait_done()` is
-interrupted and the backfillee calls the `session_t` destructor. */
+interrupted and the backfillee calls the `session_t` destructor.
+
+A session covers its key range strictly left to right, but that doesn't mean one chunk
+at a time: the backfiller keeps reading ahead of our applies, limited only by the
+flow-control semaphores on both sides. The left-to-right order itself is load-bearing --
+the `threshold`, `common_version`, and pre-item bookkeeping on both ends assume it, and
+the receiving store applies chunks through one serialized write path per shard anyway,
+so concurrent sub-range sessions would mostly contend with each other there. */
 class backfillee_t::session_t {
 public:
     session_t(
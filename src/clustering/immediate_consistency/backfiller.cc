@@ -249,6 +249,14 @@ private:
                 chunk later. */
                 new_semaphore_in_line_t sem_acq(
                     &parent->item_throttler, parent->intro.config.item_chunk_mem_size);
+                /* If the semaphore makes us wait, the backfillee's item queue
+                is full: the replica is applying items more slowly than we can
+                read them. Remember that so the traversal for this chunk can
+                run on a lower-priority IO account -- reading faster than the
+                replica can apply only takes disk bandwidth away from
+                foreground queries. */
+                const bool receiver_congested =
+                    !sem_acq.acquisition_signal()->is_pulsed();
                 wait_interruptible(
                     sem_acq.acquisition_signal(), keepalive.get_drain_signal());
 
@@ -342,6 +350,7 @@ private:
 
                     backfill_item_memory_tracker_t memory_tracker(
                         parent->intro.config.item_chunk_mem_size);
+                    memory_tracker.set_receiver_congested(receiver_congested);
 
                     parent->parent->store->send_backfill(
                         parent->common_version.mask(subregion),
@@ -374,6 +383,12 @@ private:
                     we want to make sure that `common_version` and `pre_items` accurately
                     represent the state of the backfillee after it applies all the chunks
                     we've sent. */
+                    /* The chunk goes out uncompressed. Compressing it would need a
+                    compression library, which the server doesn't currently link
+                    against, and a capability negotiation in the backfiller intro so
+                    that mixed-version clusters keep working. If that ever changes,
+                    this `send()` and the matching receive in `backfillee.cc` are the
+                    places to wrap. */
                     try {
                         /* Send the chunk over the network */
                         send(parent->parent->mailbox_manager,
@@ -1,7 +1,17 @@
 // Copyright 2010-2015 RethinkDB, all rights reserved.
 #include "clustering/immediate_consistency/primary_dispatcher.hpp"
 
-/* Limits how many writes should be sent to a dispatchee at once. */
+/* Limits how many writes should be sent to a dispatchee at once.
+
+This is the replication pipelining window. `spawn_write()` never waits for the
+network: it queues the write for every dispatchee and returns, and each
+dispatchee's coroutine pool keeps up to this many writes in flight to its
+replica concurrently. The replica applies them in timestamp order regardless of
+arrival order, so on a high-latency link the achievable throughput is
+(window / RTT) writes per second, not 1 / RTT; raise this if a cross-datacenter
+replica can't keep its pipe full. The acks stay per-write rather than
+cumulative up-to-a-timestamp because an ack isn't just a high-water mark: it
+carries that write's `write_response_t`, which the client's callback needs. */
 const size_t DISPATCH_WRITES_CORO_POOL_SIZE = 64;
 
 primary_dispatcher_t::dispatchee_registration_t::dispatchee_registration_t(
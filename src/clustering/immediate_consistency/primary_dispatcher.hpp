@@ -106,6 +106,21 @@ public:
 
         /* TODO: Maybe this should be a queue of `incomplete_write_t`s instead of a queue
         of `std::function`s. */
+
+        /* The flow control between primary and replica is a fixed credit
+        window: the worker pool runs DISPATCH_WRITES_CORO_POOL_SIZE coroutines,
+        and `do_write_async()` doesn't return until the replica has acked, so
+        at most that many writes are unacked on the wire per replica and the
+        replica never has more than that many applier coroutines parked.
+        What's unbounded is this queue, which absorbs the overflow on the
+        primary when a replica applies slower than the write stream arrives;
+        each entry pins its `incomplete_write_t` (a full copy of the write) so
+        a persistently lagging replica shows up as memory growth here. Watch
+        the `<server>_broadcast_queue_count` stat for that. Applying a lagging
+        replica's queue in parallel across disjoint key ranges wouldn't help:
+        the replica's store must advance its metainfo version chain in
+        timestamp order per shard, so out-of-order application is off the
+        table no matter how the keys partition. */
         unlimited_fifo_queue_t<std::function<void()> > background_write_queue;
         calling_callback_t background_write_caller;
         coro_pool_t<std::function<void()> > background_write_workers;
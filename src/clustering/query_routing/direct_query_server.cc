@@ -1,22 +1,110 @@
 // Copyright 2010-2015 RethinkDB, all rights reserved.
 #include "clustering/query_routing/direct_query_server.hpp"
 
+#include <map>
+
+#include "arch/spinlock.hpp"
+#include "concurrency/cross_thread_signal.hpp"
+#include "concurrency/wait_any.hpp"
 #include "protocol_api.hpp"
 #include "store_view.hpp"
 
+/* Every `direct_query_server_t` in this process, keyed by the address of its
+read mailbox.  `try_read_local()` uses this to route reads to collocated
+replicas with a plain function call instead of serializing the query and the
+response through the loopback connection.  Lookups can come from any thread,
+hence the spinlock; entries are only inserted and erased from the owning
+server's home thread. */
+struct local_direct_query_server_info_t {
+    direct_query_server_t *server;
+    threadnum_t thread;
+};
+static spinlock_t local_direct_query_servers_lock;
+static std::map<direct_query_bcard_t::read_mailbox_t::address_t,
+                local_direct_query_server_info_t> local_direct_query_servers;
+
 direct_query_server_t::direct_query_server_t(
         mailbox_manager_t *mm,
         store_view_t *svs_) :
     mailbox_manager(mm),
     svs(svs_),
     read_mailbox(mm, std::bind(&direct_query_server_t::on_read, this,
-                               ph::_1, ph::_2, ph::_3))
-    { }
+                               ph::_1, ph::_2, ph::_3)) {
+    spinlock_acq_t acq(&local_direct_query_servers_lock);
+    local_direct_query_servers.insert(std::make_pair(
+        read_mailbox.get_address(),
+        local_direct_query_server_info_t{this, get_thread_id()}));
+}
+
+direct_query_server_t::~direct_query_server_t() {
+    /* Remove ourself from the registry before our members are destroyed, so
+    that no new `try_read_local()` call can find us; `drainer` then waits out
+    the ones already in flight. */
+    spinlock_acq_t acq(&local_direct_query_servers_lock);
+    local_direct_query_servers.erase(read_mailbox.get_address());
+}
 
 direct_query_bcard_t direct_query_server_t::get_bcard() {
     return direct_query_bcard_t(read_mailbox.get_address());
 }
 
+bool direct_query_server_t::try_read_local(
+        mailbox_manager_t *mm,
+        const direct_query_bcard_t &bcard,
+        const read_t &read,
+        read_response_t *response_out,
+        signal_t *interruptor) {
+    if (bcard.read_mailbox.is_nil()
+        || bcard.read_mailbox.get_peer()
+            != mm->get_connectivity_cluster()->get_me()) {
+        return false;
+    }
+    threadnum_t server_thread(0);
+    {
+        spinlock_acq_t acq(&local_direct_query_servers_lock);
+        auto it = local_direct_query_servers.find(bcard.read_mailbox);
+        if (it == local_direct_query_servers.end()) {
+            return false;
+        }
+        server_thread = it->second.thread;
+    }
+    cross_thread_signal_t ct_interruptor(interruptor, server_thread);
+    on_thread_t rethreader(server_thread);
+    direct_query_server_t *server;
+    auto_drainer_t::lock_t keepalive;
+    {
+        /* Look up again now that we're on the server's home thread; it may
+        have been destroyed while we were hopping. */
+        spinlock_acq_t acq(&local_direct_query_servers_lock);
+        auto it = local_direct_query_servers.find(bcard.read_mailbox);
+        if (it == local_direct_query_servers.end()) {
+            return false;
+        }
+        server = it->second.server;
+        keepalive = auto_drainer_t::lock_t(&server->drainer);
+    }
+    /* Same shortcut as `on_read()`: dummy reads for checking table status are
+    fulfilled without hitting the store. */
+    if (boost::get<dummy_read_t>(&read.read) != nullptr) {
+        response_out->response = dummy_read_response_t();
+        response_out->n_shards = 1;
+        return true;
+    }
+    try {
+        wait_any_t combined_interruptor(
+            &ct_interruptor, keepalive.get_drain_signal());
+        server->perform_read(read, response_out, &combined_interruptor);
+    } catch (const interrupted_exc_t &) {
+        if (!interruptor->is_pulsed()) {
+            /* The server is shutting down; report the replica as gone rather
+            than interrupting the caller's query. */
+            return false;
+        }
+        throw;
+    }
+    return true;
+}
+
 void direct_query_server_t::on_read(
         signal_t *interruptor,
         const read_t &read,
@@ -33,22 +121,29 @@ void direct_query_server_t::on_read(
     }
 
     try {
-        /* Leave the token empty. We're not actually interested in ordering here. */
-        read_token_t token;
-
-#ifndef NDEBUG
-        metainfo_checker_t metainfo_checker(svs->get_region(),
-            [](const region_t &, const binary_blob_t &) { });
-#endif
-
         read_response_t response;
-        svs->read(DEBUG_ONLY(metainfo_checker, )
-                  read,
-                  &response,
-                  &token,
-                  interruptor);
+        perform_read(read, &response, interruptor);
         send(mailbox_manager, cont, response);
     } catch (const interrupted_exc_t &) {
         /* ignore */
     }
 }
+
+void direct_query_server_t::perform_read(
+        const read_t &read,
+        read_response_t *response_out,
+        signal_t *interruptor) {
+    /* Leave the token empty. We're not actually interested in ordering here. */
+    read_token_t token;
+
+#ifndef NDEBUG
+    metainfo_checker_t metainfo_checker(svs->get_region(),
+        [](const region_t &, const binary_blob_t &) { });
+#endif
+
+    svs->read(DEBUG_ONLY(metainfo_checker, )
+              read,
+              response_out,
+              &token,
+              interruptor);
+}
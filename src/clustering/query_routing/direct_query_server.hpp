@@ -3,6 +3,7 @@
 #define CLUSTERING_QUERY_ROUTING_DIRECT_QUERY_SERVER_HPP_
 
 #include "clustering/query_routing/metadata.hpp"
+#include "concurrency/auto_drainer.hpp"
 #include "concurrency/fifo_checker.hpp"
 
 class store_view_t;
@@ -18,20 +19,44 @@ public:
     direct_query_server_t(
             mailbox_manager_t *mm,
             store_view_t *svs);
+    ~direct_query_server_t();
 
     direct_query_bcard_t get_bcard();
 
+    /* If the mailbox in `bcard` belongs to a `direct_query_server_t` in this
+    process, performs the read directly against its store -- skipping the
+    serialization round trip through the mailbox -- and returns `true`.
+    Returns `false` if the bcard is for another server, or if the server has
+    been destroyed in the meantime; the caller should then fall back to
+    sending to the mailbox. */
+    static bool try_read_local(
+            mailbox_manager_t *mm,
+            const direct_query_bcard_t &bcard,
+            const read_t &read,
+            read_response_t *response_out,
+            signal_t *interruptor);
+
 private:
     void on_read(
             signal_t *interruptor,
             const read_t &,
             const mailbox_addr_t<read_response_t> &);
 
+    void perform_read(
+            const read_t &read,
+            read_response_t *response_out,
+            signal_t *interruptor);
+
     mailbox_manager_t *mailbox_manager;
     store_view_t *svs;
 
     order_source_t order_source;  // TODO: order_token_t::ignore
 
+    /* Keeps track of in-process reads that bypass `read_mailbox`.  Destroyed
+    after `read_mailbox`, so by the time it drains no new reads of either kind
+    can begin. */
+    auto_drainer_t drainer;
+
     direct_query_bcard_t::read_mailbox_t read_mailbox;
 };
 
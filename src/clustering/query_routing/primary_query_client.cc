@@ -26,6 +26,15 @@ primary_query_client_t::primary_query_client_t(
         interruptor)
     { }
 
+/* A note for anyone eyeing the fifo tokens as per-read overhead to optimize
+away: they are what makes a read issued after a write on the same connection
+see that write.  `enter_read()` and the sink exit are plain in-memory queue
+operations -- a read only ever blocks behind this client's own unacknowledged
+writes -- so the bookkeeping itself is nanoseconds; the expensive part of a
+point read is the mailbox hop to the primary, which is inherent to reading
+from the primary.  Clients that don't need the ordering guarantee already
+have an opt-out: `read_mode: "outdated"` skips the primary (and, for
+collocated replicas, the mailbox) entirely. */
 void primary_query_client_t::new_read_token(fifo_enforcer_sink_t::exit_read_t *out) {
     out->begin(&internal_fifo_sink, internal_fifo_source.enter_read());
 }
@@ -79,6 +88,14 @@ void primary_query_client_t::new_write_token(fifo_enforcer_sink_t::exit_write_t
     out->begin(&internal_fifo_sink, internal_fifo_source.enter_write());
 }
 
+/* Every write gets its own reply mailbox and its own reply message. Batching
+the replies of writes that committed together into one message per peer
+wouldn't help much: the reply isn't a bare ack but a full `write_response_t`
+(generated keys, per-document results), so there is little framing overhead to
+save, and replies to the same peer already share one cluster connection. Nor
+do the round trips serialize throughput -- `spawn_request()` doesn't block, so
+many writes are in flight concurrently and each one just waits for its own
+reply. */
 void primary_query_client_t::write(
         const write_t &_write,
         write_response_t *response,
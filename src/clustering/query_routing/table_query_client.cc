@@ -3,6 +3,7 @@
 
 #include <functional>
 
+#include "clustering/query_routing/direct_query_server.hpp"
 #include "clustering/query_routing/primary_query_client.hpp"
 #include "clustering/table_contract/cpu_sharding.hpp"
 #include "clustering/table_manager/multi_table_manager.hpp"
@@ -114,6 +115,14 @@ void table_query_client_t::read(
     user_context.require_read_permission(ctx, table_basic_config.database, table_id);
 
     order_token.assert_read_mode();
+    /* `outdated` is the only read mode that uses replicas, and it comes with no
+    freshness guarantee at all. A bounded-staleness mode in between `outdated`
+    and `single` would need replicas to publish how far they have applied
+    through the directory, and there's no suitable number to publish:
+    `repli_timestamp_t`s are per-shard logical timestamps, so a client can't
+    turn "at most N seconds stale" into a timestamp bound without also
+    distributing the primary's current timestamp, at which point the check is
+    as expensive as asking the primary. */
     if (r.read_mode == read_mode_t::OUTDATED) {
         guarantee(!r.route_to_primary());
         /* This seems kind of silly. We do it this way because
@@ -371,6 +380,7 @@ void table_query_client_t::dispatch_outdated_read(
                     query_state_t::FAILED);
             }
             new_op_info->direct_bcard = chosen_relationship->direct_bcard;
+            new_op_info->is_local = chosen_relationship->is_local;
             new_op_info->keepalive = auto_drainer_t::lock_t(
                 &chosen_relationship->drainer);
             replicas_to_contact.push_back(std::move(new_op_info));
@@ -405,6 +415,21 @@ void table_query_client_t::perform_outdated_read(
     outdated_read_info_t *replica_to_contact = (*replicas_to_contact)[i].get();
 
     try {
+        if (replica_to_contact->is_local) {
+            /* The replica is in this process; read from its store directly,
+            skipping the serialization round trip through the mailbox.  If the
+            server has gone away in the meantime we fall through to the
+            mailbox path, which handles that case the same way it handles a
+            remote replica disappearing. */
+            if (direct_query_server_t::try_read_local(
+                    mailbox_manager,
+                    *replica_to_contact->direct_bcard,
+                    replica_to_contact->sharded_op,
+                    &results->at(i),
+                    interruptor)) {
+                return;
+            }
+        }
         cond_t done;
         mailbox_t<read_response_t> cont(mailbox_manager,
             [&](signal_t *, const read_response_t &res) {
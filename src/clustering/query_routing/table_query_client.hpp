@@ -94,6 +94,9 @@ private:
     public:
         read_t sharded_op;
         const direct_query_bcard_t *direct_bcard;
+        /* If the chosen replica lives in this process, we try to read from its
+        store directly instead of going through the mailbox. */
+        bool is_local;
         auto_drainer_t::lock_t keepalive;
     };
 
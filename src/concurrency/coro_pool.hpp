@@ -8,9 +8,20 @@
 #include "concurrency/interruptor.hpp"
 #include "concurrency/queue/passive_producer.hpp"
 
-/* coro_pool_t maintains a bunch of coroutines; when you give it tasks, it
-distributes them among the coroutines. It draws its tasks from a
-`passive_producer_t`. */
+/* coro_pool_t runs tasks drawn from a `passive_producer_t` on a pool of
+coroutines.  The pool is demand-driven rather than fixed-size: workers are
+spawned as tasks become available, up to `worker_count`, and a worker returns
+its coroutine to the free list as soon as the queue drains, so an idle pool
+holds no coroutines at all.  `worker_count` is therefore a concurrency cap --
+the number of tasks allowed in flight at once (1 makes the pool process tasks
+one at a time, in order) -- not a provisioned thread count that needs tuning
+against load.
+
+Workers inherit the scheduler priority of the coroutine that made the queue
+available (see `coro_t::spawn_sometime`), so a high-priority producer's tasks
+are not processed at a background priority.  Tasks themselves carry no
+priority: a `passive_producer_t` hands out plain `T`s, and a worker serves
+many of them in one life. */
 
 template <class T>
 class coro_pool_callback_t {
@@ -22,9 +22,16 @@ cross_thread_watchable_variable_t<value_t>::cross_thread_watchable_variable_t(
 template <class value_t>
 void cross_thread_watchable_variable_t<value_t>::deliver(
         UNUSED signal_t *interruptor) {
+    /* One copy per change and thread is inherent -- the mirror on
+    `dest_thread` needs its own instance it can read without touching the
+    source thread. But it's one copy, not two: `temp` is ours alone, so it can
+    be moved into place after the thread switch. For values where even the one
+    copy is too much, make the watched type itself a `counted_t` to a
+    immutable value; copying that is a refcount bump, and this template passes
+    it through unchanged. */
     value_t temp = original->get();
     on_thread_t thread_switcher(dest_thread);
-    value = temp;
+    value = std::move(temp);
     publisher_controller.publish([](const std::function<void()> &f) { f(); });
 }
 
@@ -70,9 +77,11 @@ void cross_thread_watchable_map_var_t<key_t, value_t>::deliver(
     std::map<key_t, optional<value_t> > local_changes;
     std::swap(local_changes, queued_changes);
     on_thread_t thread_switcher(output_thread);
-    for (const auto &pair : local_changes) {
+    for (auto &pair : local_changes) {
         if (static_cast<bool>(pair.second)) {
-            output_var.set_key_no_equals(pair.first, *pair.second);
+            /* `local_changes` is discarded after this loop, so the values can
+            be moved into the output map instead of copied. */
+            output_var.set_key_no_equals(pair.first, std::move(*pair.second));
         } else {
             output_var.delete_key(pair.first);
         }
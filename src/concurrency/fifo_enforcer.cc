@@ -50,6 +50,19 @@ void fifo_enforcer_sink_t::exit_read_t::begin(fifo_enforcer_sink_t *p, fifo_enfo
 
     parent->assert_thread();
     mutex_assertion_t::acq_t acq(&parent->internal_lock);
+
+    /* Fast path: if the token is ready to go right now, we don't have to pass
+    through the queue at all. This is the common case -- tokens usually arrive
+    in order -- and it skips a priority queue push and remove per operation.
+    A read is ready as soon as every operation it was ordered after has
+    finished; any write it precedes is still blocked on our (unfinished) read
+    via `num_preceding_reads`, so nothing can have popped past us. */
+    if (token.timestamp == parent->finished_state.last_timestamp) {
+        parent->popped_state.advance_by_read(token);
+        pulse();
+        return;
+    }
+
     parent->internal_read_queue.push(this);
     parent->internal_pump();
 }
@@ -112,6 +125,18 @@ void fifo_enforcer_sink_t::exit_write_t::begin(fifo_enforcer_sink_t *p, fifo_enf
 
     parent->assert_thread();
     mutex_assertion_t::acq_t acq(&parent->internal_lock);
+
+    /* Fast path, as in `exit_read_t::begin()`. A write is ready once the
+    preceding write and all reads ordered between it and us have finished.
+    Timestamps are unique per source, so no queued operation can be ahead of
+    us if these conditions hold. */
+    if (token.timestamp == parent->finished_state.last_timestamp.next() &&
+            token.num_preceding_reads == parent->finished_state.num_reads) {
+        parent->popped_state.advance_by_write(token);
+        pulse();
+        return;
+    }
+
     parent->internal_write_queue.push(this);
     parent->internal_pump();
 }
@@ -7,6 +7,20 @@
 
 class rwlock_in_line_t;
 
+/* A fair reader-writer lock for coroutines. Acquirers are queued in arrival
+order, and `pulse_pulsables()` admits every compatible acquirer in a single
+pass: when a writer releases, the whole run of readers at the head of the
+queue is pulsed in one walk, up to (and including the read signal of) the
+next writer. Readers that arrive while a writer is queued wait behind it, so
+writers can't be starved and read phases and write phases alternate under
+contention -- the same admission order a phase-fair lock gives.
+
+Like the other primitives in `concurrency/`, an `rwlock_t` instance lives on
+one thread and is only touched from that thread's coroutines, so there are no
+atomics or cache-line concerns here; acquisition and release are plain list
+operations. If profiling ever shows convoying on a hot instance (e.g. a
+store's sindex block lock), the queue discipline above means the fix is to
+shorten hold times or split the protected data, not to change the lock. */
 class rwlock_t {
 public:
     rwlock_t();
@@ -22,7 +22,17 @@ visible in the `watchable_map_t` are guaranteed to quickly converge to the corre
 but they could do so in any order. In addition, if a value is changed and then quickly
 changed back, it's possible that no notification will be sent. (The current
 implementation will always deliver notifications in this case, but there's no guarantee.)
-*/
+
+A note on locking, since it trips people up: there is no mutex here. Each instance
+belongs to one thread (`home_thread_mixin_t`), and all reads, writes, and subscriber
+callbacks run as cooperative coroutine code on that thread. `rwi_lock_assertion_t` is a
+debug-mode assertion that catches read/write interleavings across blocking points; in
+release builds it compiles away entirely, so a read is just a `std::map` lookup and
+writers never make readers wait. The flip side is that subscriber callbacks run
+synchronously inside the write and must not block -- a slow callback, not lock
+contention, is what would delay other subscribers. Cross-thread fan-out is deliberately
+not this class's job; per-thread mirrors (e.g. `cross_thread_watchable_map_var_t`) exist
+for that. */
 
 template<class key_t, class value_t>
 class watchable_map_t : public home_thread_mixin_t {
@@ -174,6 +184,7 @@ public:
     `set_key_no_equals()`. */
     void set_key(const key_t &key, const value_t &new_value);
     void set_key_no_equals(const key_t &key, const value_t &new_value);
+    void set_key_no_equals(const key_t &key, value_t &&new_value);
 
     /* `delete_key()` removes `key` from the map if it was present before. */
     void delete_key(const key_t &key);
@@ -31,6 +31,10 @@
 // decrease concurrency
 #define MAX_IO_EVENT_PROCESSING_BATCH_SIZE        50
 
+// A single event callback that keeps the event loop busy for at least this
+// long gets a log warning, since it blocks everything else on its thread.
+#define EVENT_QUEUE_SLOW_CALLBACK_WARNING_MS      100
+
 // The io batch factor ensures a minimum number of i/o operations
 // which are picked from any specific i/o account consecutively.
 // A higher value might be advantageous for throughput if seek times
@@ -66,6 +70,10 @@
 // 0 = minimal priority
 #define SINDEX_POST_CONSTRUCTION_CACHE_PRIORITY   5
 
+// The cache priority for the background leaf defragmentation pass
+// (same scale as SINDEX_POST_CONSTRUCTION_CACHE_PRIORITY).
+#define DEFRAGMENTATION_CACHE_PRIORITY            5
+
 // Size of the buffer used to perform IO operations (in bytes).
 #define IO_BUFFER_SIZE                            (4 * KILOBYTE)
 
@@ -88,13 +96,27 @@
 // The smaller the number, the more effective
 // the merger serializer is in merging index writes
 // together. This is favorable especially on rotational drives.
-// There is a theoretic chance of increased latencies on SSDs for
-// small values of this variable.
-#define MERGER_SERIALIZER_MAX_ACTIVE_WRITES       1
+// Values above 1 let independent index-write batches overlap inside the
+// log serializer: the LBA writes of one batch can proceed while the
+// previous batch waits in line for the metablock manager, which only the
+// metablock writes themselves are ordered through. This keeps the
+// serializer busy on concurrent multi-shard write workloads at a small
+// cost in merging opportunities.
+#define MERGER_SERIALIZER_MAX_ACTIVE_WRITES       4
 
 // I/O priority of block writes in the merger_serializer_t
 #define MERGER_BLOCK_WRITE_IO_PRIORITY            64
 
+// Maximum number of block writes the merger_serializer_t keeps in flight in
+// the disk layer at once.  A flush burst queues thousands of datablock
+// writes; with no bound they fill every slot of the device queue (see
+// DEFAULT_MAX_CONCURRENT_IO_REQUESTS, 64) and a latency-sensitive read waits
+// behind the whole backlog even though its account has more shares --
+// proportional sharing only decides admission order, not how deep the
+// admitted backlog is.  Half the default device concurrency keeps writes
+// saturated while always leaving slots for reads to be scheduled into.
+#define MERGER_BLOCK_WRITE_OUTSTANDING_REQUESTS_LIMIT  32
+
 // Maximum number of threads we support
 // TODO: make this dynamic where possible
 #define MAX_THREADS                               128
@@ -180,13 +202,30 @@
 // 2^(MESSAGE_SCHEDULER_MAX_PRIORITY - MESSAGE_SCHEDULER_MIN_PRIORITY + 1)
 #define MESSAGE_SCHEDULER_GRANULARITY           32
 
-// Priorities for specific tasks
+// The message scheduler keeps, per priority, a one-message slot holding the
+// newest unordered message and runs it before the FIFO backlog: the coroutine
+// that just unblocked is the one whose stack and data are still in cache.
+// MESSAGE_SCHEDULER_LIFO_BURST bounds how many times in a row the slot may
+// bypass the backlog before the scheduler serves the FIFO head instead, so a
+// steady stream of fresh wakeups cannot starve older messages.
+#define MESSAGE_SCHEDULER_LIFO_BURST            4
+
+// Priorities for specific tasks.
+// This is a deliberately coarse two-tier model: queries run at the default
+// priority 0, and known background bulk work is demoted below them. The same
+// split exists for IO through `cache_account_t` (backfill and sindex
+// construction run under low-priority cache accounts). There is no per-query
+// quota on top of this -- queries have no class identity that survives the
+// hop from the query server through the mailboxes to the shards, which is
+// what proportional CPU/IO enforcement between, say, analytic and OLTP
+// queries would need first.
 #define CORO_PRIORITY_SINDEX_CONSTRUCTION       (-2)
 #define CORO_PRIORITY_BACKFILL_SENDER           (-2)
 #define CORO_PRIORITY_BACKFILL_RECEIVER         (-2)
 #define CORO_PRIORITY_RESET_DATA                (-2)
 #define CORO_PRIORITY_DIRECTORY_CHANGES         (-2)
 #define CORO_PRIORITY_LBA_GC                    (-2)
+#define CORO_PRIORITY_DEFRAGMENTATION           (-2)
 
 #endif  // CONFIG_ARGS_HPP_
 
@@ -14,6 +14,7 @@
 #include "containers/archive/versioned.hpp"
 #include "containers/uuid.hpp"
 #include "rpc/serialize_macros.hpp"
+#include "thread_local.hpp"
 
 const char *archive_result_as_str(archive_result_t archive_result) {
     switch (archive_result) {
@@ -58,17 +59,51 @@ int64_t force_read(read_stream_t *s, void *p, int64_t n) {
     return written_so_far;
 }
 
+// A per-thread free list of write_buffer_t's.  A typical mailbox message fits
+// in a single segment, so without this every intracluster message costs a
+// malloc/free pair for its buffer chain.  A buffer goes back to the free list
+// of whichever thread destroys the message, which need not be the thread that
+// allocated it; that's fine, since each list is only ever touched from its own
+// thread, and the cap keeps any one thread from hoarding segments.  The lists
+// themselves are never torn down -- our threads live for the process lifetime.
+static const size_t MAX_POOLED_WRITE_BUFFERS = 16;
+TLS_with_init(intrusive_list_t<write_buffer_t> *, write_buffer_pool, nullptr);
+
+static write_buffer_t *acquire_write_buffer() {
+    intrusive_list_t<write_buffer_t> *pool = TLS_get_write_buffer_pool();
+    if (pool != nullptr && !pool->empty()) {
+        write_buffer_t *buffer = pool->tail();
+        pool->remove(buffer);
+        buffer->size = 0;
+        return buffer;
+    }
+    return new write_buffer_t;
+}
+
+static void release_write_buffer(write_buffer_t *buffer) {
+    intrusive_list_t<write_buffer_t> *pool = TLS_get_write_buffer_pool();
+    if (pool == nullptr) {
+        pool = new intrusive_list_t<write_buffer_t>;
+        TLS_set_write_buffer_pool(pool);
+    }
+    if (pool->size() < MAX_POOLED_WRITE_BUFFERS) {
+        pool->push_back(buffer);
+    } else {
+        delete buffer;
+    }
+}
+
 write_message_t::~write_message_t() {
     while (write_buffer_t *buffer = buffers_.head()) {
         buffers_.remove(buffer);
-        delete buffer;
+        release_write_buffer(buffer);
     }
 }
 
 void write_message_t::append(const void *p, int64_t n) {
     while (n > 0) {
         if (buffers_.empty() || buffers_.tail()->size == write_buffer_t::DATA_SIZE) {
-            buffers_.push_back(new write_buffer_t);
+            buffers_.push_back(acquire_write_buffer());
         }
 
         write_buffer_t *b = buffers_.tail();
@@ -228,6 +228,39 @@ struct serialize_universal_size_t;
         : public std::integral_constant<size_t, sizeof(typ)> { }
 
 
+// Makes a fixed-layout struct serializable by appending (and reading back) its
+// bytes in one call, instead of one archive call per field.  This is only
+// correct when the struct's memory image _is_ its wire format: every field
+// must itself be raw-serializable, the fields must be serialized in
+// declaration order, and there must be no padding (we can't check that
+// directly, but the serialized_size_t specialization below will trip any
+// caller that assumed the field-by-field size).  Note that this makes the
+// struct's layout part of the serialization format -- reordering or resizing
+// fields then becomes a format change like any other.
+#define ARCHIVE_MAKE_FLAT_SERIALIZABLE(typ)                             \
+    static_assert(std::is_trivially_copyable<typ>::value,               \
+                  #typ " must be trivially copyable to be flat-serialized"); \
+    template <cluster_version_t W>                                      \
+    void serialize(write_message_t *wm, const typ &x) {                 \
+        wm->append(&x, sizeof(typ));                                    \
+    }                                                                   \
+                                                                        \
+    template <cluster_version_t W>                                      \
+    MUST_USE archive_result_t deserialize(read_stream_t *s, typ *x) {   \
+        int64_t res = force_read(s, x, sizeof(typ));                    \
+        if (res == -1) {                                                \
+            return archive_result_t::SOCK_ERROR;                        \
+        }                                                               \
+        if (res < int64_t(sizeof(typ))) {                               \
+            return archive_result_t::SOCK_EOF;                          \
+        }                                                               \
+        return archive_result_t::SUCCESS;                               \
+    }                                                                   \
+                                                                        \
+    template <>                                                         \
+    struct serialized_size_t<typ>                                       \
+        : public std::integral_constant<size_t, sizeof(typ)> { }
+
 ARCHIVE_PRIM_MAKE_RAW_SERIALIZABLE(unsigned char);  // NOLINT(runtime/int)
 ARCHIVE_PRIM_MAKE_RAW_SERIALIZABLE(char);          // NOLINT(runtime/int)
 ARCHIVE_PRIM_MAKE_RAW_SERIALIZABLE(signed char);  // NOLINT(runtime/int)
@@ -75,6 +75,17 @@ inline MUST_USE archive_result_t deserialize_reql_version(
 }
 
 
+// A note on dispatch cost, because the switches below look alarming: the
+// `*_for_version` functions are NOT on the per-message path.  Cluster
+// connections refuse to handshake across versions (see
+// `resolve_protocol_version` in rpc/connectivity/cluster.cc, which guarantees
+// `resolved_version == cluster_version_t::CLUSTER`), so mailbox traffic is
+// serialized with the compile-time `cluster_version_t::CLUSTER` constant and
+// never branches on a runtime version.  The runtime dispatch here exists for
+// data tagged with a version at rest -- disk metadata, secondary index
+// definitions, migration paths -- and for the handshake itself, all of which
+// are cold.
+//
 // Serializes a value for a given version.  DOES NOT SERIALIZE THE VERSION NUMBER!
 template <class T>
 void serialize_for_version(cluster_version_t version, write_message_t *wm,
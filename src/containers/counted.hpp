@@ -142,6 +142,20 @@ inline void counted_release(const single_threaded_countable_t<T> *p);
 template <class T>
 inline intptr_t counted_use_count(const single_threaded_countable_t<T> *p);
 
+/* `single_threaded_countable_t` is for objects whose refcount is only ever
+touched on their home thread (streams, vals, term trees): add/release are
+plain increments, and debug builds assert the thread.  Use
+`slow_atomic_countable_t` below when any reference can be taken or dropped on
+another thread.
+
+An audit note, since this comes up whenever someone goes looking for the cost
+of multi-shard reads: datum trees are NOT in the single-threaded camp.
+`datum_t`'s internal nodes (the `countable_wrapper_t` vectors), strings
+(`datum_string_t`) and shared buffers are all atomically refcounted, so
+handing a result datum to another thread already transfers ownership of the
+immutable tree without a deep copy.  What looks like copying in cross-shard
+merges is deserialization of responses that arrived from other servers over
+the network, which no refcounting scheme can remove. */
 template <class T>
 class single_threaded_countable_t : private home_thread_mixin_debug_only_t {
 public:
@@ -258,8 +258,13 @@ public:
     template <class U, void*(*alloc_)(size_t), void(*dealloc_)(void*)>
     friend class scoped_alloc_t;
 
+    // Tag type for adopting a buffer that was previously release()d (or that
+    // came out of some pool of buffers allocated with the same allocator).
+    struct adopt_t { };
+
     scoped_alloc_t() : ptr_(nullptr) { }
     explicit scoped_alloc_t(size_t n) : ptr_(static_cast<T *>(alloc(n))) { }
+    scoped_alloc_t(adopt_t, T *ptr) : ptr_(ptr) { }
     scoped_alloc_t(const void *beg, size_t n) {
         ptr_ = static_cast<T *>(alloc(n));
         memcpy(ptr_, beg, n);
@@ -296,6 +301,14 @@ public:
         return ptr_ != nullptr;
     }
 
+    // Relinquishes ownership without deallocating.  The caller is responsible
+    // for eventually passing the pointer to `dealloc` (or adopting it back).
+    T *release() {
+        T *ptr = ptr_;
+        ptr_ = nullptr;
+        return ptr;
+    }
+
     void reset() {
         scoped_alloc_t tmp;
         swap(tmp);
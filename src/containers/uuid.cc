@@ -114,6 +114,12 @@ void initialize_dev_random_uuid() {
     TLS_set_next_uuid(next_uuid);
 }
 
+/* Note on cost: this does *not* hit a lock or the system CSPRNG per call.
+Each thread seeds a 128-bit counter from the system entropy source exactly
+once and then derives every subsequent UUID by incrementing the counter and
+SHA-1 hashing it, so generating 10k keys on an insert-heavy path costs 10k
+short hashes and zero syscalls. The hash is what makes consecutive ids
+non-adjacent; the per-thread counter is what makes them unique. */
 uuid_u generate_uuid() {
     if (!TLS_get_next_uuid_initialized()) {
         initialize_dev_random_uuid();
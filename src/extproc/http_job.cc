@@ -543,7 +543,14 @@ void set_default_opts(CURL *curl_handle,
 
 // TODO: implement streaming API support
 void perform_http(http_opts_t *opts, http_result_t *res_out) {
-    scoped_curl_handle_t curl_handle;
+    // The handle is reused for every request this worker process serves.
+    // libcurl keeps its connection cache, DNS cache and TLS session ids
+    // inside the easy handle, so reuse turns the successive pages of a
+    // depaginated stream (and any other requests that land on this worker)
+    // into keep-alive requests on an already-open connection instead of a
+    // fresh TCP and TLS handshake each time. Workers serve one request at a
+    // time, so there is no concurrent access to the handle.
+    static scoped_curl_handle_t curl_handle;
     curl_data_t curl_data;
 
     if (curl_handle.get() == nullptr) {
@@ -551,6 +558,14 @@ void perform_http(http_opts_t *opts, http_result_t *res_out) {
         return;
     }
 
+    // Wipe the options left over from the previous request; the caches named
+    // above survive a reset. Cookies survive too, and one query's cookies
+    // must not leak into another's, so clear them explicitly --
+    // `transfer_cookies` re-adds the ones this request carries over from its
+    // own earlier pages.
+    curl_easy_reset(curl_handle.get());
+    exc_setopt(curl_handle.get(), CURLOPT_COOKIELIST, "ALL", "CLEAR COOKIES");
+
     set_default_opts(curl_handle.get(), opts->proxy, curl_data);
     transfer_opts(opts, curl_handle.get(), &curl_data);
 
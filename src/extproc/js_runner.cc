@@ -117,9 +117,14 @@ js_result_t js_runner_t::eval(const std::string &source,
 
     js_result_t result;
 
-    // Check if this is a function we already have cached
+    // Check if this is a function we already have cached. Refresh the
+    // timestamp so that `trim_cache` evicts by last use rather than by when
+    // the function was first compiled -- per-row functions in a long `map`
+    // or `filter` hit this path once per row and must not be the ones
+    // evicted.
     auto it = job_data->id_cache.find(source);
     if (it != job_data->id_cache.end()) {
+        it->second.timestamp = get_kiloticks();
         result = it->second.id;
         return result;
     }
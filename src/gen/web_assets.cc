@@ -1,11 +1,10 @@
 
 // Generated by scripts/compile-web-assets.py
 
-#include <map>
-#include <string>
+#include "http/web_assets.hpp"
 
-std::map<std::string, const std::string> static_web_assets = {
-    { "/cluster-min.js", std::string(
+std::map<std::string, const static_web_asset_t> static_web_assets = {
+    { "/cluster-min.js", { { {
       "(function e(t,n,r){function s(o,u){if(!n[o]){if(!t[o]){var a=typeof require="
       "=\"function\"&&require;if(!u&&a)return a(o,!0);if(i)return i(o,!0);var f=new"
       " Error(\"Cannot find module '\"+o+\"'\");throw f.code=\"MODULE_NOT_FOUND\",f"
@@ -896,7 +895,8 @@ std::map<std::string, const std::string> static_web_assets = {
       ");this.extra_suggestions=b}this.extra_suggestions.length>0&&($=this.codemirr"
       "or.getValue(),W=this.extra_suggestion.start_body,null!=(null!=(P=this.extra_"
       "suggestion.body)&&null!=(V=P[0])?V.name.length:void 0)&&(W+=this.extra_sugge",
-      65518) + std::string(
+      65518 },
+      {
       "stion.body[0].name.length),n=$.indexOf(\")\",W),this.query_last_part=\"\",n!"
       "==-1&&(this.query_last_part=$.slice(n)),this.query_first_part=$.slice(0,this"
       ".extra_suggestion.start_body),y=this.query_first_part.split(\"\\n\"),e.shift"
@@ -1776,7 +1776,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "),this.container.$(\".nano\").height(this.height_history)},e.prototype.handl"
       "e_mouseup=function(t){if(this.mouse_down===!0)return this.mouse_down=!1,$(\""
       ".nano\").nanoScroller({preventPageScrolling:!0}),$(\"body\").toggleClass(\"r",
-      65471) + std::string(
+      65471 },
+      {
       "esizing\",!1)},e.prototype.initialize=function(t){return this.container=t.co"
       "ntainer,this.history=t.history,this.height_history=204},e.prototype.render=f"
       "unction(t){var e,i,s,r,n;if(this.$el.html(this.dataexplorer_history_template"
@@ -2673,7 +2674,8 @@ std::map<std::string, const std::string> static_web_assets = {
       ".parent-title\",[\"Table \",h(\"a\",{href:\"#/tables/\"+r.id},r.db+\".\"+r.n"
       "ame)])),h(\"ul.children\",r.shards.map(render_shard))])},render_shard=functi"
       "on(r){return h(\"li.child\",[h(\"span.child-name\",[\"Shard \"+r.shard_id+\"",
-      65493) + std::string(
+      65493 },
+      {
       "/\"+r.total_shards]),h(\"span.child-role.\"+util.replica_roleclass(r),util.r"
       "eplica_rolename(r))])},exports.Model=Model,exports.View=View;\n"
       "},{\"../util.coffee\":\"/home/srh/rethinkdb/admin/static/coffee/util.coffee\""
@@ -3564,7 +3566,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "uire(\"../../handlebars/abstract-modal-outer.hbs\"),e.prototype.error_templa"
       "te=require(\"../../handlebars/error_input.hbs\"),e.prototype.events={\"click"
       " .cancel\":\"cancel_modal\",\"click .close_modal\":\"cancel_modal\",\"click ",
-      65499) + std::string(
+      65499 },
+      {
       ".btn-primary\":\"abstract_submit\",\"keypress input\":\"check_keypress_is_en"
       "ter\",\"click .alert .close\":\"close_error\",\"click .change-route\":\"rero"
       "ute\"},e.prototype.close_error=function(t){return t.preventDefault(),$(t.cur"
@@ -4488,7 +4491,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "ata '+(null!=(s=e.if.call(n,null!=n?n.floating_metadata:n,{name:\"if\",hash:"
       "{},fn:this.program(3,l,0),inverse:this.noop,data:l}))?s:\"\")+\" \"+(null!=("
       "s=e.if.call(n,null!=(s=null!=n?n.feed:n)?s.paused:s,{name:\"if\",hash:{},fn:",
-      65461) + std::string(
+      65461 },
+      {
       "this.program(5,l,0),inverse:this.program(7,l,0),data:l}))?s:\"\")+'\">\\n'+("
       "null!=(s=e.if.call(n,null!=n?n.feed:n,{name:\"if\",hash:{},fn:this.program(9"
       ",l,0),inverse:this.program(14,l,0),data:l}))?s:\"\")+'    </p>\\n</div>\\n<d"
@@ -5441,7 +5445,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "me:\"max_value\",hash:{},data:l}):r))+\" \"+u((a.pluralize_noun||n&&n.plural"
       "ize_noun||i).call(n,\"replica\",null!=n?n.num_replicas:n,{name:\"pluralize_n"
       "oun\",hash:{},data:l}))+(null!=(t=a.if.call(n,null!=n?n.total_blocks:n,{name",
-      65479) + std::string(
+      65479 },
+      {
       ":\"if\",hash:{},fn:this.program(11,l,0),inverse:this.program(13,l,0),data:l}"
       "))?t:\"\")+\"  </p>\\n\"},11:function(n,a,e,l){var t,r=a.helperMissing,i=\"f"
       "unction\",s=this.escapeExpression;return\",\\n    \"+s((t=null!=(t=a.replica"
@@ -6356,7 +6361,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "type.ineg=function(){return this.isZero()||(this.negative^=1),this},n.protot"
       "ype.iuor=function(t){for(;this.length<t.length;)this.words[this.length++]=0;"
       "for(var i=0;i<t.length;i++)this.words[i]=this.words[i]|t.words[i];return thi",
-      65483) + std::string(
+      65483 },
+      {
       "s.strip()},n.prototype.ior=function(t){return r(0===(this.negative|t.negativ"
       "e)),this.iuor(t)},n.prototype.or=function(t){return this.length>t.length?thi"
       "s.clone().ior(t):t.clone().ior(this)},n.prototype.uor=function(t){return thi"
@@ -7253,7 +7259,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "(\"./aes\"),Transform=require(\"cipher-base\"),inherits=require(\"inherits\""
       ");inherits(StreamCipher,Transform),module.exports=StreamCipher,StreamCipher."
       "prototype._update=function(e){return this._mode.encrypt(this,e,this._decrypt",
-      65468) + std::string(
+      65468 },
+      {
       ")},StreamCipher.prototype._final=function(){this._cipher.scrub()};\n"
       "}).call(this,require(\"buffer\").Buffer)\n"
       "},{\"./aes\":\"/home/srh/rethinkdb/build/external/admin-deps_2.0.4/node_modu"
@@ -8199,7 +8206,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "function MillerRabin(r){this.rand=r||new brorand.Rand}var bn=require(\"bn.js"
       "\"),brorand=require(\"brorand\");module.exports=MillerRabin,MillerRabin.crea"
       "te=function(r){return new MillerRabin(r)},MillerRabin.prototype._rand=functi",
-      65529) + std::string(
+      65529 },
+      {
       "on(r){var n=r.bitLength(),e=this.rand.generate(Math.ceil(n/8));e[0]|=3;var t"
       "=7&n;return 0!==t&&(e[e.length-1]>>=7-t),new bn(e)},MillerRabin.prototype.te"
       "st=function(r,n,e){var t=r.bitLength(),a=bn.mont(r),i=new bn(1).toRed(a);n||"
@@ -9084,7 +9092,8 @@ std::map<std::string, const std::string> static_web_assets = {
       ",\"9a1af0b26a6a4807add9a2daf71df262465152bc3ee24c65e899be932385a2a8\"],[\"a5"
       "76df8e23a08411421439a4518da31880cef0fba7d4df12b1a6973eecb94266\",\"40a6bf20e"
       "76640b2c92b97afe58cd82c432e10a7f514d9f3ee8be11ae1b28ec8\"],[\"7778a78c28dec3",
-      65460) + std::string(
+      65460 },
+      {
       "e30a05fe9629de8c38bb30d1f5cf9a3a208f763889be58ad71\",\"34626d9ab5a5b22ff7098"
       "e12f2ff580087b38411ff24ac563b513fc1fd9f43ac\"],[\"928955ee637a84463729fd30e7"
       "afd2ed5f96274e5ad7e5cb09eda9c06d903ac\",\"c25621003d3f42a827b78a13093a95eeac"
@@ -10066,7 +10075,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "odules/parse-asn1/node_modules/asn1.js/lib/asn1/constants/index.js\",\"./asn"
       "1/decoders\":\"/home/srh/rethinkdb/build/external/admin-deps_2.0.4/node_modu"
       "les/rethinkdb-webui/node_modules/browserify/node_modules/crypto-browserify/n",
-      65503) + std::string(
+      65503 },
+      {
       "ode_modules/parse-asn1/node_modules/asn1.js/lib/asn1/decoders/index.js\",\"."
       "/asn1/encoders\":\"/home/srh/rethinkdb/build/external/admin-deps_2.0.4/node_"
       "modules/rethinkdb-webui/node_modules/browserify/node_modules/crypto-browseri"
@@ -10978,7 +10988,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "===t.length&&t.ended?endReadable(this):emitReadable(this),null;if(e=howMuchT"
       "oRead(e,t),0===e&&t.ended)return 0===t.length&&endReadable(this),null;var n="
       "t.needReadable;debug(\"need readable\",n),(0===t.length||t.length-e<t.highWa",
-      65494) + std::string(
+      65494 },
+      {
       "terMark)&&(n=!0,debug(\"length less than watermark\",n)),t.ended||t.reading?"
       "(n=!1,debug(\"reading or ended\",n)):n&&(debug(\"do read\"),t.reading=!0,t.s"
       "ync=!0,0===t.length&&(t.needReadable=!0),this._read(t.highWaterMark),t.sync="
@@ -11904,7 +11915,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "},data:function(e,r){for(;e&&r--;)e=e._parent;return e},merge:function(e,r){"
       "var t=e||r;return e&&r&&e!==r&&(t=Utils.extend({},r,e)),t},noop:r.VM.noop,co"
       "mpilerInfo:e.compiler};return a.isTop=!0,a._setup=function(t){t.partial?(n.h",
-      65472) + std::string(
+      65472 },
+      {
       "elpers=t.helpers,n.partials=t.partials):(n.helpers=n.merge(t.helpers,r.helpe"
       "rs),e.usePartial&&(n.partials=n.merge(t.partials,r.partials)))},a._child=fun"
       "ction(r,t,a,i){if(e.useBlockParams&&!a)throw new _Exception2.default(\"must "
@@ -12818,7 +12830,8 @@ std::map<std::string, const std::string> static_web_assets = {
       ",a,n,o=e.childNodes,d={},i=0;i<r.removes.length;i++)a=r.removes[i],t=o[a.fro"
       "m],a.key&&(d[a.key]=t),e.removeChild(t);for(var c=o.length,p=0;p<r.inserts.l"
       "ength;p++)n=r.inserts[p],t=d[n.key],e.insertBefore(t,n.to>=c++?null:o[n.to])",
-      65506) + std::string(
+      65506 },
+      {
       "}function replaceRoot(e,r){return e&&r&&e!==r&&e.parentNode&&e.parentNode.re"
       "placeChild(r,e),r}var applyProperties=require(\"./apply-properties\"),isWidg"
       "et=require(\"../vnode/is-widget.js\"),VPatch=require(\"../vnode/vpatch.js\")"
@@ -13710,7 +13723,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "UNION,e.prototype.mt=\"setUnion\",e}(RDBOp),SetIntersection=function(t){func"
       "tion e(){return e.__super__.constructor.apply(this,arguments)}return extend("
       "e,t),e.prototype.tt=protoTermType.SET_INTERSECTION,e.prototype.mt=\"setInter",
-      65488) + std::string(
+      65488 },
+      {
       "section\",e}(RDBOp),SetDifference=function(t){function e(){return e.__super_"
       "_.constructor.apply(this,arguments)}return extend(e,t),e.prototype.tt=protoT"
       "ermType.SET_DIFFERENCE,e.prototype.mt=\"setDifference\",e}(RDBOp),Slice=func"
@@ -14584,7 +14598,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "ReqlServerCompileError,e,h)),this._delQuery(r);case protoResponseType.CLIENT"
       "_ERROR:return t(mkErr(err.ReqlDriverError,e,h)),this._delQuery(r);case proto"
       "ResponseType.RUNTIME_ERROR:return n=util.errorClass(e.e),t(mkErr(n,e,h)),thi",
-      65461) + std::string(
+      65461 },
+      {
       "s._delQuery(r);case protoResponseType.SUCCESS_ATOM:return e=mkAtom(e,l),Arra"
       "y.isArray(e)&&(e=cursors.makeIterable(e)),null!=a&&(e={profile:a,value:e}),t"
       "(null,e),this._delQuery(r);case protoResponseType.SUCCESS_PARTIAL:for(o=null"
@@ -15464,7 +15479,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "yValues=function(){return!1},o.prototype.getActualLength=function(t){return "
       "t>>1},e.prototype.props=function(){return s(this)},e.props=function(t){retur"
       "n s(t)}}},{\"./es5.js\":14,\"./util.js\":38}],28:[function(t,e,r){\"use stri",
-      65513) + std::string(
+      65513 },
+      {
       "ct\";function n(t,e,r,n,i){for(var o=0;o<i;++o)r[o+n]=t[o+e],t[o+e]=void 0}f"
       "unction i(t){this._capacity=t,this._length=0,this._front=0}i.prototype._will"
       "BeOverCapacity=function(t){return this._capacity<t},i.prototype._pushOne=fun"
@@ -15826,8 +15842,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "ckages/js/node_modules/bluebird/js/browser/bluebird.js\"}]},{},[\"/home/srh/"
       "rethinkdb/admin/static/coffee/body.coffee\",\"rethinkdb-version\",\"rethinkd"
       "b\"]);\n",
-      26526 ) },
-    { "/cluster.css", std::string(
+      26526 } } } },
+    { "/cluster.css", { { {
       "article,\n"
       "aside,\n"
       "details,\n"
@@ -19078,7 +19094,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  content: \"\\f459\";\n"
       "}\n"
       ".ion-ios-medical:before {\n",
-      65471) + std::string(
+      65471 },
+      {
       "  content: \"\\f45c\";\n"
       "}\n"
       ".ion-ios-medical-outline:before {\n"
@@ -21617,7 +21634,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  background-image: -webkit-gradient(linear,left bottom,left top,color-stop("
       "0%,rgba(255,255,255,.02)),color-stop(100%,rgba(0,0,0,.02)));\n"
       "  background-image: -webkit-linear-gradient(bottom, rgba(255,255,255,.02) 0%",
-      65504) + std::string(
+      65504 },
+      {
       ", rgba(0,0,0,.02) 100%);\n"
       "  background-image: -o-linear-gradient(bottom, rgba(255,255,255,.02) 0%, rgb"
       "a(0,0,0,.02) 100%);\n"
@@ -23880,7 +23898,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  margin-left: 19px;\n"
       "}\n"
       "#database-view .tree-view li.parent .parent-info p,\n",
-      65460) + std::string(
+      65460 },
+      {
       "#table-view .tree-view li.parent .parent-info p,\n"
       "#datacenter-view .tree-view li.parent .parent-info p,\n"
       "#server-view .tree-view li.parent .parent-info p,\n"
@@ -25914,8 +25933,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  background-color: transparent;\n"
       "  color: #f7ae41;\n"
       "}\n",
-      63633 ) },
-    { "/favicon.ico", std::string(
+      63633 } } } },
+    { "/favicon.ico", { { {
       "\0\0\1\0\2\0\x10\x10\0\0\1\0\b\0h\5\0\0&\0\0\0  \0\0\1\0 \0\xa8\x10\0\0\x8e\5"
       "\0\0(\0\0\0\x10\0\0\0 \0\0\0\1\0\b\0\0\0\0\0\0\1\0\0\x12\v\0\0\x12\v\0\0\0\1"
       "\0\0\0\1\0\0\"\"\"\0$$$\0&&&\0'''\0+++\0,,,\0---\0\x30\x30\x30\0\x33\x33\x33"
@@ -26118,8 +26137,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\0\0\0",
-      5686 ) },
-    { "/index.html", std::string(
+      5686 } } } },
+    { "/index.html", { { {
       "<!DOCTYPE html>\n"
       "<html>\n"
       "    <head>\n"
@@ -26202,8 +26221,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "        <div class=\"alert global_loading\">Loading...</div>\n"
       "    </body>\n"
       "</html>\n",
-      4283 ) },
-    { "/images/clock-icon_alt.png", std::string(
+      4283 } } } },
+    { "/images/clock-icon_alt.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\xe\0\0\0\xe\b\6\0\0\0\x1fH-\xd1\0\0\0\x19tEXtSoftware\0\x41"
@@ -26231,8 +26250,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "%\xca\xa6\n"
       "\3X\x80\xebx\xe4Na*\xa7X/\xea\xf9]<\xab\x41\xffX\x8f\x86\xfc\x19\xce\xf5\xd7"
       "\xdf>\xff\b0\0\x89\xdcL\xff\x87\xa4\4]\0\0\0\0IEND\xae\x42`\x82",
-      1199 ) },
-    { "/images/layers-exclamation-icon.png", std::string(
+      1199 } } } },
+    { "/images/layers-exclamation-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\x11\b\6\0\0\0;mG\xfa\0\0\0\6\x62KGD\0\xff\0\xff"
@@ -26259,8 +26278,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x7f\xae\xfa\x7f\x9ct\xe1\xc4I\xdf\x12\x91\xf9z\xbdn\xc3\x30\x94\x30\f\xa5\xd1"
       "hHR%\x11\x19\xfa\x41\xfb\x86%\xe0P\xf8\x37\x44);\xb7\x97\x38K<\0\0\0\0IEND\xae"
       "B`\x82",
-      619 ) },
-    { "/images/status_panel-icon_3-error.png", std::string(
+      619 } } } },
+    { "/images/status_panel-icon_3-error.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0/\0\0\0/\b\6\0\0\0s'\x93\xac\0\0\0\x19tEXtSoftware\0\x41\x64"
@@ -26306,8 +26325,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "O\xe1)<\x85\xa7\xf0\x14\x9e\xc2\xb7\x1f>\xaa\x38h\xb3Y\x82\xbf\xce\x98L\x15\xa5"
       "\x80\xb3\x16\v\xcc\xb7\xc6\xc5\xdb\x98XU\xbev<\v^B\xed\xf\x14N\x85\x8c\xe1\xa7"
       "\xe0\x37\x7f\v0\0\x15XgE\x97\b\xf4\x63\0\0\0\0IEND\xae\x42`\x82",
-      1611 ) },
-    { "/images/server-icon-removed.png", std::string(
+      1611 } } } },
+    { "/images/server-icon-removed.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x1b\0\0\0\x14\b\6\0\0\0|\x82\x46\x80\0\0\0\6\x62KGD\0\0\0"
@@ -26336,8 +26355,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "9J\xb3\xd6\xfez<\x97\xe3p\xb8s\x85\xbd\xc6\x96(\xcd\xda\xfc\xf\xcb\x93\xb8\x31"
       "O\xe2\ay\x12\x37\xd6\xea\xfb\x13\x94\xf1\xbb\xe9\x85\xc3\x90\xbd\0\0\0\0IEND"
       "\xae\x42`\x82",
-      686 ) },
-    { "/images/cog_16x16.png", std::string(
+      686 } } } },
+    { "/images/cog_16x16.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -26347,8 +26366,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x8a\xb1\xc9\xa1\x38\xff<>\5\x38,8\xf\xf3\6\x36'\x1a`1\xc0\1\x87Z\xca\r\xa0\xd8"
       "\v\x84\2\xd1\x80P R%\x1a)NH\x14'e\x8a\x33\x13\xd9\xd9\x19\0\xd0\x12\x91\x81\x62"
       "Cj\xcd\0\0\0\0IEND\xae\x42`\x82",
-      210 ) },
-    { "/images/green-light.png", std::string(
+      210 } } } },
+    { "/images/green-light.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\v\0\0\0\v\b\6\0\0\0\xa9\xacw&\0\0\0\x19tEXtSoftware\0\x41"
@@ -26379,8 +26398,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xf4Y\xa0\x63\x13\4\xef\xe0\xb8/\xc1Z\xb9\xd0\xba\xf9\xfe\xacV\xf2\x9f\6\x33"
       "\xe1\3\xae\x44\x42\xd9\xc2T\x16\x8f\xa0\xc5+\xb2\1\x87\x8d\xdbN\xbe\xbc\xdf\xbc"
       "\xd6Z\xe7S\x80\1\0\xae\x64\x95\t2\xed\xb0u\0\0\0\0IEND\xae\x42`\x82",
-      1218 ) },
-    { "/images/resolve_issue-danger_icon.png", std::string(
+      1218 } } } },
+    { "/images/resolve_issue-danger_icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -26405,8 +26424,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xa0\3\xc4>84\xc3\3\x91\1\xc9\x10\xe4\0\xfa\5\xc4O\xb0x\1\xae\x19=)\xa3\x1b\x82"
       "\xcd\v(\x9a\xb1\xe5\5tCx\xf1i\xc6\x95\x17\xb0\x85\tV\xcd\xf8r#\xcc\x90\x1fP~"
       "\x11\xae\xec\f\x10`\0|\b55\b\x9a\xdf\xb0\0\0\0\0IEND\xae\x42`\x82",
-      1118 ) },
-    { "/images/query_shard_access-icon.png", std::string(
+      1118 } } } },
+    { "/images/query_shard_access-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\3\0\0\0(-\xfS\0\0\0\x19tEXtSoftware\0\x41"
@@ -26418,8 +26437,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "!L\xc2$\xd0w@{\xd2!\x80K!\rh\xe2\x44\xc7\xa2\xfb\x93\2\x94\xd0\x10U\x89\xd1Z"
       "w\xf4\xa1\x80\xad\xec\x30\xc7\xff\x1f:8\x8a\xf4\x9aH>\xb1\x96\xcc\x81<\5\x18"
       "\0\xe3s\t\x15.I\x11i\0\0\0\0IEND\xae\x42`\x82",
-      259 ) },
-    { "/images/green-light_glow_small.png", std::string(
+      259 } } } },
+    { "/images/green-light_glow_small.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\xf\0\0\0\xf\b\6\0\0\0;\xd6\x95J\0\0\0\x19tEXtSoftware\0\x41"
@@ -26459,8 +26478,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xb4\x9e\x46\x64\x62\x36'\xa8\5\xaf\xb0\xe5n\x98q\x18W\x8d\x39\x46\xa3iU\xeb"
       "\xec\xb0\x44\x10\xaf\x8a\xd9\xf8\x8f\x31t\xdc\xac\x9c&7\v`\xe6h\xc6\x61\\5\xe6"
       "\f5\xba(_zp\xe2\xef\2\xfc\x11`\0\xe3\xccSPu\xd6%p\0\0\0\0IEND\xae\x42`\x82",
-      1511 ) },
-    { "/images/book_alt_16x16.png", std::string(
+      1511 } } } },
+    { "/images/book_alt_16x16.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -26468,8 +26487,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "`8\xf8Om\3\xf0\1\a4\xb5\xe7)1\0\xa4Y\0\x97\1\xe\x44\x88\xcf\xc7\xe7\5\a\"\xc5"
       "\xe7\xe3\x32@\0\xaa\x18\x19\xa3\x1b\0\x17'7\f(\x8e\x85Q\3hi\0\xc9\x99\x89\xa2"
       "\xec\f\0so\x90u`\x8dNc\0\0\0\0IEND\xae\x42`\x82",
-      169 ) },
-    { "/images/query_server_time-icon.png", std::string(
+      169 } } } },
+    { "/images/query_server_time-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\3\0\0\0(-\xfS\0\0\0\x19tEXtSoftware\0\x41"
@@ -26483,8 +26502,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\5\xaa\xc8\xe9\xfn\x10\x19[ K\xb6\xa2$\x9bnE\xd3\x1c\xbb\xb4\xc6\xe6\x62\xe9"
       "\xedY\x9d\xef\xea\xbf\xe3>\xe7_\2\f\0\xa0\x19\6\xf7]\x83\xeaR\0\0\0\0IEND\xae"
       "B`\x82",
-      284 ) },
-    { "/images/graph-icon.png", std::string(
+      284 } } } },
+    { "/images/graph-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x14\0\0\0\x12\b\6\0\0\0[\xd0\xfe\x10\0\0\0\x19tEXtSoftwar"
@@ -26513,8 +26532,8 @@ std::map<std::string, const std::string> static_web_assets = {
       ".\xe6\x31\x8b\xf}w\x84\\\\\xd8_'eK\x8f<\x8aU|[\x8c\xde\x85\xfa\xd7,\xf7\xe3."
       "\xe1\xd4\xd4$\xf0U{\xb0\x64\x30\x86\xbb\x12\xb8\x84Mt\x1b\4\xd6\x7f\4\x18\0\xf8"
       "\2<\xdcue\x81\xc2\0\0\0\0IEND\xae\x42`\x82",
-      1215 ) },
-    { "/images/resolve_issue-details_icon.png", std::string(
+      1215 } } } },
+    { "/images/resolve_issue-details_icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -26540,8 +26559,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "@\xb9\xeb.43\xc9@\xc5\x9e\1\xf1q ^\xe\xc4;\xd0\x33\x93=\x10;\0\xf1\x41\xa8\x41"
       "\aH\t\b\x90\1\x8eP|\x80\x9ch\0\b0\0\xbf\xf5(\xb0\5\n"
       "\xe9\xa4\0\0\0\0IEND\xae\x42`\x82",
-      1140 ) },
-    { "/images/list-horiz-dash.png", std::string(
+      1140 } } } },
+    { "/images/list-horiz-dash.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\b\0\0\0\1\b\6\0\0\0\xe3\0\xef\x43\0\0\0\x19tEXtSoftware\0"
@@ -26559,8 +26578,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "on> </rdf:RDF> </x:xmpmeta> <?xpacket end=\"r\"?>\xa8\xbf\b'\0\0\0\x1aIDATx\xda"
       "b\xdc\xb0\x61\xc3n\6\4X\xed\xef\xef?\v\x89\xcf\0\x10`\0vq\4\xff\xfb\r\x84\xd7"
       "\0\0\0\0IEND\xae\x42`\x82",
-      936 ) },
-    { "/images/query_round_trip-icon.png", std::string(
+      936 } } } },
+    { "/images/query_round_trip-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\3\0\0\0(-\xfS\0\0\0\x19tEXtSoftware\0\x41"
@@ -26573,8 +26592,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xd0N\v@\xd7\r\xd9\xd5\xac\xcd\x17\4\f\xa3XJ\2\xa6\x1bu\x93\x17x\xa3\6\xf4\xb8"
       "\xab\xec\x19\x66%\a\xab\x83\xe5\x93\xafr\x83\xa2\xbapJB\xfa\xeb\xf7\xed\xad\x43"
       "\x80\1\0\x96\x92\b\x96\x84\x93\x1c\x89\0\0\0\0IEND\xae\x42`\x82",
-      287 ) },
-    { "/images/status_panel-icon_2-error.png", std::string(
+      287 } } } },
+    { "/images/status_panel-icon_2-error.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0/\0\0\0/\b\6\0\0\0s'\x93\xac\0\0\0\x19tEXtSoftware\0\x41\x64"
@@ -26611,8 +26630,8 @@ std::map<std::string, const std::string> static_web_assets = {
       ";\xb4\xaa&\xf1\xed\x92\xa2\xc4y\x81\xcb\xf9\xf9P;\xbbh{I\x1f\x89W\x8b\xe7\x16"
       "\x9a\x91\xf8\3\x45\t'\xdf\xe1\x82\x8c\x8ew\1\6\0>\xbc\xc6\xee\2\xb0#[\0\0\0\0"
       "IEND\xae\x42`\x82",
-      1414 ) },
-    { "/images/layers-icon.png", std::string(
+      1414 } } } },
+    { "/images/layers-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\x11\b\6\0\0\0;mG\xfa\0\0\0\x19tEXtSoftware\0\x41"
@@ -26640,8 +26659,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\b\x13P\2l\x18\r\x13*\x85\tL3,L\x18\xb1\x15\5\xc8\x86!\x87\t\xb2\x66\xe4\xa2"
       "\x80\x11Oy\2\x36\f\xb9LA\xd6\x8cl\b@\x80\1\0\xdc\x9b\3s\xf4\xf0\xf2M\0\0\0\0"
       "IEND\xae\x42`\x82",
-      1203 ) },
-    { "/images/globe-icon_white.png", std::string(
+      1203 } } } },
+    { "/images/globe-icon_white.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -26672,8 +26691,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe4\xcc\xe5\x14\x39\xc4\xa5\x99K$\xd6\xb3\5\xb2\xcb\x14w\xb9Lq\xb7\xcb\x64\xaf"
       "\xf3*\xc6\xff\xbb\xce\xdf\2\f\0\xed\xc0\x1c\x10\xa2\xd4\x64]\0\0\0\0IEND\xae"
       "B`\x82",
-      1244 ) },
-    { "/images/resolve_issue-clock_icon.png", std::string(
+      1244 } } } },
+    { "/images/resolve_issue-clock_icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\xf\0\0\0\xe\b\6\0\0\0\xf0\x8a\x46\xef\0\0\0\x19tEXtSoftwa"
@@ -26702,8 +26721,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x1f\xe3\x1c\xad\xb8\x41\5\xa3\xe8\xd1\xb5\xa2u\x8b_\xa8UC\xe2z\xbbQ{\xe6\xc3"
       "\xbep\a\xcby{\xfa\xde\xae\xa9\x7f\xf\xdc\x8f\x61\r\xf2\xd1\xe8\xc7\xf8\x17`\0"
       "\xce\x32H\x81\\\x15\x62\x31\0\0\0\0IEND\xae\x42`\x82",
-      1230 ) },
-    { "/images/resolve_issue-message_icon.png", std::string(
+      1230 } } } },
+    { "/images/resolve_issue-message_icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -26724,8 +26743,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x80x>.y\x16\2\x16h\2\xf1* \xd6\xc1\xe7\2\x46\x34\f\3\t@|\6\x88\xbf\1\xb1\n"
       "\x16u`\x8c/\f\xe6\0q\x1f\x10[\3\xf1]b\xf2\2\x32x\b\xc4\xd1@|\x94\x9cXX\6\xc4"
       "\xfa\xc4h\6\1\x80\0\3\0\x83\xdb\x16\x38\x95\xcfH\xf4\0\0\0\0IEND\xae\x42`\x82",
-      1019 ) },
-    { "/images/document-icon.png", std::string(
+      1019 } } } },
+    { "/images/document-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\xf\0\0\0\x11\b\6\0\0\0\2\n"
@@ -26749,8 +26768,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "I\x8d\xaaQ\xcd\xd4\xd2\fO$\xaf^\xbd\2\x61P\xe\xab\xa0\x8b\xcd\f\xff\xff\xff\a"
       "\xe1\x8a\xff\xa4\x83v\x80\0\3\0\xc8\x8ap\xe0\x8a[\x83\x1c\0\0\0\0IEND\xae\x42"
       "`\x82",
-      1078 ) },
-    { "/images/live-icon.png", std::string(
+      1078 } } } },
+    { "/images/live-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\x11\b\6\0\0\0;mG\xfa\0\0\0\x19tEXtSoftware\0\x41"
@@ -26797,8 +26816,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "^c\x8a\xf7\1\xaf\xd7\x1a\xed\x14\xbf\x93=u\3UJ\xc7)f\x1c\xf2\b{!\xf5\x9fG\xad"
       "k\f.\x88\xb8\x93\xe8\xe8w\xfc\x15\xb0`\xe\x83\xed$\xf7\xff\x1f\xae\xab\xc8i\xc0"
       "\xb1X\xbb\xe3\x9f\0\3\0\xbd\0*\6\xdbI\xf7x\0\0\0\0IEND\xae\x42`\x82",
-      1693 ) },
-    { "/images/fullscreen_exit_16x16.png", std::string(
+      1693 } } } },
+    { "/images/fullscreen_exit_16x16.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -26807,8 +26826,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "@\xd3\x83\"\x80\x8c\xb1\x19\x80\x8cQ\\m@\x86\1\6\xe8\xfe#\xd5\x80\xf9\xf8\x34"
       "\x13\x63\xc0\x7f\x1c\x81=\"\1U\2\x91\xa2h\xa4\x38!Q\x9c\x94)\xceL\x14\x65g\0"
       "\xe3~i\x15\x95\xc0#\x7f\0\0\0\0IEND\xae\x42`\x82",
-      189 ) },
-    { "/images/status-panel_bg_tile.png", std::string(
+      189 } } } },
+    { "/images/status-panel_bg_tile.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x32\0\0\0\x32\b\2\0\0\0\x91]\x1f\xe6\0\0\0\x19tEXtSoftwar"
@@ -26897,8 +26916,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xaa\xc7\xffyF\xa2\x7f\x8c\xb6\x9c\xe7\x44~\xeb\r\xfb\xff\xf2g<\xcb\xb7\xc1\xb1"
       "\x1d\xd7\x33\xc6\xdf\xeflV\xde\xba\x8b'Ng\x97\xd4\xfa_\x80\1\0\x38\x94\x98\x66"
       "0\xf2u\xfc\0\0\0\0IEND\xae\x42`\x82",
-      2800 ) },
-    { "/images/red-light_glow_small.png", std::string(
+      2800 } } } },
+    { "/images/red-light_glow_small.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\xf\0\0\0\xf\b\6\0\0\0;\xd6\x95J\0\0\0\x19tEXtSoftware\0\x41"
@@ -26940,8 +26959,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "H#\xb5\x8a:\xaf\v)\xd3\x9b\x9e'\x17\x7f\x8c\xb9\xe3\x34r\bA\3@9R\x1c\xe4*\x99"
       "C\x1a\xb1\xb8\xd8\x19=\xaa[\x1f\xfe\n"
       "0\0UFX\xdf\xe8\xd9\x9e\xd4\0\0\0\0IEND\xae\x42`\x82",
-      1472 ) },
-    { "/images/eye-icon_white.png", std::string(
+      1472 } } } },
+    { "/images/eye-icon_white.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\v\b\6\0\0\0v\xe2\r9\0\0\0\x19tEXtSoftware\0\x41"
@@ -26975,8 +26994,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x89L\xfd\2\x9c\x83y\xdc$_\xab\xd5^\6\x30\x45Q6}>\xdf>\xe2.\xf0\1\xe2\xe0i\xf4"
       "\x7f\xd8\x9f\x38\x36\t\x1c\x82\x1d\xb0\6H\xdf:\xd0\xc0\x33\xc8\x82!\x15\xff\b"
       "0\0PKbI\xc1\xbc^'\0\0\0\0IEND\xae\x42`\x82",
-      1331 ) },
-    { "/images/fullscreen_16x16.png", std::string(
+      1331 } } } },
+    { "/images/fullscreen_16x16.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -26985,8 +27004,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xb1\x18\x80,g\x80\xe4\x1d\x14?\xc3\fI\xc0\x62@\2\x16\xd7\xe1\v\xaf\x11\5(\xe"
       "D\x8a\xa3\x91*\t\x89\xaaI\x99\xe2\xcc\x44Rv\6\0\xe3~i\x15\n"
       "\x93\x96.\0\0\0\0IEND\xae\x42`\x82",
-      184 ) },
-    { "/images/grid-icon.png", std::string(
+      184 } } } },
+    { "/images/grid-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\x11\b\6\0\0\0;mG\xfa\0\0\0\x19tEXtSoftware\0\x41"
@@ -27007,8 +27026,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "dI\xa2\xc5Y\x80X\x10\xe8\xd4\xf7H~\xfe\b\xa5\x89\x16g\4\6,\3%\0h \3\xcc;\xff"
       "\xa1\xf8\3\x9a\xb3\x89\x12\x1f\x8d\x9d\xd1\xd8\x19Z\xb1\3\x10`\0~\x83Sc\xe5G"
       "\xd5\xee\0\0\0\0IEND\xae\x42`\x82",
-      1022 ) },
-    { "/images/arrow_down.png", std::string(
+      1022 } } } },
+    { "/images/arrow_down.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\n"
@@ -27031,8 +27050,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "o\x80\xb8\5\xc6\x81+\4\xea\x44\x91\0i\4\x8a}\xc0P\b\xb3\n"
       "\x88\x41Va8\x85\x11=x\x80!\x10\b\xa4\xbe\3M\xdb\x81W!.\xc0\xc4@$\0\b0\0S\x8c"
       "#R\x92\xd3\x18\a\0\0\0\0IEND\xae\x42`\x82",
-      1029 ) },
-    { "/images/clock-icon.png", std::string(
+      1029 } } } },
+    { "/images/clock-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\xe\0\0\0\r\b\6\0\0\0\x99\xdc_\x7f\0\0\0\x19tEXtSoftware\0"
@@ -27063,8 +27082,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x94\x87\1]\xfc\xd3\xc5\x65\xe4\xf1\x82s\r\xc9\x9f\xd3\x82\x8c\6\xab\xc3\xa9"
       "\xf1\xaf\xb6\x61\x12\xfd\xf8\xc1\xa5\xb6\xaa\x64\x16U\4\x18\0\xd8@?t\x83M\x86"
       "\f\0\0\0\0IEND\xae\x42`\x82",
-      1215 ) },
-    { "/images/loading-feed.gif", std::string(
+      1215 } } } },
+    { "/images/loading-feed.gif", { { {
       "GIF89a\x10\0\x10\0\xf2\0\0\xff\xff\xff\0\0\0\xc2\xc2\xc2\x82\x82\x82\0\0\0\0"
       "\0\0\0\0\0\0\0\0!\xfe\x1a\x43reated with ajaxload.info\0!\xf9\4\0\n"
       "\0\0\0!\xff\vNETSCAPE2.0\3\1\0\0\0,\0\0\0\0\x10\0\x10\0\0\3\x1b\b\xba\x32\x34"
@@ -27086,8 +27105,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xff\xd9\xd6I\x94\x85\x65h\xaa\xael\xeb\xb2\t\0!\xf9\4\0\n"
       "\0\b\0,\0\0\0\0\x10\0\x10\0\0\3\x1c\b\xba\xdc\xe\x62\x90!\x1e\x93\x64\xda\x95"
       "\xfbV\x98\xf6\x45S\xf5\x9dh\xaa\xael\xeb\xbeo\2\0;\0\0\0\0\0\0\0\0\0",
-      529 ) },
-    { "/images/cog_white_16x16.png", std::string(
+      529 } } } },
+    { "/images/cog_white_16x16.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\1sRGB\0\xae"
@@ -27100,8 +27119,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "!\xdb\xb9\x64I\x91\x83|a \xf0\x1c\x11'\xae\xe2r\x84/\x84Tm\x87Q\xad\xf5\xdd\xb3"
       "\xc6j\xc5\xff\x91\xdc\x37\xfbm\x88\x1b\xb0\x37\xf5\xc1\xde\xdb\xbb\xe8\x39\xdb"
       "}\x9f\xe9\xcaw~\1\x31\3\x93\xfe\xf3\xb3\4]\0\0\0\0IEND\xae\x42`\x82",
-      290 ) },
-    { "/images/body_bg_tile.png", std::string(
+      290 } } } },
+    { "/images/body_bg_tile.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x32\0\0\0\x32\b\2\0\0\0\x91]\x1f\xe6\0\0\0\x19tEXtSoftwar"
@@ -27197,8 +27216,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x9f\xbc>\x9aO\x82~\xfe#\xd9S+\xba\x84S\xb7\xc2\x99\x1b\x8f\x97\xb3\xd5wi\xdf"
       "\xfdL1\x10\xc6\xcc\xb9\xbb\x63\xce\xe7\x7f\2\f\0~\xf\xdc\xae@e`]\0\0\0\0IEND"
       "\xae\x42`\x82",
-      2836 ) },
-    { "/images/server-icon_server-assignments.png", std::string(
+      2836 } } } },
+    { "/images/server-icon_server-assignments.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x13\0\0\0\x13\b\6\0\0\0rP6\xcc\0\0\0\x19tEXtSoftware\0\x41"
@@ -27229,8 +27248,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "]h\xc6\xa3\x42\xa6\xf0\x94n\xd5\biF\x83(\xd6\x87Y\1\x1b<\xae\x19\xbe\x64\xba"
       "\4\xe5k6\xadX\xc2,^\xff\x65=s\x82\\i?\5\x18\0\x82\xf0l\xa4\v\x9b\x8b\x42\0\0"
       "\0\0IEND\xae\x42`\x82",
-      1259 ) },
-    { "/images/server-icon.png", std::string(
+      1259 } } } },
+    { "/images/server-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x1b\0\0\0\x14\b\6\0\0\0|\x82\x46\x80\0\0\0\x19tEXtSoftwar"
@@ -27268,8 +27287,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "VV\xe3\xd9y\r\xfb\xe0\x95[\xbc\xc6\xe7\xcd\x89\xee_\xf2\xef\xd9\x18\xec\x82\x46"
       "\xb8\1\xf3m?\x19\xef\x1b}>VHhN\x11\xdd\xe1\x31\xec.\xe7o\xc1o\1\6\0\t\xb8\x96"
       "p\x9f\x9c[\xfd\0\0\0\0IEND\xae\x42`\x82",
-      1461 ) },
-    { "/images/status_panel-icon_2.png", std::string(
+      1461 } } } },
+    { "/images/status_panel-icon_2.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0/\0\0\0/\b\6\0\0\0s'\x93\xac\0\0\0\x19tEXtSoftware\0\x41\x64"
@@ -27306,8 +27325,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "#B\x8a\x9f\r\xab\x92\xc5\v<\xea\x97\xb1\xf4$D\xdb,\xbd%\xde\x39\x9a\xea{\x89"
       "\xeb?P\xf4r\xb2\x86\f\x19sW\2\f\0\x34\x8b\xc6\xc6\x9b\x42k\xd4\0\0\0\0IEND\xae"
       "B`\x82",
-      1430 ) },
-    { "/images/navbar-active.png", std::string(
+      1430 } } } },
+    { "/images/navbar-active.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x83\0\0\0>\b\2\0\0\0\x87\xab?\x9a\0\0\0\x19tEXtSoftware\0"
@@ -27418,8 +27437,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x8d\xe3\x83{T\bu(U\xd2\xc2@6Ll\x14\xa1\x31\xe3\xf4\x10\x1b\x91z\x1e\xab\x9f"
       "?\x7f\\W\xe2\xd7\xaf\x9f\x7f?\xb0\xfe\x9f\xff\xfc+\xc0\0 \xe3\x41\x64\xb8\xa9"
       "#\x90\0\0\0\0IEND\xae\x42`\x82",
-      3253 ) },
-    { "/images/push-arrow-left-icon.png", std::string(
+      3253 } } } },
+    { "/images/push-arrow-left-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\t\b\6\0\0\0\xd4\xe8\xc7\f\0\0\0\x19tEXtSoftware"
@@ -27445,8 +27464,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "w\0\xbdT\x89+vX\xb0I\0\x35\xfc\4Rv&&&\x9d@/\x16\x11\xf2\x16(`;\x80\xa6Ubs\xf2"
       "\x99\x33g\xca\x35\x34\x34\xec\x81\xccg\xf8\f\1\b0\0\x1f\tG0\x16\x66\f\xca\0\0"
       "\0\0IEND\xae\x42`\x82",
-      1139 ) },
-    { "/images/status_panel-icon_1-error.png", std::string(
+      1139 } } } },
+    { "/images/status_panel-icon_1-error.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0/\0\0\0/\b\6\0\0\0s'\x93\xac\0\0\0\x19tEXtSoftware\0\x41\x64"
@@ -27474,8 +27493,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x81\a\x1ex\xe0\x7f\x81\xf7\xd8\xa1u\xfd\x89o\bM\xf3\xb9\xc0\xb3\x86\x41z\xa7"
       "\x1b\x9e\xee\xc3\x8d\xd9\xdc\xec\x39\x36\xdd\x7f\xa0(0Y\xc3\x36\xc8\xd6M\x80"
       "\1\0\xfa\xb9\x34\xbf:\xb4\xa0\0\0\0\0\0IEND\xae\x42`\x82",
-      1176 ) },
-    { "/images/yellow-light_glow.png", std::string(
+      1176 } } } },
+    { "/images/yellow-light_glow.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -27517,8 +27536,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xa2\"\xb7\xcf\r\x93sj\x9b^f\\p\"\xff\xfd\x1b\xd3\x34n\\/0\x9a\x30\xc4\x18s6"
       "(*/\x94\x31\x9bG\1i\xa6\xb6\x91\x1c/I\x7f\4\x18\0\x8a\xb1u\xa6\x1d\xd5\xa2\x14"
       "\0\0\0\0IEND\xae\x42`\x82",
-      1532 ) },
-    { "/images/disk-icon.png", std::string(
+      1532 } } } },
+    { "/images/disk-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\f\b\6\0\0\0k\xe7=\x81\0\0\0\x19tEXtSoftware\0\x41"
@@ -27539,8 +27558,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\f\6\xd2\x41\x1aH/\xc8\x80\x30\x98sH\4 =\xe1 \3\xb2\x19\xc8\aYL\xd0\xe8#\x17"
       "X\xb0@\x19\x8c\x64\x1a\xf0\x9f\x89\\\x8d\xe8\xe9\x80T\0w1\v\xba\x89\xa4\2\x80"
       "\0\3\0\xbd\t\r\x15t\xd5\xf3\x85\0\0\0\0IEND\xae\x42`\x82",
-      1028 ) },
-    { "/images/status_panel-icon_3.png", std::string(
+      1028 } } } },
+    { "/images/status_panel-icon_3.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0/\0\0\0/\b\6\0\0\0s'\x93\xac\0\0\0\x19tEXtSoftware\0\x41\x64"
@@ -27587,8 +27606,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xa3\x41{\xad\xc2:\xfc\x80G\xe2\x8b\x46\1\xf7\xdb\4\\\xf\xba\xd5\xd3\x88\xda"
       "U>\x9a\x38U\x7f\x1c\xa5?P\xd4\x19\x64\xf\x61\xe2\xe7\xbf\t0\0\xd2jd\xd3\xca'"
       "\xff\xf1\0\0\0\0IEND\xae\x42`\x82",
-      1668 ) },
-    { "/images/red-light.png", std::string(
+      1668 } } } },
+    { "/images/red-light.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\v\0\0\0\v\b\6\0\0\0\xa9\xacw&\0\0\0\x19tEXtSoftware\0\x41"
@@ -27617,8 +27636,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xa8\x93\x98\xdb\x95\x14\xd4\xe4\xd9\xd9\xcbY\x19\x99\xdc\x98\x18\x19\x44\xfe"
       "\xfdgx\xf5\xfd\xdf\xdf\xbd\xc7>}\x9e\x38\xe3\xd9\xf3\a@5?\0\2\f\0\xac\xe3\xab"
       "\xb2\x8f\xbbYj\0\0\0\0IEND\xae\x42`\x82",
-      1219 ) },
-    { "/images/pencil-icon.png", std::string(
+      1219 } } } },
+    { "/images/pencil-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\x11\b\6\0\0\0;mG\xfa\0\0\0\x19tEXtSoftware\0\x41"
@@ -27654,8 +27673,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x91\xf2\x62\x62\x62\x8c\2\2\2\x13\f\r\r\xaf\0\x35\x9f!6g\x82\xbd\xe3\xec\xec"
       "|\fH\x83\xf0q >\2\xc4\x97H)d\0\2\f\0\x7f\x46\x8d\xce\xc7k\xa1V\0\0\0\0IEND\xae"
       "B`\x82",
-      1305 ) },
-    { "/images/copy_to_clipboard_16x16.png", std::string(
+      1305 } } } },
+    { "/images/copy_to_clipboard_16x16.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\3\0\0\0(-\xfS\0\0\0\x19tEXtSoftware\0\x41"
@@ -27669,8 +27688,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x9a\xe5\\\2\xe4\x1e\x42\2\xe8\xce\x1c{\xea?\x8e\xc9\xe7\x36\xba\xac:\xda\x9a"
       "\xd9?h\xe5\xeez\x18\xea{\x9aK\x80\1\0U\x16\b\x11\x39W(3\0\0\0\0IEND\xae\x42`"
       "\x82",
-      288 ) },
-    { "/images/pencil-icon_big.png", std::string(
+      288 } } } },
+    { "/images/pencil-icon_big.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\"\0\0\0\"\b\6\0\0\0:G\v\xc2\0\0\0\x19tEXtSoftware\0\x41\x64"
@@ -27708,8 +27727,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xef\xaf\xbd\xfc\x32p-\xb4\x7f\xb4\xf0\xfeh\xe3y\xa8\x39\xe4\xd3 p\xc7\x17&\xe8"
       "\xd0\xc0@\x83] \x87T\3\xf1\x87\1t\4\xc8\xeej\x90\x43n\x80\xc6'@59\x10\x7f\xa6"
       "\xa3\3>C\xed\4\xd9}\3 \xc0\0n{\x95\x8e\xbe\xb6n'\0\0\0\0IEND\xae\x42`\x82",
-      1457 ) },
-    { "/images/bars-icon.png", std::string(
+      1457 } } } },
+    { "/images/bars-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\r\b\6\0\0\0Oy\x85\x1a\0\0\0\x19tEXtSoftware\0\x41"
@@ -27729,8 +27748,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\b\x18I5\4\xc3%@?\xfe\xa7\xd8\x10r\0\xd5\xc2\x84\xa8\xa8\xc4\x17VD\xbb\4_X\r"
       "\x9e\x30\xa1Z\xc0\x32\xe2\xf0/\xd1\xe2\0\1\6\0!\xe1\xe\xdb^\xea\n"
       "2\0\0\0\0IEND\xae\x42`\x82",
-      987 ) },
-    { "/images/green-light_glow.png", std::string(
+      987 } } } },
+    { "/images/green-light_glow.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -27771,8 +27790,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "*\x9b\xa8\xcc\xb4\x87\3\xc3\x9eq\xbd+C\xd5\xe3}\xe5\xafnV\xc5\xc9\xd7\x38L\3"
       "\xafg\xd7o$~P\xe7m\xcc\x39g\xa2R\xb1\xd6I_&\xa6\xe7\xfc\x14\x13\xab\x9b\x95\xe3"
       ")\xff\x11`\0[\x81|\x9c\xc0\xcdQO\0\0\0\0IEND\xae\x42`\x82",
-      1557 ) },
-    { "/images/warning-icon.png", std::string(
+      1557 } } } },
+    { "/images/warning-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x16\0\0\0\x13\b\6\0\0\0\x94y\xfd\x88\0\0\0\4gAMA\0\0\xaf\xc8"
@@ -27789,8 +27808,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xb1\xa7\xc6\xdc\x34\xbeX&\xe6\x36rAb\xae\x1fTq\xbc\xe1\xc3\xd2\xfc\xe\xd5\xd8"
       "\xd8\xc6m\xfa\x1b$\xe8\x19j\xc8\xe0\xff\1\xc9yq\x17`\0\xf5\x10\xa1\x45\xad#\xe1"
       "v\0\0\0\0IEND\xae\x42`\x82",
-      395 ) },
-    { "/images/icon-magnifying_glass.png", std::string(
+      395 } } } },
+    { "/images/icon-magnifying_glass.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\x11\b\6\0\0\0;mG\xfa\0\0\0\x19tEXtSoftware\0\x41"
@@ -27834,8 +27853,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "9\x84h\x9c\xec\x36\x31}\xc3\x93m\5\x8cU,\x16\xcb\xabz\xbd>\xa8\xd7\xeb}\xb3\xb3"
       "\x9f\x9e@\xd4\x66\xa0\xfe#\x18\x86\x89\xc1\xbb\xe3\xaaw\x93\x7f\5\x18\0\xa0\xc3"
       "\xe2\xba\x95\t\xb5~\0\0\0\0IEND\xae\x42`\x82",
-      1526 ) },
-    { "/images/status_panel-icon_4-error.png", std::string(
+      1526 } } } },
+    { "/images/status_panel-icon_4-error.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0/\0\0\0/\b\6\0\0\0s'\x93\xac\0\0\0\x19tEXtSoftware\0\x41\x64"
@@ -27881,8 +27900,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x81\x80\xc6\n"
       "8\xbe\xb8R\x9e=\xc7\xd5\x1f\xf8<\xff\xfa\xca\x8b\x97\xf7\xc0\xf8\3\xc5UF\xfa"
       "p\x84\xca\xd3\xdf\2\f\0\xd0\xee\xc1\xe1\x9a\"\x1a\x43\0\0\0\0IEND\xae\x42`\x82",
-      1600 ) },
-    { "/images/cog-icon.png", std::string(
+      1600 } } } },
+    { "/images/cog-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\x11\b\6\0\0\0;mG\xfa\0\0\0\x19tEXtSoftware\0\x41"
@@ -27921,8 +27940,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xd6\xe7\x66\x1b\xf1M\xfd\xf7\xff\xc9q\x81\xdf\xa6&/~i\6\xf1\xa9\xebn=\x16\x8b"
       "\x8d\xeb\xc3\xe8\xa6\x90\x86\xbc\x86\xf1\xdc\x7f\1\6\0WZ\xa1\x93\xf1\x1b\xd6"
       "\x9a\0\0\0\0IEND\xae\x42`\x82",
-      1443 ) },
-    { "/images/thinker_on_hill.svg", std::string(
+      1443 } } } },
+    { "/images/thinker_on_hill.svg", { { {
       "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
       "<!-- Generator: Adobe Illustrator 18.1.1, SVG Export Plug-In . SVG Version: "
       "6.00 Build 0)  -->\n"
@@ -28087,8 +28106,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "       id=\"path3089\"\n"
       "       d=\"m 629,158.64549 c 7.5,-14.2 32,-31.4 48.7,-0.2\"\n"
       "       stroke-miterlimit=\"10\" /></g></svg>",
-      7180 ) },
-    { "/images/list-square-bullet.png", std::string(
+      7180 } } } },
+    { "/images/list-square-bullet.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\a\0\0\0\a\b\2\0\0\0K0\xc0\x84\0\0\0\x19tEXtSoftware\0\x41"
@@ -28106,8 +28125,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "n> </rdf:RDF> </x:xmpmeta> <?xpacket end=\"r\"?>\x95.\xd0|\0\0\0\x17IDATx\xda"
       "b\xbc}\xfb\x36\3\6`b\xc0\6\xe8+\n"
       "\x10`\0\x8a\xf7\2\x9f\f\t\x92\xb2\0\0\0\0IEND\xae\x42`\x82",
-      933 ) },
-    { "/images/list-vert-dash.png", std::string(
+      933 } } } },
+    { "/images/list-vert-dash.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\1\0\0\0\b\b\6\0\0\0\x38\x1a\x95\x41\0\0\0\x19tEXtSoftware"
@@ -28125,8 +28144,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "escription> </rdf:RDF> </x:xmpmeta> <?xpacket end=\"r\"?>\x11\x7f\x1a\x93\0\0"
       "\0\"IDATx\xda\x62\xd8\xb0\x61\x83\x31\x13\3\3\x43\a\x88`\0\x13\f\xff\xff\xff"
       "g@p\xc1\4@\x80\1\0\x9c\xe6\5\xd5\xb7\xb4I>\0\0\0\0IEND\xae\x42`\x82",
-      944 ) },
-    { "/images/bar-line-graph-icon.png", std::string(
+      944 } } } },
+    { "/images/bar-line-graph-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -28151,8 +28170,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xbb\"K\x80\\p\xeH\xfb\1\xf1\x13\x62l\4\xe9\x41w\x81-\x10\x7f%\xd6\x46t\xc0\x88"
       "#)\xe3\xb4\x11\x9b\vH\xb2\x11\x97\v\x88\xb6\x11\x9dOIfB\xf1\2\xba\xb3\x89\xe6"
       "\3\4\x18\0\xe1\x88\x34\x96\xcd_8\xae\0\0\0\0IEND\xae\x42`\x82",
-      1126 ) },
-    { "/images/server-icon-added.png", std::string(
+      1126 } } } },
+    { "/images/server-icon-added.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x1b\0\0\0\x14\b\6\0\0\0|\x82\x46\x80\0\0\0\6\x62KGD\0\xff"
@@ -28183,8 +28202,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xf6xN\xe3\x13w\xb9\x8d\x19\t\xc8st\x86\xac<=\\\x8fg\x81\xfd\xf1\xce\xd5\xe3"
       "\t\xb6\x84\xac\f\xc3\xfaR'\xa0+\xa2\xe2\xba\x42V\xfe\xd5L\xee\x7f\x82\xbc\xc8"
       "\xdeU\x88\x17S\0\0\0\0IEND\xae\x42`\x82",
-      710 ) },
-    { "/images/icon-pause.png", std::string(
+      710 } } } },
+    { "/images/icon-pause.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\xe\0\0\0\xe\b\6\0\0\0\x1fH-\xd1\0\0\0\x19tEXtSoftware\0\x41"
@@ -28197,8 +28216,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe3\x65\f\xdc\xb4\xd6\xcd\xc6\x65YP6\x18\xf5<\xcf\x65\xd2\xdd\x36h\xe1)\xa9"
       "\xf9'\0%=9r\xe7\1\x88\xdf\xb7\xc8UC\x9e\xc4\xd5\x90?\5\x18\0!:\xbf\x81\xf2\3"
       "\x90_\0\0\0\0IEND\xae\x42`\x82",
-      292 ) },
-    { "/images/bars-icon_server-assignments.png", std::string(
+      292 } } } },
+    { "/images/bars-icon_server-assignments.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\xe\b\6\0\0\0\xc9\xed\xf7\xb4\0\0\0\x19tEXtSoftw"
@@ -28218,8 +28237,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x86\x30\xb0\xa0;\xf\b\x18I5\4\xc3%@?\xfe\xa7\xd8\x10r\0\xd5\xc2\x84\xa8\xa8"
       "\xc4\x17VD\xbb\4_X\r\x9e\x30\xa1Z\xc0\x32\xe2\xf0/\xd1\xe2\x8c\x64\x64@\xf4\0"
       "g\0\b0\0\x93\xdf\x12\xab\x62\x44\x92\xa2\0\0\0\0IEND\xae\x42`\x82",
-      994 ) },
-    { "/images/resolve_issue-resolved_icon.png", std::string(
+      994 } } } },
+    { "/images/resolve_issue-resolved_icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\xe\b\6\0\0\0&/\x9c\x8a\0\0\0\x19tEXtSoftware\0\x41"
@@ -28245,8 +28264,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe2\x1a<\x86\xbc\6\x62W \xbe\x83\xcd\x64\xe4h\xc4\x66\bL\xf3U\\NCO\x89k\xa0"
       "\xf4r ~\xf\xd5|\x11_\"\xc1\x96\x94\xd7@m\xfc\4\xc4O\t\xa5\x32\x80\0\3\0\xf9\xd7"
       ".\x8e\x19\x96N\x1d\0\0\0\0IEND\xae\x42`\x82",
-      1155 ) },
-    { "/images/icon-play.png", std::string(
+      1155 } } } },
+    { "/images/icon-play.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\xe\0\0\0\xe\b\6\0\0\0\x1fH-\xd1\0\0\0\x19tEXtSoftware\0\x41"
@@ -28260,8 +28279,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x98n\xf2\xd7\xaa\xf8.\x13\xf9qYko\xdd\xb0\t\xafG\xdc\x88\xa4\x94=\x7f\x9e'^"
       "\xd7_\xbf\xa3\xb8\xe6\x89\1\xba{\x9a\xe5\xd6\xeb\xff\x66\xb9\xad\xc9+yk\xf2\x8f"
       "\0\3\0&\xcbia\xf7\3\x38\xde\0\0\0\0IEND\xae\x42`\x82",
-      289 ) },
-    { "/images/db.png", std::string(
+      289 } } } },
+    { "/images/db.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\t\0\0\0\f\b\6\0\0\0\xb0\\\x97\xa3\0\0\0\4gAMA\0\0\xaf\xc8"
@@ -28281,8 +28300,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe4\xech{\x82\xf1\xdb\x87\xc7Z\xa7\xcf\x9cO?t\xe4\xb8\xff\xe3'O\x85\xfe\xfd"
       "\xfb\xf\xf4\x30\xe3\x7fY\x19\xe9w\xc0\x30\xdahjb8\x13 \xc0\0.\x82\xb3\xb3\x42"
       "\xb1\xbdK\0\0\0\0IEND\xae\x42`\x82",
-      465 ) },
-    { "/images/bars-icon_white.png", std::string(
+      465 } } } },
+    { "/images/bars-icon_white.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\r\b\6\0\0\0\xa0\xbb\xee$\0\0\0\x19tEXtSoftware\0"
@@ -28301,8 +28320,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "b\xfc\xff\xff?\3)\x80\x91\x91\xd1\x18\x85O\xaa\1@\x80\xa2\x81\x89\x81\x42\xc0"
       "\b\xc4(N\2\xba\xe8,).\0y\xe1?\x16\x43\xe9\xe7\5\x8a\r`!6\xbap\x85\r\xbe\x30 "
       "J|\xe0\xc3`\xe0\r\0\b0\0\x97\xd7\x1b;g\xbaN\xe2\0\0\0\0IEND\xae\x42`\x82",
-      982 ) },
-    { "/images/red-light_glow.png", std::string(
+      982 } } } },
+    { "/images/red-light_glow.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -28344,8 +28363,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "`\x8f\r\x9a\x36\r\x8cz\xa6\xb2)s\xc0s\x14\xdf\x96\xa7_\xe3\xd8\x8d\xe5N'\xe8"
       "EQr\x10\xc5}\xf4\xd9!\xab\xb8R\x1a\x45\x39\xf5LeS\xe6\x13\xd1_\1\6\0\x1b\xd9"
       "\x86%\x8al\3\xa7\0\0\0\0IEND\xae\x42`\x82",
-      1534 ) },
-    { "/images/status_panel-icon_4.png", std::string(
+      1534 } } } },
+    { "/images/status_panel-icon_4.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0/\0\0\0/\b\6\0\0\0s'\x93\xac\0\0\0\x19tEXtSoftware\0\x41\x64"
@@ -28388,8 +28407,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe8\x82\xa5g\xc2\xe2w\x1b\1/\xe0\5\xbc\x80\x17\xf0\2^\xc0\xff\xe~\x85\x37\xe8"
       "A\xb7\\\x83\x9f\r\xba\xa4\x32/\xe0!]\x86[\x13\1tW\xf1T\x89'\xb4i0\xff@1\xc4\xc9"
       "\x1e\xbe\x92u\xe3\x97\0\3\0\xd0:\xbf\\\xac\x65\xa5-\0\0\0\0IEND\xae\x42`\x82",
-      1623 ) },
-    { "/images/disk-slot-icon.png", std::string(
+      1623 } } } },
+    { "/images/disk-slot-icon.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x11\0\0\0\r\b\6\0\0\0Oy\x85\x1a\0\0\0\x19tEXtSoftware\0\x41"
@@ -28415,8 +28434,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "P`\2M\xc4z\x11\x1b\x85\4I\xe0\x83\xc5\xaa\x45\xc8h\xf3\x93\xa4\x36\xf8\xe3#\xc0"
       "\0\xaa!<\n"
       "\xdah\x81\xb9\0\0\0\0IEND\xae\x42`\x82",
-      1099 ) },
-    { "/images/trash_stroke_16x16.png", std::string(
+      1099 } } } },
+    { "/images/trash_stroke_16x16.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\x10\0\0\0\x10\b\6\0\0\0\x1f\xf3\xff\x61\0\0\0\x19tEXtSoft"
@@ -28426,8 +28445,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe8\n"
       "\xf6\x93\x90|\xf7\xe3\xb2\x61?\x91\x9a\5`\x9a\0\x46\x61{\xe5\xc4\x15R\xe9\0\0"
       "\0\0IEND\xae\x42`\x82",
-      172 ) },
-    { "/images/arrow_right.png", std::string(
+      172 } } } },
+    { "/images/arrow_right.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0\n"
@@ -28451,8 +28470,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x82\xdc\x33\v\xe4>\xa0\x82\x37\xe8\xba\x61\n"
       "w\0q1P\xc1\x35\\\xee`$6\xc0\1\2\f\0\x39\xc1*\x81\x9e\x15g\x86\0\0\0\0IEND\xae"
       "B`\x82",
-      1033 ) },
-    { "/images/status_panel-icon_1.png", std::string(
+      1033 } } } },
+    { "/images/status_panel-icon_1.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0/\0\0\0/\b\6\0\0\0s'\x93\xac\0\0\0\x19tEXtSoftware\0\x41\x64"
@@ -28480,8 +28499,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x8eO\x11\xe5`\xfa\x37T\x1c.\xc9\xc5\xcc\x30\xc5R\x10\xc4|\1j\x98m\xbb\x15*\xe5"
       "\xcb\0Y@!1D\xfc\xf0\x14\x88\xd3\0\2\f\0\xe1U4\xb0+\xc7\xb5\x83\0\0\0\0IEND\xae"
       "B`\x82",
-      1184 ) },
-    { "/images/ajax-loader.gif", std::string(
+      1184 } } } },
+    { "/images/ajax-loader.gif", { { {
       "GIF89a\x10\0\x10\0\xf2\0\0\xff\xff\xff\0\0\0\xc2\xc2\xc2\x42\x42\x42\0\0\0\x62"
       "bb\x82\x82\x82\x92\x92\x92!\xff\vNETSCAPE2.0\3\1\0\0\0!\xfe\x1a\x43reated wi"
       "th ajaxload.info\0!\xf9\4\t\n"
@@ -28510,8 +28529,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\0\0\0,\0\0\0\0\x10\0\x10\0\0\3\x32\b\xba\xdc\xfe\x30\xcaI\xab\x65\x42\xd4\x9c"
       ")\xd7\x1e\b\b\xc3 \x8e\xc7q\xe\4\x31\x30\xa9\xca\xb0\xaeP\x18\xc2\x61\x18\aV"
       "\xda\xa5\2 ub\x18\x82\x9e[\x11\x90\0\0;\0\0\0\0\0\0\0\0\0",
-      673 ) },
-    { "/fonts/opensans-extrabolditalic-webfont.ttf", std::string(
+      673 } } } },
+    { "/fonts/opensans-extrabolditalic-webfont.ttf", { { {
       "\0\1\0\0\0\x13\1\0\0\4\0\x30\x46\x46TMba\xc1\xf2\0\0\1<\0\0\0\x1cGDEF\1\x17\0"
       "\4\0\0\1X\0\0\0 GPOSl\x91t\x8f\0\0\1x\0\0\0 GSUBy\xb3z\xd6\0\0\1\x98\0\0\0xO"
       "S/2\xa2\xd8\x9dZ\0\0\2\x10\0\0\0`cmap\x9f\xd0\x42*\0\0\2p\0\0\1\xe2\x63vt \""
@@ -30379,8 +30398,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\t\xfe\2+\xb1\3\x46v+D\xb0\n"
       " E\xb2\v\x1d\2+\xb1\3\x46v+D\xb0\f E\xba\0\t\x7f\xff\0\2+\xb1\3\x46v+D\xb0\r"
       " E\xba\0\f\1\x18\0\2+\xb1\3\x46v+DY\xb0\x14+\0\0\0\1P\x98\xdc\xff\0\0",
-      46924 ) },
-    { "/fonts/opensans-bolditalic-webfont.svg", std::string(
+      46924 } } } },
+    { "/fonts/opensans-bolditalic-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -31313,8 +31332,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "120z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      59785 ) },
-    { "/fonts/opensans-semibold-webfont.eot", std::string(
+      59785 } } } },
+    { "/fonts/opensans-semibold-webfont.eot", { { {
       "oN\0\0yM\0\0\2\0\2\0\4\0\0\0\2\v\a\6\3\b\4\2\2\4\1\0X\2\0\0\4\0LP\xef\2\0\xe0"
       "[ \0@(\0\0\0\0\0\0\0\x9f\1\0 \0\0\0\0 eD}\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "$\0O\0p\0\x65\0n\0 \0S\0\x61\0n\0s\0 \0S\0\x65\0m\0i\0\x62\0o\0l\0\x64\0\0\0"
@@ -32103,8 +32122,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xf9\xd8y[\6v\xd4_((\xbat\x8d\1\xe\x8a\xda<\x8f\xa5\xe7}N\x15\x30\xf9Z\x7fu\xf0"
       "HW\x85\xc6\xd2\xca\x45\x80~\xbd\xd2\3\"M\x96\xba\2Sf\xd0\\\x9f\x17\x63\x14\x9d"
       "\x10*\x1b\x66\xd4\xf3",
-      20079 ) },
-    { "/fonts/opensans-light-webfont.svg", std::string(
+      20079 } } } },
+    { "/fonts/opensans-light-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -32983,8 +33002,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "085z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      55461 ) },
-    { "/fonts/opensans-extrabolditalic-webfont.eot", std::string(
+      55461 } } } },
+    { "/fonts/opensans-extrabolditalic-webfont.eot", { { {
       "ZU\0\0\x64T\0\0\2\0\2\0\4\0\0\0\2\v\t\6\3\b\4\2\2\4\1\1 \3\0\0\4\0LP\xef\2\0"
       "\xe0[ \0@(\0\0\0\0\0\0\0\x9f\1\0 \0\0\0\0\x9a\x89\0\xe2\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0&\0O\0p\0\x65\0n\0 \0S\0\x61\0n\0s\0 \0\x45\0x\0t\0r\0\x61\0\x62"
@@ -33858,8 +33877,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xdc\xbf\x82\xad\xd4.$\x8c\xf5\xb4\4\"\x92\xf7>D\xaa\x94\x9c\x88\x99S\xbb\xbb"
       "\xbcN\xac\x64(>1\5U#\xe9\x82t \x89\x30\x12\2T\xc5\\\x89S2\xa2\xd8\xb7\"\x12%"
       "f\xc6L\xe5\xa4\xceN\x1a\x34\x66\x97\xb0\0",
-      21850 ) },
-    { "/fonts/opensans-semibold-webfont.svg", std::string(
+      21850 } } } },
+    { "/fonts/opensans-semibold-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -34752,8 +34771,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "105z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      56633 ) },
-    { "/fonts/opensans-light-webfont.woff", std::string(
+      56633 } } } },
+    { "/fonts/opensans-light-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0Y`\0\x13\0\0\0\0\xa3\xe4\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\x46\x46TM\0\0\1\xa8\0\0\0\x1c\0\0\0\x1c\x62>E*GDEF\0\0\1\xc4\0\0"
       "\0\x1e\0\0\0 \1\x17\0\4GPOS\0\0\1\xe4\0\0\0 \0\0\0 l\x91t\x8fGSUB\0\0\2\4\0\0"
@@ -35655,8 +35674,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\1w\xf1\3#O\6}\xbc\xde\xb2':\xbd:\x81\1\xe8\x8f\x15\x43\x30\xd8+F`\xb8R\x8c\xc1"
       "h\xae\x98\x80\xf1L1\5\x93\xa9\x62\6\xa6\x85\xe2\0\xcc\x14[\xca\xc4\a\xce\xc4"
       "U\6\0\0\1P\x98\xdc\xff\0\0",
-      22880 ) },
-    { "/fonts/opensans-light-webfont.eot", std::string(
+      22880 } } } },
+    { "/fonts/opensans-light-webfont.eot", { { {
       "|K\0\0\x92J\0\0\2\0\2\0\4\0\0\0\2\v\3\6\3\5\4\2\2\4\1\0,\1\0\0\4\0LP\xef\2\0"
       "\xe0[ \0@(\0\0\0\0\0\0\0\x9f\1\0 \0\0\0\0\x89]1\xf0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\x1e\0O\0p\0\x65\0n\0 \0S\0\x61\0n\0s\0 \0L\0i\0g\0h\0t\0\0\0\xe\0"
@@ -36426,8 +36445,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xf9\xea\3\x81?\xed\xb7\xd5/\xe4\xbb\xfa\x8e\x15\x97_]\xd4\xe8\xd4y\xb9\xf\x8c"
       "\xbc<hq\x87\x17\x39\xc2\x44\xfa\x8a\x12.\xf3\xf0<\xb9\xab\x64\x90\x99\t6+\x84"
       "\x1f\xb8\xf0^\xeb\x18_:",
-      19324 ) },
-    { "/fonts/stylesheet.css", std::string(
+      19324 } } } },
+    { "/fonts/stylesheet.css", { { {
       "/* Generated by Font Squirrel (http://www.fontsquirrel.com) on November 6, 2"
       "012 */\n"
       "\n"
@@ -36602,8 +36621,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  -webkit-font-smoothing: antialiased;\n"
       "  -moz-osx-font-smoothing: grayscale;\n"
       "}",
-      5618 ) },
-    { "/fonts/opensans-italic-webfont.svg", std::string(
+      5618 } } } },
+    { "/fonts/opensans-italic-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -37550,8 +37569,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "095z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      61127 ) },
-    { "/fonts/open-sans_LICENSE.txt", std::string(
+      61127 } } } },
+    { "/fonts/open-sans_LICENSE.txt", { { {
       "\n"
       "                                 Apache License\n"
       "                           Version 2.0, January 2004\n"
@@ -37765,8 +37784,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.\n"
       "   See the License for the specific language governing permissions and\n"
       "   limitations under the License.\n",
-      11358 ) },
-    { "/fonts/generator_config.txt", std::string(
+      11358 } } } },
+    { "/fonts/generator_config.txt", { { {
       "# Font Squirrel Font-face Generator Configuration File\n"
       "# Upload this file to the generator to recreate the settings\n"
       "# you used to create these fonts.\n"
@@ -37777,8 +37796,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\"100\",\"options_subset\":\"basic\",\"subset_custom\":\"\",\"subset_custom_"
       "range\":\"\",\"css_stylesheet\":\"stylesheet.css\",\"filename_suffix\":\"-we"
       "bfont\",\"emsquare\":\"2048\",\"spacing_adjustment\":\"0\"}",
-      522 ) },
-    { "/fonts/ionicons.ttf", std::string(
+      522 } } } },
+    { "/fonts/ionicons.ttf", { { {
       "\0\1\0\0\0\xf\0\x80\0\3\0pFFTMm\x87\xb5 \0\0\0\xfc\0\0\0\x1cOS/2A9a\xd3\0\0\1"
       "\x18\0\0\0`cmapm\2n\x1f\0\0\1x\0\0\1\xfa\x63vt \3\xb3\xff\xb2\0\2\xd7,\0\0\0"
       "\x1c\x66pgm\x8a\n"
@@ -40444,7 +40463,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\4\a\x14p\1\6\4\x18\f\f\n"
       "\5\5\3\x14\x16 \x16\0\0\4\0\0\xff\xe0\1\xc0\1\xa0\0\f\0\x19\0&\0\x35\0&@#4%\x1f"
       "\x1c\x15\xf\v\2\b\1\0\1\x42\0\0\1\1\0O\0\0\0\1S\0\1\0\1G,+\x1e\x1d\2\xf+7\6\x15",
-      65489) + std::string(
+      65489 },
+      {
       "&547\x17\x1e\1\x1f\1\6\5\x14\a4'.\1/\1\x36?\1\x16%&\a62\x17&\a\xe\1\xf\1&\x17"
       "\x16\x1f\1\6\"'767>\1?\1\x16_2-M\3\x17.\f\f&\1\x39-2\x12'\n"
       "\v*3\3M\xfe\xe9)\x1f\x38\x8e\x38\x1d+\r\x1b\a\b\x1a\x81+\x13\2\x42\xca\x42\1"
@@ -43008,7 +43028,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe\1\v\b\n"
       "\vY\0\b\r\1\t\6\b\tY\0\6\a\a\6M\0\6\6\aQ\f\1\a\6\aE(($$  (+(+*)$'$'&% # #\x13"
       "\x19\x12\x12\x12\x12\x17\xf\x16+\1\x14\a\6\a\6\x1d\1#57#\a\x15#5'#\x17\x15#5",
-      65458) + std::string(
+      65458 },
+      {
       "4'&'&5462\x16\3\x35\x33\x15'53\x15'53\x15\1 \x1e\x1c\4\x12  \x10  \x1f\x11  "
       "\x13\b\x17\x1eUvU\xb0@P```\1\x13)*&\a\x1f\x33\1\x80@@\x80\x80@@\x80\1\x31!\xe"
       "\x1f*):SS\xfe\x93\x10\x10 \x10\x10 \x10\x10\0\0\0\b\0\0\0\0\1\x80\1\x80\0\3\0"
@@ -45010,8 +45031,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "RX\xb1\1\1\x8eY\xb9\b\0\b\0\x63 \xb0\1#D\xb0\3#p\xb2\4(\tERD\xb2\n"
       "\2\a*\xb1\6\1\x44\xb1$\1\x88QX\xb0@\x88X\xb1\6\3\x44\xb1&\1\x88QX\xb8\4\0\x88"
       "X\xb1\6\1\x44YYYY\xb8\1\xff\x85\xb0\4\x8d\xb1\5\0\x44\0\0",
-      57777 ) },
-    { "/fonts/copse-regular-webfont.svg", std::string(
+      57777 } } } },
+    { "/fonts/copse-regular-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -45970,7 +45991,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "q-280 0 -402 152q-112 139 -112 437v779q0 16 -13 16h-163q-28 0 -38 54q-2 14 -"
       "3 26zM445 1757v2q0 93 79 127q24 10 55 10q30 0 55 -10q26 -12 44 -30q40 -40 40"
       " -99t-40 -99q-38 -38 -84 -38q-76 0 -112.5 39t-36.5 98zM898 1757q0 95 80 129 ",
-      65504) + std::string(
+      65504 },
+      {
       "q25 10 55 10q59 0 99 -40q38 -38 38 -99q0 -94 -82 -127q-25 -10 -55 -10q-92 0 "
       "-125 82q-10 25 -10 55z\" />\n"
       "<glyph unicode=\"&#xdd;\" horiz-adv-x=\"1284\" d=\"M-31 1424q0 49 14 65t25 1"
@@ -46359,8 +46381,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "000z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      26617 ) },
-    { "/fonts/opensans-lightitalic-webfont.woff", std::string(
+      26617 } } } },
+    { "/fonts/opensans-lightitalic-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0\x66\xa0\0\x13\0\0\0\0\xc1\x98\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\0\0\x46\x46TM\0\0\1\xa8\0\0\0\x1c\0\0\0\x1c\x62_y]GDEF\0\0\1\xc4"
       "\0\0\0\x1e\0\0\0 \1\x17\0\4GPOS\0\0\1\xe4\0\0\0 \0\0\0 l\x91t\x8fGSUB\0\0\2\4"
@@ -47394,8 +47416,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "G\xe9m5\xc6\x80?\xf9\x81Q\xa0\xdf\x84H\x83\xca\x96\3oO`\4\x86\x33\xc3\x18\x8c"
       "V\x86\t\x18K\xc3\x14L\xe6\x86\x19\x98\xfe\xb7\x39\x98\x1d\r\v0_\x18\x96`a\xa8"
       "\xa8\x94\x1f\b\xb7Q\xa9\0\0\1P\x98\xdd\4\0\0",
-      26272 ) },
-    { "/fonts/opensans-extrabold-webfont.eot", std::string(
+      26272 } } } },
+    { "/fonts/opensans-extrabold-webfont.eot", { { {
       "\vQ\0\0\x11P\0\0\2\0\2\0\4\0\0\0\2\v\t\6\3\b\4\2\2\4\1\0 \3\0\0\4\0LP\xef\2\0"
       "\xe0[ \0@(\0\0\0\0\0\0\0\x9f\1\0 \0\0\0\0WFa\xc3\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0&\0O\0p\0\x65\0n\0 \0S\0\x61\0n\0s\0 \0\x45\0x\0t\0r\0\x61\0\x62\0o\0"
@@ -48215,8 +48237,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x8b\x8e\xbbR\xe5\xb8\n"
       "\x98\x13\xf9\xc0l\x11Z\xa2\xe2t\xb4\x8d\x63\xc9\xcc\x96\x9c\xe\f8\xd6\xc2\xa7"
       "\\^",
-      20747 ) },
-    { "/fonts/opensans-extrabolditalic-webfont.woff", std::string(
+      20747 } } } },
+    { "/fonts/opensans-extrabolditalic-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0\x64\xcc\0\x13\0\0\0\0\xb7L\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\x46\x46TM\0\0\1\xa8\0\0\0\x1c\0\0\0\x1c\x62\x61\xc1\xf2GDEF\0"
       "\0\1\xc4\0\0\0\x1e\0\0\0 \1\x17\0\4GPOS\0\0\1\xe4\0\0\0 \0\0\0 l\x91t\x8fGSU"
@@ -49226,8 +49248,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xae\xbb\x18\x98\x19\xc5\x19 |\xc6\r\x9cP\xc3\xb8\x81\xaa\x38\xff\x31iodv+\3"
       "r\xb9\x80\\nY8\x97\a\xa4\x8d\xb3\xfe?\3\\\x84\x17$\xc2\xc3(\1\x17\x89\xdc \xa2"
       "\r\0\xcb\x64\x37\xd1\0\0\0\1P\x98\xdc\xff\0\0",
-      25804 ) },
-    { "/fonts/opensans-regular-webfont.ttf", std::string(
+      25804 } } } },
+    { "/fonts/opensans-regular-webfont.ttf", { { {
       "\0\1\0\0\0\x13\1\0\0\4\0\x30\x46\x46TMb1a\xe7\0\0\1<\0\0\0\x1cGDEF\1\x17\0\4"
       "\0\0\1X\0\0\0 GPOSl\x91t\x8f\0\0\1x\0\0\0 GSUBy\xb3z\xd6\0\0\1\x98\0\0\0xOS/"
       "2\xa0\xe5\x99\x86\0\0\2\x10\0\0\0`cmap\x9f\xd0\x42*\0\0\2p\0\0\1\xe2\x63vt \x13"
@@ -50891,8 +50913,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x16\x9d\2+\xb1\3\x46v+D\xb0\x18 E\xb2\x17#\2+\xb1\3\x46v+D\xb0\x19 E\xb2\x18"
       "\x94\2+\xb1\3\x46v+D\xb0\x1a E\xb2\x19\x12\2+\xb1\3\x46v+DY\xb0\x14+\0\0\0\1"
       "P\x98\xdd\f\0\0",
-      42600 ) },
-    { "/fonts/opensans-lightitalic-webfont.svg", std::string(
+      42600 } } } },
+    { "/fonts/opensans-lightitalic-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -51842,8 +51864,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "085z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      60923 ) },
-    { "/fonts/opensans-extrabold-webfont.woff", std::string(
+      60923 } } } },
+    { "/fonts/opensans-extrabold-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0`\f\0\x13\0\0\0\0\xac,\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\x46\x46TM\0\0\1\xa8\0\0\0\x1c\0\0\0\x1c\x62I\x1a\xe6GDEF\0\0\1\xc4"
       "\0\0\0\x1e\0\0\0 \1\x17\0\4GPOS\0\0\1\xe4\0\0\0 \0\0\0 l\x91t\x8fGSUB\0\0\2\4"
@@ -52816,8 +52838,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe4\xb0\xd9\x42\x39,@\xe\xab,\x94\xc3\xeRv\x1d\xc2\x61\xdc\xc0\1\xd5\xcc\xa9"
       "\xe0\xba\x8b\x81\xa3\xfe?\3\x93\xf6\x46\x66\xb7\x32\xa0\b\x17P\x1d\xe7~\x18\x37"
       "r\x83\x88\x36\0|\xab,u\0\0\0\1P\x98\xdd\3\0\0",
-      24588 ) },
-    { "/fonts/copse_OFL.txt", std::string(
+      24588 } } } },
+    { "/fonts/copse_OFL.txt", { { {
       "Copyright (c) 2010, Daniel Rhatigan (sparky@ultrasparky.org)\n"
       "with Reserved Font Name Copse.\n"
       "This Font Software is licensed under the SIL Open Font License, Version 1.1."
@@ -52913,8 +52935,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "DAMAGES, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING\n"
       "FROM, OUT OF THE USE OR INABILITY TO USE THE FONT SOFTWARE OR FROM\n"
       "OTHER DEALINGS IN THE FONT SOFTWARE.\n",
-      4394 ) },
-    { "/fonts/opensans-extrabolditalic-webfont.svg", std::string(
+      4394 } } } },
+    { "/fonts/opensans-extrabolditalic-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -53850,8 +53872,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "135z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      60072 ) },
-    { "/fonts/opensans-bolditalic-webfont.eot", std::string(
+      60072 } } } },
+    { "/fonts/opensans-bolditalic-webfont.eot", { { {
       "<U\0\0ZT\0\0\2\0\2\0\4\0\0\0\2\v\b\6\3\5\4\2\2\4\1\1\xbc\2\0\0\4\0LP\xef\2\0"
       "\xe0[ \0@(\0\0\0\0\0\0\0\x9f\1\0 \0\0\0\0sm\xcc\x45\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\x12\0O\0p\0\x65\0n\0 \0S\0\x61\0n\0s\0\0\0\x16\0\x42\0o\0l\0\x64\0"
@@ -54717,8 +54739,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xb0\xc8\3\x1d\xe2`\xb6\1s\x82\x9bi\x13\x30\xce\xfa`\xc5\\\x14Vu\xd4\xe3\x16"
       "\xa3)\bn\xf\x8f\x85\x41$\0\x34)\xb0\x45\xa9\x98k\xb4\x80H\xc0+\xe4\x1c\"D\2\xcb"
       "\x88\xc7\xa0",
-      21820 ) },
-    { "/fonts/opensans-semibolditalic-webfont.svg", std::string(
+      21820 } } } },
+    { "/fonts/opensans-semibolditalic-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -55667,8 +55689,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "105z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      61071 ) },
-    { "/fonts/opensans-bold-webfont.svg", std::string(
+      61071 } } } },
+    { "/fonts/opensans-bold-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -56559,8 +56581,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "120z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      56480 ) },
-    { "/fonts/opensans-italic-webfont.ttf", std::string(
+      56480 } } } },
+    { "/fonts/opensans-italic-webfont.ttf", { { {
       "\0\1\0\0\0\x13\1\0\0\4\0\x30\x46\x46TMb_y\x1d\0\0\1<\0\0\0\x1cGDEF\1\x17\0\4"
       "\0\0\1X\0\0\0 GPOSl\x91t\x8f\0\0\1x\0\0\0 GSUBy\xb3z\xd6\0\0\1\x98\0\0\0xOS/"
       "2\xa0\xee\x91\t\0\0\2\x10\0\0\0`cmap\x9f\xd0\x42*\0\0\2p\0\0\1\xe2\x63vt \xf"
@@ -58488,8 +58510,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "v+D\xb0\x13 E\xb2\x12\x32\2+\xb1\3\x46v+D\xb0\x14 E\xb2\x13\x31\2+\xb1\3\x46"
       "v+D\xb0\x15 E\xb2\x14/\2+\xb1\3\x46v+D\xb0\x16 E\xb2\x15-\2+\xb1\3\x46v+D\xb0"
       "\x17 E\xb2\x16\x1f\2+\xb1\3\x46v+DY\xb0\x14+\0\0\0\0\1P\x98\xdd\xe\0\0",
-      48676 ) },
-    { "/fonts/opensans-regular-webfont.woff", std::string(
+      48676 } } } },
+    { "/fonts/opensans-regular-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0[\xe4\0\x13\0\0\0\0\xa6h\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\x46\x46TM\0\0\1\xa8\0\0\0\x1c\0\0\0\x1c\x62\x31\x61\xe7GDEF\0\0"
       "\1\xc4\0\0\0\x1e\0\0\0 \1\x17\0\4GPOS\0\0\1\xe4\0\0\0 \0\0\0 l\x91t\x8fGSUB\0"
@@ -59428,8 +59450,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x99\1\xe8\xff\xa7\xda`0ev\xc0\xf6\x84\xd9\5;wf\bv\x13\x66\4\x86Wf\xf\x8c\xbc"
       "\x1fs\n"
       "\xe4\x1b\xdf\x62h9\0\1P\x98\xdd\f\0\0",
-      23524 ) },
-    { "/fonts/ionicons.woff", std::string(
+      23524 } } } },
+    { "/fonts/ionicons.woff", { { {
       "wOFF\0\1\0\0\0\1\t\xdc\0\r\0\0\0\1\xd8\x1c\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\x46\x46TM\0\1\t\xc0\0\0\0\x1b\0\0\0\x1cm\x87\xb5 OS/2\0\0\1\xa0"
       "\0\0\0J\0\0\0`A9a\xd3\x63map\0\0\4\\\0\0\0\xce\0\0\1\xfam\2n\x1f\x63vt \0\0\5"
@@ -62036,7 +62058,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xd9\xe\xb6\xa3\xed\x64;\xdb.\xb6\xab\r\xb7\xddlw\xdb\xc3\xf6\xb4\xbdlo\xdb\xc7"
       "\xf6\xb5\xfdl\x7f;\xc0\xe\xb4\x83\xec`;\xc4\xe\xb5\xc3\xecp;\xc2\x8e\xb4\xa3"
       "\xech\x1b\x61#m\x94\x1d\x63\xc7\xdaqv\xbc\x9d`'\xdaIv\xb2\x9d\x62\xa7\xdaiv\xba",
-      65474) + std::string(
+      65474 },
+      {
       "\x9d\x61g\xdaYv\xb6\x9d\x63\xe7\xdayv\xbe]`\x17\xda\x45v\xb1]b\x97\xda\x65v\xb9"
       "]aW\xdaUv\xb5]c\xd7\xdauv\xbd\xdd`7\xdaMv\xb3\xdd\x62\xb7\xdamv\xbb\xdd\x61w"
       "\xda]v\xb7\xdd\x63\xa3\xed^\xbb\xcf\xee\xb7\a\xec\x41{\xc8\x1e\xb6G\xecQ{\xcc"
@@ -62144,8 +62167,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xa2\xff\xa2\xff\xa2\xff\xa2\xff\xa2\xff\xa2\xff\xa2\xff\xa2\xff\xa2\xff\xea"
       "\xd7\xff\1\xee\x7f\xd7\x7f\0\0\0\0\0\1\xff\xff\0\2x\xda\x63```d\0\x82\x33\xb6"
       "\x8b\xce\x83\xe8\vK9\xd5\xa1\xb4&\0\x45\xc9\5\xc8\0",
-      2586 ) },
-    { "/fonts/opensans-regular-webfont.svg", std::string(
+      2586 } } } },
+    { "/fonts/opensans-regular-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -63045,8 +63068,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "095z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      57431 ) },
-    { "/fonts/opensans-semibolditalic-webfont.woff", std::string(
+      57431 } } } },
+    { "/fonts/opensans-semibolditalic-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0\x65\xe0\0\x13\0\0\0\0\xc0\xc0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\0\0\x46\x46TM\0\0\1\xa8\0\0\0\x1c\0\0\0\x1c\x62_x\xfbGDEF\0\0"
       "\1\xc4\0\0\0\x1e\0\0\0 \1\x17\0\4GPOS\0\0\1\xe4\0\0\0 \0\0\0 l\x91t\x8fGSUB\0"
@@ -64073,8 +64096,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x17\3\x33\xa3\x30\3\x93\x36\x98\xcf\xaa\xe0\xba\x89-\x14\xca\x61\1rXu!\x1c\xc6"
       "\r\xecP-\x1c -\xec\xf5\xff\x81Z62\xbb\x95\1\x45\x38\x81\xea\x38J`\xdc\xc8\r\""
       "\xda\0q\x8b(\xe\0\0\0\0\1P\x98\xdd\x16\0\0",
-      26080 ) },
-    { "/fonts/opensans-semibolditalic-webfont.eot", std::string(
+      26080 } } } },
+    { "/fonts/opensans-semibolditalic-webfont.eot", { { {
       "\x19W\0\0'V\0\0\2\0\2\0\4\0\0\0\2\v\a\6\3\b\4\2\2\4\1\1X\2\0\0\4\0LP\xef\2\0"
       "\xe0[ \0@(\0\0\0\0\0\0\0\x9f\1\0 \0\0\0\0\xd9\xb4\tY\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0$\0O\0p\0\x65\0n\0 \0S\0\x61\0n\0s\0 \0S\0\x65\0m\0i\0\x62\0o\0l"
@@ -64967,8 +64990,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\4\x98\x1a\xf1\xf\x31\x61\f\xdd\x39\xfe%\xaf\xf0\xa5\xa9\xc8\xc2x\xc3@q\x94\xbf"
       "\x88\0\xaa\f\x8b\n"
       "J\xf4\xd3\x46\xa9t\xe8\x80",
-      22297 ) },
-    { "/fonts/opensans-lightitalic-webfont.ttf", std::string(
+      22297 } } } },
+    { "/fonts/opensans-lightitalic-webfont.ttf", { { {
       "\0\1\0\0\0\x13\1\0\0\4\0\x30\x46\x46TMb_y]\0\0\1<\0\0\0\x1cGDEF\1\x17\0\4\0\0"
       "\1X\0\0\0 GPOSl\x91t\x8f\0\0\1x\0\0\0 GSUBy\xb3z\xd6\0\0\1\x98\0\0\0xOS/2\xa0"
       "o\x95\xea\0\0\2\x10\0\0\0`cmap\x9f\xd0\x42*\0\0\2p\0\0\1\xe2\x63vt \n"
@@ -66931,8 +66954,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\2+\xb1\3\x46v+D\xb0\x10 E\xb2\xf*\2+\xb1\3\x46v+D\xb0\x11 E\xb2\x10(\2+\xb1"
       "\3\x46v+D\xb0\x12 E\xb2\x11^\2+\xb1\3\x46v+D\xb0\x13 E\xb2\x12-\2+\xb1\3\x46"
       "v+D\xb0\x14 E\xb2\x13-\2+\xb1\3\x46v+DY\xb0\x14+\0\0\0\0\1P\x98\xdd\4\0\0",
-      49560 ) },
-    { "/fonts/opensans-semibold-webfont.ttf", std::string(
+      49560 } } } },
+    { "/fonts/opensans-semibold-webfont.ttf", { { {
       "\0\1\0\0\0\x13\1\0\0\4\0\x30\x46\x46TMbI\x1a\xe0\0\0\1<\0\0\0\x1cGDEF\1\x17\0"
       "\4\0\0\1X\0\0\0 GPOSl\x91t\x8f\0\0\1x\0\0\0 GSUBy\xb3z\xd6\0\0\1\x98\0\0\0xO"
       "S/2\xa1\xcc\x92\x8e\0\0\2\x10\0\0\0`cmap\x9f\xd0\x42*\0\0\2p\0\0\1\xe2\x63vt"
@@ -68598,8 +68621,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe E\xb2\r\xf\2+\xb0\3+D\1\xb0\xf E\xb0\3+D\xb0\x10 E\xba\0\xf\x7f\xff\0\2+"
       "\xb1\3\x46v+D\xb0\x11 E\xba\0\x10\1\x1b\0\2+\xb1\3\x46v+DY\xb0\x14+\0\0\0\1P"
       "\x98\xdd\x14\0\0",
-      42648 ) },
-    { "/fonts/opensans-italic-webfont.eot", std::string(
+      42648 } } } },
+    { "/fonts/opensans-italic-webfont.eot", { { {
       "\xa7V\0\0\xd9U\0\0\2\0\2\0\4\0\0\0\2\v\6\6\3\5\4\2\2\4\1\1\x90\1\0\0\4\0LP\xef"
       "\2\0\xe0[ \0@(\0\0\0\0\0\0\0\x9f\1\0 \0\0\0\0\x97T\x17Z\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\x12\0O\0p\0\x65\0n\0 \0S\0\x61\0n\0s\0\0\0\f\0I\0t\0\x61\0l\0"
@@ -69476,8 +69499,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xb4\x9e\2o\xf8Z\x9f\x9d=\x97\xd3\xe8\xa5\xc9Ko\x1f\x14\6\xb8\x81\r\x88\xaa\xa3"
       "\v\xdb\1\x31 U\xc3\xa5n\x88\x94i\x18\"\x8e\xdcX,\xc1T\xb1\xb8\\\xefw\xb7\xef"
       "\x15U\xb7\xa8v\x16\5{\xd3H\xad\xda\x8d#\xa0\x8al+\6R\x9f@",
-      22183 ) },
-    { "/fonts/copse-regular-webfont.woff", std::string(
+      22183 } } } },
+    { "/fonts/copse-regular-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0~l\0\x11\0\0\0\0\xf0\x18\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\x46\x46TM\0\0\1\x80\0\0\0\x1c\0\0\0\x1c\x62 \2\x93GDEF\0\0\1\x9c"
       "\0\0\0\x1e\0\0\0 \1\x10\0\4OS/2\0\0\1\xbc\0\0\0O\0\0\0`H\xb5\x9f\xb1\x63map\0"
@@ -70758,8 +70781,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xed\xb2\x81\x45\xc1u\x13s,\x93\x36\x88\xc3\xb8\x81\x15*\xca\xe\x14\x65=\xce"
       "\xa4\xbd\x91\xd9\xad\f\xc8\x65\3r\xd9=\xe1\\\xe\5\xd7]\f\xac\xf5\xff\x19\xe0"
       "\"\x9c@\5\x1c\xa6\x30n\xe4\6\x11m\0\x1b\x39*\x17\0\1P\x98\xdd\4\0\0",
-      32364 ) },
-    { "/fonts/opensans-semibold-webfont.woff", std::string(
+      32364 } } } },
+    { "/fonts/opensans-semibold-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0\\\x9c\0\x13\0\0\0\0\xa6\x98\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\0\x46\x46TM\0\0\1\xa8\0\0\0\x1c\0\0\0\x1c\x62I\x1a\xe0GDEF\0\0"
       "\1\xc4\0\0\0\x1e\0\0\0 \1\x17\0\4GPOS\0\0\1\xe4\0\0\0 \0\0\0 l\x91t\x8fGSUB\0"
@@ -71703,8 +71726,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "!\xac\x18\x31!2\x8c\xc4\xd4/\x11\xc3J\xb0S*\x93%##\xa4%cJ\xc8\xf4\x17\x80\x9a"
       "_\xcb\xc7\xbd>\xf\xb4\xef\x65s\xa2\x64\x36&9,\xfe\x89\xc3\xc2\xbe\1\xa0\xb4\x42"
       "i\0\0\0\0\1P\x98\xdd\x14\0\0",
-      23708 ) },
-    { "/fonts/opensans-bold-webfont.ttf", std::string(
+      23708 } } } },
+    { "/fonts/opensans-bold-webfont.ttf", { { {
       "\0\1\0\0\0\x13\1\0\0\4\0\x30\x46\x46TMb>H\0\0\0\1<\0\0\0\x1cGDEF\1\x17\0\4\0"
       "\0\1X\0\0\0 GPOSl\x91t\x8f\0\0\1x\0\0\0 GSUBy\xb3z\xd6\0\0\1\x98\0\0\0xOS/2\xa2"
       "I\x9b\xe4\0\0\2\x10\0\0\0`cmap\x9f\xd0\x42*\0\0\2p\0\0\1\xe2\x63vt \xe\xee\x13"
@@ -73364,8 +73387,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\2+\xb0\3+D\xb0\5 E\xb2\6l\2+\xb0\3+D\xb0\4 E\xb2\5$\2+\xb0\3+D\1\xb0\a E\xb0"
       "\3+D\xb0\b E\xba\0\a\x7f\xff\0\2+\xb1\3\x46v+D\xb0\t E\xb2\b\xda\2+\xb1\3\x46"
       "v+DY\xb0\x14+\0\1P\x98\xdd\x11\0\0",
-      44016 ) },
-    { "/fonts/copse-regular-webfont.ttf", std::string(
+      44016 } } } },
+    { "/fonts/copse-regular-webfont.ttf", { { {
       "\0\1\0\0\0\x11\1\0\0\4\0\x10\x46\x46TMb \2\x93\0\0\1\x1c\0\0\0\x1cGDEF\1\x10"
       "\0\4\0\0\1\x38\0\0\0 OS/2H\xb5\x9f\xb1\0\0\1X\0\0\0`cmap\xee|\xdeV\0\0\1\xb8"
       "\0\0\1\xc2\x63vt \b\xec\f\xbe\0\0\3|\0\0\0\x1c\x66pgmS\xb4/\xa7\0\0\3\x98\0\0"
@@ -75869,8 +75892,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xb0\3 E\xb0\3+D\xb0\4 E\xb2\3]\2+\xb0\3+D\1\xb0\5 E\xb0\3+D\xb0\a E\xb2\5\xc7"
       "\2+\xb1\3\x46v+D\xb0\6 E\xb2\aI\2+\xb1\3\x46v+D\xb0\b E\xba\0\5\x7f\xff\0\2+"
       "\xb1\3\x46v+D\xb0\t E\xb2\b5\2+\xb1\3\x46v+DY\xb0\x14+\0\1P\x98\xdd\4\0\0",
-      61464 ) },
-    { "/fonts/opensans-italic-webfont.woff", std::string(
+      61464 } } } },
+    { "/fonts/opensans-italic-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0\x65\x98\0\x13\0\0\0\0\xbe$\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\x46\x46TM\0\0\1\xa8\0\0\0\x1c\0\0\0\x1c\x62_y\x1dGDEF\0\0\1\xc4"
       "\0\0\0\x1e\0\0\0 \1\x17\0\4GPOS\0\0\1\xe4\0\0\0 \0\0\0 l\x91t\x8fGSUB\0\0\2\4"
@@ -76894,8 +76917,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xfx#F\0\xf8\x43\x46\x1b\b\x18\x82:\x9c\xd2\xc5\xdb\x99\xea\xb2\x31\xca\v\x18"
       "\x82\xdd?{`\xb8Q\x8c\xc0\xdeZ1\6\xa3\x95\x62\2\xc6K\xc5>\x98\xcc\x15S\xb0?S\x1c"
       "\x80\xe9\xf8\xc7\x9a\x12\xf9\1\x9c$Z\xc2\0\1P\x98\xdd\xe\0\0",
-      26008 ) },
-    { "/fonts/copse-regular-webfont.eot", std::string(
+      26008 } } } },
+    { "/fonts/copse-regular-webfont.eot", { { {
       "\vo\0\0Gn\0\0\2\0\2\0\4\0\0\0\2\0\5\3\b\0\0\2\0\4\1\0\x90\1\0\0\4\0LP\3\0\0\x80"
       "\0\0\0\0\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\t\x93\x13\x41\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\n"
@@ -78040,8 +78063,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xc7\x91\x30\xbf\x44\xb2\xdc\x13\x36\t\x16\xc0\0J\x13\x16J\xde\xf3\5\n"
       "\x16\xf4\xb3\x8a\xce\x65\xbel[\t\"\xcb\x84Z\f\xe2\xc1/\xc8\x99\xfa\xe]J\v\x86"
       "c\2\x83\xc3\x32\x45~\xe0",
-      28427 ) },
-    { "/fonts/ionicons.eot", std::string(
+      28427 } } } },
+    { "/fonts/ionicons.eot", { { {
       "\xcc\xd8\1\0\x1c\xd8\1\0\1\0\2\0\0\0\0\0\2\0\6\3\0\0\0\0\0\0\1\0\xf4\1\0\0\0"
       "\0LP\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\0\1\0\0\0\0\0\0\0\xb7WX\x10\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\0\0\0\0\0\x10\0I\0o\0n\0i\0\x63\0o\0n\0s\0\0\0\f\0M\0\x65\0\x64"
@@ -80676,7 +80699,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x14\x17\x1e\1\x17\x16\x32\x37>\1\x37\x36\x34'.\1'&2\x16\x14\6\"&4\x17\"'&76"
       "\x17\x16\x37\x36\x37>\2\x37\x36\x17\x1e\1\x17\x16\x17\x16?\1\x36\x37\x36\x33"
       "2\x1e\4\x1f\1\x16\a\6'&'&#\"\a\xe\1\x15\6'&'.\1'&\xf\1\6\a\"\6\1\vV&#>\xe\x10",
-      65486) + std::string(
+      65486 },
+      {
       "\x10\xe>#&V&#>\xe\x10\x10\xe>#\xae\xba\x83\x83\xba\x83L\x17\x13\6\a\5\6\x11\x13"
       "\n"
       "\x1c\2\4\5\1\x15\x18\x11\x1e\a\v\x15\x17\x14\2\1\1\x17\x1d\6\r\n"
@@ -82688,8 +82712,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "4E8\auniF4E9\auniF4EA\auniF4EB\auniF4EC\auniF4ED\auniF4EE\auniF4EF\auniF4F0\a"
       "uniF4F1\auniF4F2\auniF4F3\auniF4F4\auniF4F5\auniF4F6\auniF4F7\0\0\0\0\0\1\xff"
       "\xff\0\2\0\0\0\1\0\0\0\0\xcc=\xa2\xcf\0\0\0\0\xd0\xa5\t'\0\0\0\0\xd0\xa5\t)",
-      55550 ) },
-    { "/fonts/opensans-lightitalic-webfont.eot", std::string(
+      55550 } } } },
+    { "/fonts/opensans-lightitalic-webfont.eot", { { {
       "xW\0\0\x92V\0\0\2\0\2\0\4\0\0\0\2\v\3\6\3\5\4\2\2\4\1\1,\1\0\0\4\0LP\xef\2\0"
       "\xe0[ \0@(\0\0\0\0\0\0\0\x9f\1\0 \0\0\0\0k\x97\xd8R\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\x1e\0O\0p\0\x65\0n\0 \0S\0\x61\0n\0s\0 \0L\0i\0g\0h\0t\0\0\0\f\0I"
@@ -83577,8 +83601,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x8d\x80^&\xbe\xef\"\xc4\x94\xa3L;\xe0Iq\5\x32\x16g\xb7&n\xe\xbd\xb3_\xd8\xf"
       "\1o\xf8\xf3\x61\xcd\x66'Y7\x15\x8c\n"
       "`\x14",
-      22392 ) },
-    { "/fonts/opensans-bolditalic-webfont.woff", std::string(
+      22392 } } } },
+    { "/fonts/opensans-bolditalic-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0\x64\x80\0\x13\0\0\0\0\xb7\xcc\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\0\0\x46\x46TM\0\0\1\xa8\0\0\0\x1c\0\0\0\x1c\x62_ypGDEF\0\0\1\xc4"
       "\0\0\0\x1e\0\0\0 \1\x17\0\4GPOS\0\0\1\xe4\0\0\0 \0\0\0 l\x91t\x8fGSUB\0\0\2\4"
@@ -84595,8 +84619,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe5Kx0\x17\xec\x80\x96~\xce\b\t\xc1\x84\x11\x11\xc2\x31\x63H\x88\xc2/\0\x63"
       "~-\xe9\xcb\xe2sGe\xad\xacN\x94\xa4}\x92@\xfeOFt\x99\x1e\x7f\x34\x98\xe9\x37}"
       "hF\x90\0\0\1P\x98\xdd\3\0\0",
-      25728 ) },
-    { "/fonts/ionicons.svg", std::string(
+      25728 } } } },
+    { "/fonts/ionicons.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -85788,7 +85812,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "d=\"M128 192c0 16 8 24 24 24s24 -8 24 -24s-8 -24 -24 -24s-24 8 -24 24zM200 1"
       "92c0 16 8 24 24 24s24 -8 24 -24s-8 -24 -24 -24s-24 8 -24 24zM272 192c0 16 8 "
       "24 24 24s24 -8 24 -24s-8 -24 -24 -24s-24 8 -24 24zM136 56c-7 0 -12 2 -17 7l-",
-      65477) + std::string(
+      65477 },
+      {
       "112 112c-5 5 -7 10 -7 17\n"
       "s2 12 7 17l112 112c5 5 10 7 17 7s12 -2 17 -7s7 -10 7 -17s-2 -12 -7 -17l-95 -"
       "95l95 -95c5 -5 7 -10 7 -17s-2 -12 -7 -17s-10 -7 -17 -7zM312 56c-7 0 -12 2 -1"
@@ -86955,7 +86980,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "    <glyph glyph-name=\"ion-ios-email-outline\" unicode=\"&#xf422;\" horiz-a"
       "dv-x=\"384\" \n"
       "d=\"M0 320h384v-256h-384v256zM192 180l163 124h-326zM16 80h352v214l-115 -88l6",
-      65485) + std::string(
+      65485 },
+      {
       "8 -77l-2 -2l-79 70l-48 -37l-48 37l-79 -70l-2 2l68 77l-115 88v-214z\" />\n"
       "    <glyph glyph-name=\"ion-ios-email\" unicode=\"&#xf423;\" horiz-adv-x=\"3"
       "84\" \n"
@@ -88098,7 +88124,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "    <glyph glyph-name=\"ion-ios-search\" unicode=\"&#xf4a5;\" horiz-adv-x=\""
       "384\" \n"
       "d=\"M384 23l-23 -23l-113 113c-26 -21 -60 -33 -96 -33c-84 0 -152 68 -152 152s",
-      65504) + std::string(
+      65504 },
+      {
       "68 152 152 152s152 -68 152 -152c0 -36 -12 -69 -33 -95zM56 135c26 -26 60 -39 "
       "96 -39s70 14 96 40s40 60 40 96s-14 70 -40 96s-60 40 -96 40s-70 -14 -96 -40s-"
       "40 -60 -40 -96\n"
@@ -89248,7 +89275,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "-44 -56h186\n"
       "c-4 18 -15 43 -44 56l-10 4c-12 4 -25 6 -39 6v0v0h-1zM105 384v0h1l19 -23c13 5"
       " 30 9 50 9h1c20 0 36 -4 50 -9l20 23v0s1 -1 2 -1c1 -1 2 -3 2 -3l-19 -22c48 -2",
-      65511) + std::string(
+      65511 },
+      {
       "1 56 -71 57 -86h-224c1 15 9 66 57 87l-19 22c0 1 1 1 2 2zM127 309c-7 0 -14 6 "
       "-14 13s6 14 14 14\n"
       "c7 0 13 -7 13 -14s-5 -13 -13 -13zM225 309c-7 0 -13 6 -13 13s5 14 13 14c7 0 1"
@@ -90371,7 +90399,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "192l10 -82c-16 -12 -112 -78 -144 -110c-32 32 -128 98 -144 110l9 82l135 -88z\""
       " />\n"
       "    <glyph glyph-name=\"ion-unlocked\" unicode=\"&#xf254;\" horiz-adv-x=\"38",
-      65491) + std::string(
+      65491 },
+      {
       "4\" \n"
       "d=\"M22 -32c-12 0 -22 10 -22 22v212c0 12 10 22 22 22h3h19v31c0 42 17 87 43 1"
       "15s64 46 105 46v0v0c41 0 79 -18 105 -46c20 -21 33 -51 39 -82h-53c-5 18 -13 3"
@@ -90490,8 +90519,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "3 94s57 -37 103 -94z\" />\n"
       "  </font>\n"
       "</defs></svg>\n",
-      6815 ) },
-    { "/fonts/opensans-bold-webfont.woff", std::string(
+      6815 } } } },
+    { "/fonts/opensans-bold-webfont.woff", { { {
       "wOFF\0\1\0\0\0\0_\b\0\x13\0\0\0\0\xab\xf0\0\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\x46\x46TM\0\0\1\xa8\0\0\0\x1c\0\0\0\x1c\x62>H\0GDEF\0\0\1\xc4\0"
       "\0\0\x1e\0\0\0 \1\x17\0\4GPOS\0\0\1\xe4\0\0\0 \0\0\0 l\x91t\x8fGSUB\0\0\2\4\0"
@@ -91451,8 +91480,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "0\x87\x15\xc8\x61\xcb\x81rX\x80\x1cV\x15\b\x87q\3;T=\x87\x82\xeb.\6\xf6\xfa\xff"
       "\fL\xda\x1b\x99\xdd\xca\x80\"\x9c@u\x1c\xb7`\xdc\xc8\r\"\xda\0\x87\x44)`\0\1"
       "P\x98\xdd\x11\0\0",
-      24328 ) },
-    { "/fonts/opensans-regular-webfont.eot", std::string(
+      24328 } } } },
+    { "/fonts/opensans-regular-webfont.eot", { { {
       "\xa6M\0\0\xd4L\0\0\2\0\2\0\4\0\0\0\2\v\6\6\3\5\4\2\2\4\1\0\x90\1\0\0\4\0LP\xef"
       "\2\0\xe0[ \0@(\0\0\0\0\0\0\0\x9f\1\0 \0\0\0\0n\6!\xaa\0\0\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\x12\0O\0p\0\x65\0n\0 \0S\0\x61\0n\0s\0\0\0\xe\0R\0\x65\0g\0u\0l"
@@ -92249,8 +92278,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "o\xa6\x35\xb6\xc1k\6[\2\x37\x31\x66\xcc\xdb\x42\xb6\xed|v\xecU\6\x8c\xf1\2\n"
       "JK\x8d\x45\xdb\xec\x37\xed\0\xd1\x1a\x45'a\x15\0\x8e[S\x80\xc1):\xd7\xa0\xaa"
       "\r\x96\xf4\x8b\xd8\2P\0",
-      19878 ) },
-    { "/fonts/opensans-extrabold-webfont.svg", std::string(
+      19878 } } } },
+    { "/fonts/opensans-extrabold-webfont.svg", { { {
       "<?xml version=\"1.0\" standalone=\"no\"?>\n"
       "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\" \"http://www.w3.org/Graphic"
       "s/SVG/1.1/DTD/svg11.dtd\" >\n"
@@ -93156,8 +93185,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "135z\" />\n"
       "</font>\n"
       "</defs></svg> ",
-      57284 ) },
-    { "/fonts/opensans-extrabold-webfont.ttf", std::string(
+      57284 } } } },
+    { "/fonts/opensans-extrabold-webfont.ttf", { { {
       "\0\1\0\0\0\x13\1\0\0\4\0\x30\x46\x46TMbI\x1a\xe6\0\0\1<\0\0\0\x1cGDEF\1\x17\0"
       "\4\0\0\1X\0\0\0 GPOSl\x91t\x8f\0\0\1x\0\0\0 GSUBy\xb3z\xd6\0\0\1\x98\0\0\0xO"
       "S/2\xa2\xb7\x9d\x85\0\0\2\x10\0\0\0`cmap\x9f\xd0\x42*\0\0\2p\0\0\1\xe2\x63vt"
@@ -94923,8 +94952,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\3\xd7\2+\xb0\3+D\1\xb0\b E\xb0\3+D\xb0\t E\xba\0\b\x7f\xff\0\2+\xb1\3\x46v+"
       "D\xb0\n"
       " E\xb2\t\xbf\2+\xb1\3\x46v+DY\xb0\x14+\0\0\0\0\1P\x98\xdd\3\0\0",
-      44076 ) },
-    { "/fonts/opensans-bolditalic-webfont.ttf", std::string(
+      44076 } } } },
+    { "/fonts/opensans-bolditalic-webfont.ttf", { { {
       "\0\1\0\0\0\x13\1\0\0\4\0\x30\x46\x46TMb_yp\0\0\1<\0\0\0\x1cGDEF\1\x17\0\4\0\0"
       "\1X\0\0\0 GPOSl\x91t\x8f\0\0\1x\0\0\0 GSUBy\xb3z\xd6\0\0\1\x98\0\0\0xOS/2\xa2"
       "M\x93\xa9\0\0\2\x10\0\0\0`cmap\x9f\xd0\x42*\0\0\2p\0\0\1\xe2\x63vt !\x15\x19"
@@ -96710,8 +96739,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\xe E\xb2\r\f\2+\xb0\3+D\1\xb0\xf E\xb0\3+D\xb0\x10 E\xba\0\xf\x7f\xff\0\2+\xb1"
       "\3\x46v+D\xb0\x11 E\xba\0\x10\1\x1a\0\2+\xb1\3\x46v+D\xb0\x12 E\xb2\x11p\2+\xb1"
       "\3\x46v+DY\xb0\x14+\0\0\0\0\1P\x98\xdd\3\0\0",
-      47052 ) },
-    { "/fonts/opensans-light-webfont.ttf", std::string(
+      47052 } } } },
+    { "/fonts/opensans-light-webfont.ttf", { { {
       "\0\1\0\0\0\x13\1\0\0\4\0\x30\x46\x46TMb>E*\0\0\1<\0\0\0\x1cGDEF\1\x17\0\4\0\0"
       "\1X\0\0\0 GPOSl\x91t\x8f\0\0\1x\0\0\0 GSUBy\xb3z\xd6\0\0\1\x98\0\0\0xOS/2\xa0"
       "x\x96\x17\0\0\2\x10\0\0\0`cmap\x9f\xd0\x42*\0\0\2p\0\0\1\xe2\x63vt \n"
@@ -98326,8 +98355,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "+\xb1\3\x46v+D\xb0\x11 E\xb2\x10*\2+\xb1\3\x46v+D\xb0\x12 E\xb2\x11(\2+\xb1\3"
       "Fv+D\xb0\x13 E\xb2\x12'\2+\xb1\3\x46v+D\xb0\x14 E\xb2\x13%\2+\xb1\3\x46v+D\xb0"
       "\x15 E\xb2\x14%\2+\xb1\3\x46v+DY\xb0\x14+\0\0\1P\x98\xdc\xff\0\0",
-      41956 ) },
-    { "/fonts/opensans-bold-webfont.eot", std::string(
+      41956 } } } },
+    { "/fonts/opensans-bold-webfont.eot", { { {
       "cP\0\0\x9dO\0\0\2\0\2\0\4\0\0\0\2\v\b\6\3\5\4\2\2\4\1\0\xbc\2\0\0\4\0LP\xef\2"
       "\0\xe0[ \0@(\0\0\0\0\0\0\0\x9f\1\0 \0\0\0\0$\x88\xe0\x83\0\0\0\0\0\0\0\0\0\0"
       "\0\0\0\0\0\0\0\0\x12\0O\0p\0\x65\0n\0 \0S\0\x61\0n\0s\0\0\0\b\0\x42\0o\0l\0\x64"
@@ -99145,8 +99174,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "%\x92\x93P\6\x8c\xda\x44\xdd\xc1W\x90\x91\"$\xc4\x38\xc4L9y\2\xef\xa4M\xec\xf1"
       "\xdd\xdb\xc9\x90\xd5\xbc\xbaI\t\x91\f\xe1\x41l\xf1p\a\xe9\x93\x13\x9c\x41\xff"
       "z\xac\xae\x46/c\x80'\x17\xb3\xebJ$||\xa7o(\xe0",
-      20579 ) },
-    { "/fonts/opensans-semibolditalic-webfont.ttf", std::string(
+      20579 } } } },
+    { "/fonts/opensans-semibolditalic-webfont.ttf", { { {
       "\0\1\0\0\0\x13\1\0\0\4\0\x30\x46\x46TMb_x\xfb\0\0\1<\0\0\0\x1cGDEF\1\x17\0\4"
       "\0\0\1X\0\0\0 GPOSl\x91t\x8f\0\0\1x\0\0\0 GSUBy\xb3z\xd6\0\0\1\x98\0\0\0xOS/"
       "2\xa1\xd3\x92R\0\0\2\x10\0\0\0`cmap\x9f\xd0\x42*\0\0\2p\0\0\1\xe2\x63vt \x12"
@@ -101050,8 +101079,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\x13\0\2+\xb0\3+D\xb0\5 E\xb2\6U\2+\xb0\3+D\xb0\4 E\xb2\5-\2+\xb0\3+D\1\xb0\a"
       " E\xb0\3+D\xb0\b E\xba\0\a\x7f\xff\0\2+\xb1\3\x46v+D\xb0\t E\xb2\bt\2+\xb1\3"
       "Fv+DY\xb0\x14+\0\0\1P\x98\xdd\x16\0\0",
-      49344 ) },
-    { "/js/cubism.v1.js", std::string(
+      49344 } } } },
+    { "/js/cubism.v1.js", { { {
       "(function(exports){\n"
       "var cubism = exports.cubism = {version: \"1.0.0\"};\n"
       "var cubism_id = 0;\n"
@@ -102076,8 +102105,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  return rule;\n"
       "};\n"
       "})(this);\n",
-      29224 ) },
-    { "/js/d3.v2.min.js", std::string(
+      29224 } } } },
+    { "/js/d3.v2.min.js", { { {
       "(function(){function e(a,b){try{for(var c in b)Object.defineProperty(a.proto"
       "type,c,{value:b[c],enumerable:!1})}catch(d){a.prototype=b}}function g(a){var"
       " b=-1,c=a.length,d=[];while(++b<c)d.push(a[b]);return d}function h(a){return"
@@ -102956,7 +102985,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "=function(){function c(c,d){return(dr.get(a.call(this,c,d))||dq)(b.call(this"
       ",c,d))}var a=dp,b=dn;return c.type=function(b){return arguments.length?(a=d3"
       ".functor(b),c):a},c.size=function(a){return arguments.length?(b=d3.functor(a",
-      65487) + std::string(
+      65487 },
+      {
       "),c):b},c};var dr=d3.map({circle:dq,cross:function(a){var b=\n"
       "Math.sqrt(a/5)/2;return\"M\"+ -3*b+\",\"+ -b+\"H\"+ -b+\"V\"+ -3*b+\"H\"+b+\""
       "V\"+ -b+\"H\"+3*b+\"V\"+b+\"H\"+b+\"V\"+3*b+\"H\"+ -b+\"V\"+b+\"H\"+ -3*b+\""
@@ -103570,8 +103600,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "liseconds()}]],gh=fZ(gg);gf.year=function(a,b){return gd.domain(a.map(gj)).t"
       "icks(b).map(gi)},d3.time.scale.utc=function(){return fW(d3.scale.linear(),gf"
       ",gh)}})();\n",
-      45647 ) },
-    { "/js/underscore-min.js", std::string(
+      45647 } } } },
+    { "/js/underscore-min.js", { { {
       "//     Underscore.js 1.7.0\n"
       "//     http://underscorejs.org\n"
       "//     (c) 2009-2014 Jeremy Ashkenas, DocumentCloud and Investigative Report"
@@ -103784,8 +103814,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "wrapped},\"function\"==typeof define&&define.amd&&define(\"underscore\",[],f"
       "unction(){return h})}).call(this);\n"
       "//# sourceMappingURL=underscore-min.map",
-      15626 ) },
-    { "/js/less-1.1.4.min.js", std::string(
+      15626 } } } },
+    { "/js/less-1.1.4.min.js", { { {
       "//\n"
       "// LESS - Leaner CSS v1.1.4\n"
       "// http://lesscss.org\n"
@@ -104276,8 +104306,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "+\"ms\"),e.remaining===0&&t(\"css generated in \"+(new Date-b)+\"ms\"),c=new"
       " Date},a),l()},d.refreshStyles=l,d.refresh(d.env===\"development\")})(window"
       ")\n",
-      35349 ) },
-    { "/js/date-en-US.js", std::string(
+      35349 } } } },
+    { "/js/date-en-US.js", { { {
       "/**\n"
       " * @version: 1.0 Alpha-1\n"
       " * @author: Coolite Inc. http://www.coolite.com/\n"
@@ -104765,8 +104795,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "catch(e){return null;}\n"
       "return((r[1].length===0)?r[0]:null);};};$D.parseExact=function(s,fx){return "
       "$D.getParseFunction(fx)(s);};}());\n",
-      30638 ) },
-    { "/js/handlebars.runtime-1.0.0.js", std::string(
+      30638 } } } },
+    { "/js/handlebars.runtime-1.0.0.js", { { {
       "/*\n"
       "\n"
       "Copyright (C) 2011 by Yehuda Katz\n"
@@ -105157,8 +105187,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "// lib/handlebars/browser-suffix.js\n"
       "})(Handlebars);\n"
       ";\n",
-      10982 ) },
-    { "/js/xdate.js", std::string(
+      10982 } } } },
+    { "/js/xdate.js", { { {
       "/*\n"
       " XDate v0.7\n"
       " Docs & Licensing: http://arshaw.com/xdate/\n"
@@ -105267,8 +105297,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "(){return new g(+this[0])};f.now=function(){return+new g};f.today=function()"
       "{return(new f).clearTime()};f.UTC=n;f.getDaysInMonth=E;if(typeof module!==\""
       "undefined\"&&module.exports)module.exports=f;return f}(Date,Math,Array);\n",
-      7272 ) },
-    { "/js/backbone.js", std::string(
+      7272 } } } },
+    { "/js/backbone.js", { { {
       "//     Backbone.js 1.1.2\n"
       "\n"
       "//     (c) 2010-2014 Jeremy Ashkenas, DocumentCloud and Investigative Report"
@@ -107037,8 +107067,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  return Backbone;\n"
       "\n"
       "}));\n",
-      60997 ) },
-    { "/js/jquery.lightbox_me.js", std::string(
+      60997 } } } },
+    { "/js/jquery.lightbox_me.js", { { {
       "/*\n"
       "* $ lightbox_me\n"
       "* By: Buck Wilson\n"
@@ -107329,8 +107359,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "        overlayCSS: {background: 'black', opacity: .3}\n"
       "    }\n"
       "})(jQuery);\n",
-      10578 ) },
-    { "/js/jquery.form.js", std::string(
+      10578 } } } },
+    { "/js/jquery.form.js", { { {
       "/*!\n"
       " * jQuery Form Plugin\n"
       " * version: 2.84 (12-AUG-2011)\n"
@@ -108309,8 +108339,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "};\n"
       "\n"
       "})(jQuery);\n",
-      26751 ) },
-    { "/js/ZeroClipboard.min.js", std::string(
+      26751 } } } },
+    { "/js/ZeroClipboard.min.js", { { {
       "/*!\n"
       "* ZeroClipboard\n"
       "* The ZeroClipboard library provides an easy way to copy text to the clipboa"
@@ -108454,8 +108484,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "function(a,b,c){return t=c&&c.id||null,p}):\"object\"==typeof module&&module"
       "&&\"object\"==typeof module.exports&&module.exports?(u=module.id||null,modul"
       "e.exports=p):window.ZeroClipboard=p}();",
-      10093 ) },
-    { "/js/backbone-min.js", std::string(
+      10093 } } } },
+    { "/js/backbone-min.js", { { {
       "(function(t,e){if(typeof define===\"function\"&&define.amd){define([\"unders"
       "core\",\"jquery\",\"exports\"],function(i,r,s){t.Backbone=e(t,s,i,r)})}else "
       "if(typeof exports!==\"undefined\"){var i=require(\"underscore\");e(t,exports"
@@ -108726,8 +108756,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "n(t,e){var i=e.error;e.error=function(r){if(i)i(t,r,e);t.trigger(\"error\",t"
       ",r,e)}};return e});\n"
       "//# sourceMappingURL=backbone-min.map",
-      19999 ) },
-    { "/js/jquery.timeago.js", std::string(
+      19999 } } } },
+    { "/js/jquery.timeago.js", { { {
       "/*\n"
       " * timeago: a jQuery plugin, version: 0.9.3 (2011-01-21)\n"
       " * @requires jQuery v1.2.3 or later\n"
@@ -108882,8 +108912,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  document.createElement(\"abbr\");\n"
       "  document.createElement(\"time\");\n"
       "}(jQuery));\n",
-      4543 ) },
-    { "/js/jquery-1.7.2.min.js", std::string(
+      4543 } } } },
+    { "/js/jquery-1.7.2.min.js", { { {
       "/*! jQuery v1.7.2 jquery.com | jquery.org/license */\n"
       "(function(a,b){function cy(a){return f.isWindow(a)?a:a.nodeType===9?a.defaul"
       "tView||a.parentWindow:!1}function cu(a){if(!cj[a]){var b=c.body,d=f(\"<\"+a+"
@@ -109758,7 +109788,8 @@ std::map<std::string, const std::string> static_web_assets = {
       ",j,k,l,m,n,o,p,q,r,s;if(!(a.nodeType===3||a.nodeType===8||!c||!d||!(h=f._dat"
       "a(a)))){d.handler&&(p=d,d=p.handler,g=p.selector),d.guid||(d.guid=f.guid++),"
       "j=h.events,j||(h.events=j={}),i=h.handle,i||(h.handle=i=function(a){return t",
-      65512) + std::string(
+      65512 },
+      {
       "ypeof f!=\"undefined\"&&(!a||f.event.triggered!==a.type)?f.event.dispatch.ap"
       "ply(i.elem,arguments):b},i.elem=a),c=f.trim(I(c)).split(\" \");for(k=0;k<c.l"
       "ength;k++){l=A.exec(c[k])||[],m=l[1],n=(l[2]||\"\").split(\".\").sort(),s=f."
@@ -110591,8 +110622,8 @@ std::map<std::string, const std::string> static_web_assets = {
       ".css(a,c),l=parseFloat(k);return f.isNumeric(l)?l:k}f(a).css(c,h)},c,a,argum"
       "ents.length,null)}}),a.jQuery=a.$=f,typeof define==\"function\"&&define.amd&"
       "&define.amd.jQuery&&define(\"jquery\",[],function(){return f})})(window);\n",
-      61743 ) },
-    { "/js/ZeroClipboard.swf", std::string(
+      61743 } } } },
+    { "/js/ZeroClipboard.swf", { { {
       "CWS\xe\x95\f\0\0x\xda\x8dV\xcdr\xdb\xc8\x11\x9e\1\1\f\0\x92\x12I\xc9\x94,\xff"
       "\xc1\xb6\xd6\xb2\xb4\x90HQ^\xefZ\x96\xb5\x96I\xc9\x96-\x89\x1bK\xb2\x37^\xdb"
       "\xcb!0\x10\x61\x83\0\3\x80\xfaIj+\xae\xad\xca#\xe4\x98*\xe7\x92Sny\x80<@*)H\xae"
@@ -110670,8 +110701,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "h%\xf5\1\xca\x1f\x9fT\x1f&\xc0U\x8a\xc3X\xba\x1a\x16\x19\xaa\xe1\x62\xedQ\xb1"
       "\xb6Q\xacm\x16k[\xc5\x9a\4\xbf/\xd1\x85\xf8j\x10P\xcd\x8d\x44S:\xf8o\xf3. \xff"
       "\5\x1d\xaa\x8f'",
-      1966 ) },
-    { "/js/jquery.dataTables.min.js", std::string(
+      1966 } } } },
+    { "/js/jquery.dataTables.min.js", { { {
       "/*\n"
       " * File:        jquery.dataTables.min.js\n"
       " * Version:     1.9.1\n"
@@ -111606,7 +111637,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "tonset ui-buttonset fg-buttonset-multi ui-buttonset-multi paging_\",\n"
       "sSortAsc:\"ui-state-default\",sSortDesc:\"ui-state-default\",sSortable:\"ui-"
       "state-default\",sSortableAsc:\"ui-state-default\",sSortableDesc:\"ui-state-d",
-      65499) + std::string(
+      65499 },
+      {
       "efault\",sSortableNone:\"ui-state-default\",sSortJUIAsc:\"css_right ui-icon "
       "ui-icon-triangle-1-n\",sSortJUIDesc:\"css_right ui-icon ui-icon-triangle-1-s"
       "\",sSortJUI:\"css_right ui-icon ui-icon-carat-2-n-s\",sSortJUIAscAllowed:\"c"
@@ -111682,8 +111714,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "{return\"string\"===typeof e&&-1!=e.indexOf(\"<\")&&-1!=e.indexOf(\">\")?\"h"
       "tml\":null}]);h.fn.DataTable=j;h.fn.dataTable=j;h.fn.dataTableSettings=j.set"
       "tings;h.fn.dataTableExt=j.ext})(jQuery,window,document,void 0);\n",
-      5246 ) },
-    { "/js/reql_docs.js", std::string(
+      5246 } } } },
+    { "/js/reql_docs.js", { { {
       "// The contents of reql_docs were generated by _scripts/dataexplorer.py from"
       " the rethinkdb documentation in http://github.com/rethinkdb/docs\n"
       "// hash: \"186fb20ea9911710e910acfab0f4f221d59d7c04\"\n"
@@ -113551,7 +113583,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "    \"url\": \"le\"\n"
       "  }, \n"
       "  \"api/javascript/limit/\": {\n",
-      65469) + std::string(
+      65469 },
+      {
       "    \"body\": \"sequence.limit(n) &rarr; streamarray.limit(n) &rarr; array\""
       ", \n"
       "    \"description\": \"<p>End the sequence after the given number of element"
@@ -115175,8 +115208,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "    \"url\": \"zip\"\n"
       "  }\n"
       "}\n",
-      56267 ) },
-    { "/js/underscore-min.map", std::string(
+      56267 } } } },
+    { "/js/underscore-min.map", { { {
       "{\"version\":3,\"file\":\"underscore-min.js\",\"sources\":[\"underscore.js\""
       "],\"names\":[\"root\",\"this\",\"previousUnderscore\",\"_\",\"ArrayProto\",\""
       "Array\",\"prototype\",\"ObjProto\",\"Object\",\"FuncProto\",\"Function\",\"p"
@@ -115520,8 +115553,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "hC,KAAK/B,KAAM+E,EAAO3C,MAAMpC,KAAKsB,SAAUe,eAKzDnC,EAAEG,UAAUyB,MAAQ,WAClB,"
       "MAAO9B,MAAKsB,UAUQ,kBAAX8Q,SAAyBA,OAAOC,KACzCD,OAAO,gBAAkB,WACvB,MAAOlS,OAGX"
       "6B,KAAK/B\"}",
-      25382 ) },
-    { "/js/jquery.color.js", std::string(
+      25382 } } } },
+    { "/js/jquery.color.js", { { {
       "/*\n"
       " * jQuery Color Animations v@VERSION\n"
       " * http://jquery.org/\n"
@@ -116207,8 +116240,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\t\t_default: \"#ffffff\"\n"
       "\t};\n"
       "})( jQuery );\n",
-      16160 ) },
-    { "/js/rdb_cubism.v1.js", std::string(
+      16160 } } } },
+    { "/js/rdb_cubism.v1.js", { { {
       "(function(exports){\n"
       "var cubism = exports.cubism = {version: \"1.0.0\"};\n"
       "var cubism_id = 0;\n"
@@ -117482,8 +117515,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  return rule;\n"
       "};\n"
       "})(this);\n",
-      36622 ) },
-    { "/js/codemirror/codemirror.css", std::string(
+      36622 } } } },
+    { "/js/codemirror/codemirror.css", { { {
       "/* BASICS */\n"
       "\n"
       ".CodeMirror {\n"
@@ -117736,8 +117769,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "    visibility: hidden;\n"
       "  }\n"
       "}\n",
-      5813 ) },
-    { "/js/codemirror/codemirror.js", std::string(
+      5813 } } } },
+    { "/js/codemirror/codemirror.js", { { {
       "// CodeMirror is the only global var we claim\n"
       "window.CodeMirror = (function() {\n"
       "  \"use strict\";\n"
@@ -119530,7 +119563,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "    var x, y, space = getRect(display.lineSpace);\n"
       "    // Fails unpredictably on IE[67] when mouse is dragged around quickly.\n"
       "    try { x = e.clientX; y = e.clientY; } catch (e) { return null; }\n",
-      65471) + std::string(
+      65471 },
+      {
       "    return coordsChar(cm, x - space.left, y - space.top);\n"
       "  }\n"
       "\n"
@@ -121412,7 +121446,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "    indentMore: function(cm) {cm.indentSelection(\"add\");},\n"
       "    indentLess: function(cm) {cm.indentSelection(\"subtract\");},\n"
       "    insertTab: function(cm) {cm.replaceSelection(\"\\t\", \"end\", \"+input\"",
-      65488) + std::string(
+      65488 },
+      {
       ");},\n"
       "    defaultTab: function(cm) {\n"
       "      if (cm.somethingSelected()) cm.indentSelection(\"add\");\n"
@@ -123300,7 +123335,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\n"
       "  function on(emitter, type, f) {\n"
       "    if (emitter.addEventListener)\n",
-      65456) + std::string(
+      65456 },
+      {
       "      emitter.addEventListener(type, f, false);\n"
       "    else if (emitter.attachEvent)\n"
       "      emitter.attachEvent(\"on\" + type, f);\n"
@@ -123882,8 +123918,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "\n"
       "  return CodeMirror;\n"
       "})();\n",
-      20723 ) },
-    { "/js/codemirror/ambiance.css", std::string(
+      20723 } } } },
+    { "/js/codemirror/ambiance.css", { { {
       "/* ambiance theme for code-mirror */\n"
       "\n"
       "/* Color scheme */\n"
@@ -124277,8 +124313,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "T+LtZflvuc8Q3CjwWkq8KwUpHzkK/NmSsclCL0nseQdj5FRH5CNHSgtLiW80Of5HU9Hhlsga9bnB"
       "q3fEVltKfO5IaSTmGjjc4J0otcP7QsJUSQM8pEj5/wCuUuC2DWz8AAAAAElFTkSuQmCC\");\n"
       "}\n",
-      26135 ) },
-    { "/js/codemirror/matchbrackets.js", std::string(
+      26135 } } } },
+    { "/js/codemirror/matchbrackets.js", { { {
       "(function() {\n"
       "  var ie_lt8 = /MSIE \\d/.test(navigator.userAgent) &&\n"
       "    (document.documentMode == null || document.documentMode < 8);\n"
@@ -124379,8 +124415,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  CodeMirror.defineExtension(\"findMatchingBracket\", function(){return find"
       "MatchingBracket(this);});\n"
       "})();\n",
-      3739 ) },
-    { "/js/codemirror/javascript.js", std::string(
+      3739 } } } },
+    { "/js/codemirror/javascript.js", { { {
       "//TODO CLean this thing\n"
       "CodeMirror.defineMode(\"javascript\", function(config, parserConfig) {\n"
       "  var indentUnit = config.indentUnit;\n"
@@ -124780,8 +124816,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "CodeMirror.defineMIME(\"text/javascript\", \"javascript\");\n"
       "CodeMirror.defineMIME(\"application/json\", {name: \"javascript\", json: tru"
       "e});\n",
-      12940 ) },
-    { "/js/bootstrap/bootstrap-tooltip.js", std::string(
+      12940 } } } },
+    { "/js/bootstrap/bootstrap-tooltip.js", { { {
       "/* ===========================================================\n"
       " * Forked from bootstrap-tooltip to provide a fadeIn (in `show`)\n"
       " * ========================================================== */\n"
@@ -125108,8 +125144,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  }\n"
       "\n"
       "}( window.jQuery );\n",
-      8901 ) },
-    { "/js/bootstrap/bootstrap-dropdown.js", std::string(
+      8901 } } } },
+    { "/js/bootstrap/bootstrap-dropdown.js", { { {
       "/* ============================================================\n"
       " * bootstrap-dropdown.js v2.0.2\n"
       " * http://twitter.github.com/bootstrap/javascript.html#dropdowns\n"
@@ -125204,8 +125240,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  })\n"
       "\n"
       "}( window.jQuery );\n",
-      2559 ) },
-    { "/js/bootstrap/bootstrap-collapse.js", std::string(
+      2559 } } } },
+    { "/js/bootstrap/bootstrap-collapse.js", { { {
       "/* =============================================================\n"
       " * bootstrap-collapse.js v2.0.2\n"
       " * http://twitter.github.com/bootstrap/javascript.html#collapse\n"
@@ -125347,8 +125383,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  })\n"
       "\n"
       "}( window.jQuery );\n",
-      3958 ) },
-    { "/js/bootstrap/bootstrap-typeahead.js", std::string(
+      3958 } } } },
+    { "/js/bootstrap/bootstrap-typeahead.js", { { {
       "/*\n"
       "Using fork from here: https://gist.github.com/1866577\n"
       "For additional functionality\n"
@@ -125670,8 +125706,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  })\n"
       "\n"
       "}( window.jQuery );\n",
-      7811 ) },
-    { "/js/bootstrap/bootstrap-typeahead.js.fork.backup", std::string(
+      7811 } } } },
+    { "/js/bootstrap/bootstrap-typeahead.js.fork.backup", { { {
       "/*\n"
       "Using fork from here: https://gist.github.com/1866577\n"
       "For additional functionality\n"
@@ -125992,8 +126028,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  })\n"
       "\n"
       "}( window.jQuery );\n",
-      7789 ) },
-    { "/js/bootstrap/bootstrap-transition.js", std::string(
+      7789 } } } },
+    { "/js/bootstrap/bootstrap-transition.js", { { {
       "/* ===================================================\n"
       " * bootstrap-transition.js v2.0.2\n"
       " * http://twitter.github.com/bootstrap/javascript.html#transitions\n"
@@ -126047,8 +126083,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  })\n"
       "\n"
       "}( window.jQuery );\n",
-      1868 ) },
-    { "/js/bootstrap/bootstrap-modal.js", std::string(
+      1868 } } } },
+    { "/js/bootstrap/bootstrap-modal.js", { { {
       "/* =========================================================\n"
       " * bootstrap-modal.js v2.0.2\n"
       " * http://twitter.github.com/bootstrap/javascript.html#modals\n"
@@ -126265,8 +126301,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  })\n"
       "\n"
       "}( window.jQuery );\n",
-      5429 ) },
-    { "/js/bootstrap/bootstrap-button.js", std::string(
+      5429 } } } },
+    { "/js/bootstrap/bootstrap-button.js", { { {
       "/* ============================================================\n"
       " * bootstrap-button.js v2.0.2\n"
       " * http://twitter.github.com/bootstrap/javascript.html#buttons\n"
@@ -126369,8 +126405,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  })\n"
       "\n"
       "}( window.jQuery );\n",
-      2813 ) },
-    { "/js/bootstrap/bootstrap-alert.js", std::string(
+      2813 } } } },
+    { "/js/bootstrap/bootstrap-alert.js", { { {
       "/* ==========================================================\n"
       " * bootstrap-alert.js v2.0.2\n"
       " * http://twitter.github.com/bootstrap/javascript.html#alerts\n"
@@ -126467,8 +126503,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  })\n"
       "\n"
       "}( window.jQuery );\n",
-      2445 ) },
-    { "/js/bootstrap/bootstrap-popover.js", std::string(
+      2445 } } } },
+    { "/js/bootstrap/bootstrap-popover.js", { { {
       "/* ===========================================================\n"
       " * bootstrap-popover.js v2.0.2\n"
       " * http://twitter.github.com/bootstrap/javascript.html#popovers\n"
@@ -126569,8 +126605,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  })\n"
       "\n"
       "}( window.jQuery );\n",
-      2909 ) },
-    { "/js/bootstrap/bootstrap-scrollspy.js", std::string(
+      2909 } } } },
+    { "/js/bootstrap/bootstrap-scrollspy.js", { { {
       "/* =============================================================\n"
       " * bootstrap-scrollspy.js v2.0.2\n"
       " * http://twitter.github.com/bootstrap/javascript.html#scrollspy\n"
@@ -126700,8 +126736,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  })\n"
       "\n"
       "}( window.jQuery );\n",
-      3670 ) },
-    { "/js/nanoscroller/nanoscroller.css", std::string(
+      3670 } } } },
+    { "/js/nanoscroller/nanoscroller.css", { { {
       "/** initial setup **/\n"
       ".nano {\n"
       "  position : relative;\n"
@@ -126756,8 +126792,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  visibility : visible\\9; /* Target only IE7 and IE8 with this hack */\n"
       "  opacity    : 0.5;\n"
       "}\n",
-      1303 ) },
-    { "/js/nanoscroller/jquery.nanoscroller.min.js", std::string(
+      1303 } } } },
+    { "/js/nanoscroller/jquery.nanoscroller.min.js", { { {
       "/*! nanoScrollerJS v0.7.1 (c) 2013 James Florentino; Licensed MIT */\n"
       "\n"
       "(function(e,t,n){\"use strict\";var r,i,s,o,u,a,f,l,c,h,p,d,v,m,g,y,b,w,E,S,"
@@ -126854,8 +126890,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "===\"top\")return r.scrollTop(0);if(t.scroll&&t.scroll instanceof e)return r"
       ".scrollTo(t.scroll);if(t.stop)return r.stop();if(t.flash)return r.flash()}re"
       "turn r.reset()})}})(jQuery,window,document);",
-      7055 ) },
-    { "/js/chosen/chosen.css", std::string(
+      7055 } } } },
+    { "/js/chosen/chosen.css", { { {
       "/* @group Base */\n"
       ".chzn-container {\n"
       "  font-size: 13px;\n"
@@ -127292,8 +127328,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "  direction: rtl;\n"
       "}\n"
       "/* @end */\n",
-      13937 ) },
-    { "/js/chosen/chosen.jquery.min.js", std::string(
+      13937 } } } },
+    { "/js/chosen/chosen.jquery.min.js", { { {
       "// Chosen, a Select Box Enhancer for jQuery and Protoype\n"
       "// by Patrick Filler for Harvest, http://getharvest.com\n"
       "// \n"
@@ -127602,8 +127638,8 @@ std::map<std::string, const std::string> static_web_assets = {
       "om_char()+this.generate_random_char();while(a(\"#\"+b).length>0)b+=this.gene"
       "rate_random_char();return b},e}(AbstractChosen),c=function(a){var b;return b"
       "=a.outerWidth()-a.width()},d.get_side_border_padding=c}.call(this);\n",
-      22638 ) },
-    { "/js/chosen/chosen-sprite.png", std::string(
+      22638 } } } },
+    { "/js/chosen/chosen-sprite.png", { { {
       "\x89PNG\r\n"
       "\x1a\n"
       "\0\0\0\rIHDR\0\0\0<\0\0\0(\b\6\0\0\0\xa2\xbb\x99\xff\0\0\1\xf6IDATh\xde\xed\x98"
@@ -127630,5 +127666,5 @@ std::map<std::string, const std::string> static_web_assets = {
       "\a\x85{y;Z\xa3s+\xee\x8bq\xfb\6L\xa8\x12\x16su\x89O@\x9f\xf8J\xedq\x96\xb6U\t"
       "\xd7\xf9j\xb2Mi\xed\xc2?\xa4\xbb\x41XJG\xba\x45\x98\xca\xa0\x19\xe1o\v\xe9\x1c"
       "w(\xe3Qg\0\0\0\0IEND\xae\x42`\x82",
-      559 ) },
+      559 } } } },
 };
@@ -49,7 +49,7 @@ void file_http_app_t::handle(const http_req_t &req, http_res_t *result, signal_t
         return;
     }
 
-    const std::string &resource_data = it->second;
+    const static_web_asset_t &asset = it->second;
 
     time_t expires;
 #ifndef NDEBUG
@@ -91,7 +91,10 @@ void file_http_app_t::handle(const http_req_t &req, http_res_t *result, signal_t
     result->add_header_line("Content-Type", mimetype);
 
     if (asset_dir.empty()) {
-        result->body.assign(resource_data.begin(), resource_data.end());
+        result->body.reserve(asset.size());
+        for (const auto &segment : asset.segments) {
+            result->body.append(segment.first, segment.second);
+        }
         result->code = http_status_code_t::OK;
     } else {
         thread_pool_t::run_in_blocker_pool(std::bind(&file_http_app_t::handle_blocking, this, filename, result));
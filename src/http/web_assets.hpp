@@ -1,12 +1,33 @@
 #ifndef HTTP_WEB_ASSETS_HPP_
 #define HTTP_WEB_ASSETS_HPP_
 
+#include <stddef.h>
+
 #include <map>
 #include <utility>
 #include <string>
+#include <vector>
+
+// An asset is stored as (pointer, length) segments into the binary's
+// read-only data instead of a `std::string`, so nothing is copied onto the
+// heap at startup and the kernel demand-pages and caches only the assets that
+// are actually served.  It is a sequence of segments rather than one
+// contiguous literal because MSVC caps a concatenated string literal at
+// 65535 bytes.
+struct static_web_asset_t {
+    std::vector<std::pair<const char *, size_t> > segments;
+
+    size_t size() const {
+        size_t total = 0;
+        for (const auto &segment : segments) {
+            total += segment.second;
+        }
+        return total;
+    }
+};
 
 // static_web_assets is defined in web_assets.cc generated by scripts/compile-web-assets.py
 
-extern std::map<std::string, const std::string > static_web_assets;
+extern std::map<std::string, const static_web_asset_t> static_web_assets;
 
 #endif /* HTTP_WEB_ASSETS_HPP_ */
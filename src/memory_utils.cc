@@ -4,6 +4,10 @@
 #include <stdlib.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 #ifdef _WIN32
 #include "windows.hpp"
 #include <io.h>     // NOLINT
@@ -14,6 +18,84 @@
 #endif  // _WIN32
 
 #include "errors.hpp"
+#include "perfmon/core.hpp"
+#include "perfmon/perfmon.hpp"
+#include "rdb_protocol/datum.hpp"
+#include "thread_local.hpp"
+
+TLS_with_init(int64_t, allocation_count, 0);
+TLS_with_init(int64_t, allocation_bytes, 0);
+
+static void count_allocation(size_t size) {
+    TLS_set_allocation_count(TLS_get_allocation_count() + 1);
+    TLS_set_allocation_bytes(
+        TLS_get_allocation_bytes() + static_cast<int64_t>(size));
+}
+
+thread_allocation_stats_t get_thread_allocation_stats() {
+    thread_allocation_stats_t stats;
+    stats.allocations = TLS_get_allocation_count();
+    stats.bytes = TLS_get_allocation_bytes();
+    return stats;
+}
+
+/* Surfaces the allocator counters in the stats system table (and on the
+`/metrics` endpoint) as `allocator.allocations` / `allocator.bytes`, summed
+over all threads.  The counters are monotonic, so the interesting number is
+the rate; a climbing byte rate with a flat cache size is heap traffic from
+datums, cursors and changefeed buffers rather than from the page cache. */
+class thread_allocation_perfmon_t : public perfmon_t {
+public:
+    void *begin_stats() {
+        return new thread_allocation_stats_t{0, 0};
+    }
+    void visit_stats(void *ptr) {
+        thread_allocation_stats_t *total =
+            static_cast<thread_allocation_stats_t *>(ptr);
+        thread_allocation_stats_t here = get_thread_allocation_stats();
+        total->allocations += here.allocations;
+        total->bytes += here.bytes;
+    }
+    ql::datum_t end_stats(void *ptr) {
+        scoped_ptr_t<thread_allocation_stats_t> total(
+            static_cast<thread_allocation_stats_t *>(ptr));
+        ql::datum_object_builder_t builder;
+        builder.overwrite("allocations",
+                          ql::datum_t(static_cast<double>(total->allocations)));
+        builder.overwrite("bytes",
+                          ql::datum_t(static_cast<double>(total->bytes)));
+        return std::move(builder).to_datum();
+    }
+};
+static thread_allocation_perfmon_t pm_allocator;
+static perfmon_membership_t pm_allocator_membership(
+    &get_global_perfmon_collection(), &pm_allocator, "allocator");
+
+#ifdef __linux__
+/* From this size on we ask the kernel to back an aligned allocation with
+transparent huge pages.  2MB of 4KB pages costs 512 DTLB entries where one
+huge page costs one, which matters for the big long-lived buffers (serializer
+metadata, large IO buffers).  The advice is best-effort: with THP configured
+to `never` it does nothing, and the kernel may ignore it.  Allocations aren't
+required to be page-aligned, so only the whole pages inside the allocation are
+advised. */
+static const size_t HUGE_PAGE_ADVICE_THRESHOLD = 2 * 1024 * 1024;
+
+static void maybe_advise_huge_pages(void *ptr, size_t size) {
+    if (size < HUGE_PAGE_ADVICE_THRESHOLD) {
+        return;
+    }
+    const uintptr_t page_size = static_cast<uintptr_t>(getpagesize());
+    const uintptr_t start =
+        (reinterpret_cast<uintptr_t>(ptr) + page_size - 1) & ~(page_size - 1);
+    const uintptr_t end =
+        (reinterpret_cast<uintptr_t>(ptr) + size) & ~(page_size - 1);
+    if (start < end) {
+        /* Ignore the result; this is an optimization hint, not a requirement. */
+        madvise(reinterpret_cast<void *>(start), end - start, MADV_HUGEPAGE);
+    }
+}
+#endif  // __linux__
 
 void *raw_malloc_aligned(size_t size, size_t alignment) {
     void *ptr = nullptr;
@@ -33,6 +115,9 @@ void *raw_malloc_aligned(size_t size, size_t alignment) {
             crash_or_trap("posix_memalign failed with unknown result: %d.", res);
         }
     }
+#endif
+#ifdef __linux__
+    maybe_advise_huge_pages(ptr, size);
 #endif
     return ptr;
 }
@@ -52,6 +137,7 @@ void raw_free_aligned(void *ptr) {
 }
 
 void *rmalloc(size_t size) {
+    count_allocation(size);
     void *res = malloc(size);  // NOLINT(runtime/rethinkdb_fn)
     if (UNLIKELY(res == nullptr && size != 0)) {
         crash_oom();
@@ -60,6 +146,7 @@ void *rmalloc(size_t size) {
 }
 
 void *rrealloc(void *ptr, size_t size) {
+    count_allocation(size);
     void *res = realloc(ptr, size);  // NOLINT(runtime/rethinkdb_fn)
     if (UNLIKELY(res == nullptr && size != 0)) {
         crash_oom();
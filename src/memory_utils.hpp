@@ -2,6 +2,7 @@
 #define MEMORY_HPP_
 
 #include <stddef.h>
+#include <stdint.h>
 
 void *raw_malloc_aligned(size_t size, size_t alignment);
 void raw_free_aligned(void *ptr);
@@ -15,4 +16,18 @@ void *rmalloc(size_t size);
 /* Calls `realloc()` and checks its return value to crash if the allocation fails. */
 void *rrealloc(void *ptr, size_t size);
 
+/* Per-thread counters for allocations made through `rmalloc` and `rrealloc`.
+These cover the shared buffers that datums and rows are stored in (see
+`shared_buf_t`), but not allocations made through plain `operator new`.
+Sample the counters before and after an operation to attribute allocator
+traffic to it; `runtime_term_t::eval_on_current_stack` does this to report
+per-term allocations in query profiles. The counters are thread-wide and
+only ever increase, so a delta includes allocations made by whatever other
+coroutines ran on the thread in between. */
+struct thread_allocation_stats_t {
+    int64_t allocations;
+    int64_t bytes;
+};
+thread_allocation_stats_t get_thread_allocation_stats();
+
 #endif  // MEMORY_HPP_
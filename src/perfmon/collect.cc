@@ -11,6 +11,13 @@ static void co_perfmon_visit(int thread, void *data) {
 
 int get_num_threads();
 
+/* Polling stats is read-side work by design. The recording hot paths write to
+per-thread `cache_line_padded_t` slabs (see `perfmon_perthread_t` and friends) with no
+locks, and this function does the aggregation lazily: it hops to each thread to copy
+that thread's slab, then combines the copies. The `constituents_access` mutex taken
+during a collection walk only blocks registering or removing perfmons, never the
+increments themselves, so polling costs each thread one brief visit rather than
+perturbing what's being measured. */
 ql::datum_t perfmon_get_stats() {
     void *data = get_global_perfmon_collection().begin_stats();
     pmap(get_num_threads(), std::bind(&co_perfmon_visit, ph::_1, data));
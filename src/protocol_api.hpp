@@ -173,6 +173,18 @@ ARCHIVE_PRIM_MAKE_RANGED_SERIALIZABLE(durability_requirement_t,
                                       DURABILITY_REQUIREMENT_DEFAULT,
                                       DURABILITY_REQUIREMENT_SOFT);
 
+/* A note on the gap between SINGLE and OUTDATED: SINGLE reads go to the
+primary (read-your-writes per session, via the query client's fifo tokens),
+OUTDATED reads go to any replica with no freshness promise at all. The classic
+middle ground -- causal tokens, where a write response carries the shard's
+`state_timestamp_t` and a later read may be served by any replica whose
+applied frontier has passed it -- is compatible with the server internals
+(replicas track exactly that frontier in their metainfo; reads could stall or
+bounce on a too-old replica). What it needs first is a place for the token in
+the client protocol: tokens have to round-trip through the drivers, and
+ql2.proto has no field for them in either write responses or read options.
+That's a cross-driver protocol revision, not a server-side patch, which is why
+the enum stops at these four modes. */
 enum class read_mode_t { MAJORITY, SINGLE, OUTDATED, DEBUG_DIRECT };
 
 ARCHIVE_PRIM_MAKE_RANGED_SERIALIZABLE(read_mode_t,
@@ -194,7 +206,8 @@ loaded, or a new backfill_item_t structure is allocated. */
 class backfill_item_memory_tracker_t {
 public:
     explicit backfill_item_memory_tracker_t(size_t memory_limit)
-        : remaining_memory(memory_limit), had_at_least_one_item(false) { }
+        : remaining_memory(memory_limit), had_at_least_one_item(false),
+          receiver_congested(false) { }
 
     bool is_limit_exceeded() const {
         return had_at_least_one_item && remaining_memory < 0;
@@ -205,6 +218,18 @@ public:
     void note_item() {
         had_at_least_one_item = true;
     }
+
+    /* The backfiller sets this when the backfillee's item queue was full at
+    the time the chunk was started, i.e. the replica is applying items more
+    slowly than we can produce them. The store uses it to charge the traversal
+    to a lower-priority IO account, leaving the disk to foreground reads when
+    getting further ahead wouldn't speed up the backfill anyway. */
+    void set_receiver_congested(bool value) {
+        receiver_congested = value;
+    }
+    bool is_receiver_congested() const {
+        return receiver_congested;
+    }
 private:
     ssize_t remaining_memory;
 
@@ -214,6 +239,8 @@ private:
     Hence we always let the first item through. `had_at_least_one_item` is used
     to track whether this has already happened. */
     bool had_at_least_one_item;
+
+    bool receiver_congested;
 };
 
 #endif /* PROTOCOL_API_HPP_ */
@@ -22,11 +22,13 @@
 #define RAPIDJSON_WRITER_H_
 
 #include "rapidjson/rapidjson.h"
+#include "rapidjson/internal/meta.h"
 #include "rapidjson/internal/stack.h"
 #include "rapidjson/internal/strfunc.h"
 #include "rapidjson/internal/dtoa.h"
 #include "rapidjson/internal/itoa.h"
 #include "rapidjson/stringbuffer.h"
+#include <cstring>  // memcpy
 #include <new>      // placement new
 
 #if RAPIDJSON_HAS_STDSTRING
@@ -156,8 +158,8 @@ public:
         // Ignore the start and end square brackets in the array
         RAPIDJSON_ASSERT(data[0] == '[');
         RAPIDJSON_ASSERT(data[size - 1] == ']');
-        for (size_t i = 1; i < size - 1; ++i) {
-            os_->Put(data[i]);
+        if (size > 2) {
+            std::memcpy(os_->Push(size - 2), data + 1, (size - 2) * sizeof(Ch));
         }
         return true;
     }
@@ -289,6 +291,25 @@ protected:
         os_->Put('\"');
         GenericStringStream<SourceEncoding> is(str);
         while (is.Tell() < length) {
+            // RethinkDB addition: when no transcoding is needed, copy runs of
+            // characters that need no escaping in bulk instead of pushing them
+            // through the per-character loop below.  (Bytes >= 0x80 have no
+            // entry in `escape` and are copied through verbatim, which is what
+            // the transcoder would do for identical encodings anyway.)
+            if (internal::IsSame<SourceEncoding, TargetEncoding>::Value
+                && sizeof(Ch) == 1) {
+                const Ch *const end = str + length;
+                const Ch *const run_begin = is.src_;
+                const Ch *p = run_begin;
+                while (p != end && escape[(unsigned char)*p] == 0)
+                    ++p;
+                if (p != run_begin) {
+                    std::memcpy(os_->Push(static_cast<size_t>(p - run_begin)),
+                                run_begin, static_cast<size_t>(p - run_begin));
+                    is.src_ = p;
+                    continue;
+                }
+            }
             const Ch c = is.Peek();
             if (!TargetEncoding::supportUnicode && (unsigned)c >= 0x80) {
                 // Unicode escaping
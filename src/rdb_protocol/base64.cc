@@ -1,6 +1,8 @@
 // Copyright 2010-2015 RethinkDB, all rights reserved.
 #include "rdb_protocol/base64.hpp"
 
+#include <string.h>
+
 #include "rdb_protocol/error.hpp"
 #include "utils.hpp"
 
@@ -51,20 +53,31 @@ std::string encode_base64(const char *data, size_t size) {
     return res;
 }
 
-inline char base64_value(char c) {
-    if (c >= 'A' && c <= 'Z') {
-        return c - 'A';
-    } else if (c >= 'a' && c <= 'z') {
-        return c - 'a' + 26;
-    } else if (c >= '0' && c <= '9') {
-        return c - '0' + 52;
-    } else if (c == '+') {
-        return 62;
-    } else if (c == '/') {
-        return 63;
-    }
-    rfail_datum(ql::base_exc_t::LOGIC, "Invalid base64 character found: '%c'.", c);
-}
+// Maps a base64 character to its 6-bit value, or to one of the negative
+// sentinels below. A single table lookup per input byte replaces the
+// range-check chain the decoder used to do per character, which is where
+// the decode time went on large binary payloads.
+static const signed char BASE64_INVALID = -1;
+static const signed char BASE64_WHITESPACE = -2;
+static const signed char BASE64_PADDING = -3;
+static const signed char base64_decode_map[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, -2, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -3, -1, -1,
+    -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+    -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
 
 // Takes a chunk of four 6-bit values and converts it into 3 8-bit values
 inline void base64_chunk_to_binary(const char *in, char *out) {
@@ -73,57 +86,66 @@ inline void base64_chunk_to_binary(const char *in, char *out) {
     out[2] = ((in[2] & 0x3) << 6) + in[3];
 }
 
-const char* fill_chunk_values(const char *in, const char *in_end, char *out,
-                              bool *done, size_t *chars_filled) {
-    *done = false;
-    *chars_filled = 0;
-    while (*chars_filled < 4 && !*done) {
-        if (in == in_end || *in == '=') {
-            *done = true;
-            return in;
-        } else if (*in != '\r' && *in != '\n' && *in != ' ' && *in != '\t') {
-            *out++ = base64_value(*in);
-            *chars_filled += 1;
-        }
-        in++;
-    }
-    return in;
-}
-
-std::string decode_base64(const char *bdata, size_t bsize) {
-    // This assumes no whitespace in the input, so we may be overallocating a bit
-    std::string res;
-    res.reserve((bsize / 4) * 3);
-
-    bool done = false;
-    size_t chars_filled;
-    char chunk_values[4];
-    char decoded_chunk[3];
-    const char *current_data = bdata;
+size_t decode_base64_into(const char *bdata, size_t bsize, char *out) {
+    char *out_pos = out;
+    const char *in = bdata;
     const char *data_end = bdata + bsize;
 
-    while (!done) {
-        current_data = fill_chunk_values(current_data, data_end, chunk_values,
-                                         &done, &chars_filled);
-        base64_chunk_to_binary(chunk_values, decoded_chunk);
-
-        if (chars_filled == 1) {
+    char chunk_values[4];
+    size_t chars_filled = 0;
+    for (; in != data_end; ++in) {
+        const signed char value =
+            base64_decode_map[static_cast<unsigned char>(*in)];
+        if (value >= 0) {
+            chunk_values[chars_filled++] = value;
+            if (chars_filled == 4) {
+                base64_chunk_to_binary(chunk_values, out_pos);
+                out_pos += 3;
+                chars_filled = 0;
+            }
+        } else if (value == BASE64_WHITESPACE) {
+            // Skip it
+        } else if (value == BASE64_PADDING) {
+            break;
+        } else {
             rfail_datum(ql::base_exc_t::LOGIC,
-                        "Invalid base64 length: 1 character remaining, "
-                        "cannot decode a full byte.");
-        } else if (chars_filled != 0) {
-            res.append(decoded_chunk, chars_filled - 1);
+                        "Invalid base64 character found: '%c'.", *in);
+        }
+    }
+
+    if (chars_filled == 1) {
+        rfail_datum(ql::base_exc_t::LOGIC,
+                    "Invalid base64 length: 1 character remaining, "
+                    "cannot decode a full byte.");
+    } else if (chars_filled != 0) {
+        for (size_t i = chars_filled; i < 4; ++i) {
+            chunk_values[i] = 0;
         }
+        char decoded_chunk[3];
+        base64_chunk_to_binary(chunk_values, decoded_chunk);
+        memcpy(out_pos, decoded_chunk, chars_filled - 1);
+        out_pos += chars_filled - 1;
     }
 
     // Check if we stopped early (due to a stray padding character)
-    for (const char *i = current_data; i != data_end; ++i) {
-        if (*i != '=' && *i != '\r' && *i != '\n' && *i != ' ' && *i != '\t') {
+    for (const char *i = in; i != data_end; ++i) {
+        const signed char value =
+            base64_decode_map[static_cast<unsigned char>(*i)];
+        if (value != BASE64_PADDING && value != BASE64_WHITESPACE) {
             rfail_datum(ql::base_exc_t::LOGIC,
                         "Invalid base64 format, data found after "
                         "padding character '='.");
         }
     }
 
+    return out_pos - out;
+}
+
+std::string decode_base64(const char *bdata, size_t bsize) {
+    // This assumes no whitespace in the input, so we may be overallocating a bit
+    std::string res;
+    res.resize(decode_base64_max_size(bsize));
+    const size_t decoded_size = decode_base64_into(bdata, bsize, &res[0]);
+    res.resize(decoded_size);
     return res;
 }
@@ -7,4 +7,17 @@
 std::string encode_base64(const char *data, size_t size);
 std::string decode_base64(const char *bdata, size_t bsize);
 
+// Upper bound on the decoded size of `bsize` base64 characters, for sizing
+// the output buffer of `decode_base64_into`.
+inline size_t decode_base64_max_size(size_t bsize) {
+    return ((bsize + 3) / 4) * 3;
+}
+
+// Decodes directly into `out`, which must have room for at least
+// `decode_base64_max_size(bsize)` bytes. Returns the number of bytes
+// written. This is the allocation-free core of `decode_base64`; callers
+// that have their own buffer (e.g. the binary pseudotype) use it to skip
+// the intermediate `std::string`.
+size_t decode_base64_into(const char *bdata, size_t bsize, char *out);
+
 #endif  // RDB_PROTOCOL_BASE64_HPP_
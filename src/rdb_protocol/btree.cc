@@ -9,7 +9,9 @@
 #include <vector>
 
 #include "btree/concurrent_traversal.hpp"
+#include "btree/depth_first_traversal.hpp"
 #include "btree/get_distribution.hpp"
+#include "btree/leaf_node.hpp"
 #include "btree/operations.hpp"
 #include "btree/reql_specific.hpp"
 #include "btree/superblock.hpp"
@@ -134,6 +136,19 @@ void kv_location_delete(keyvalue_location_t *kv_location,
             deletion_context->balancing_detacher(), delete_mode);
 }
 
+/* This rewrites the whole serialized row even when the replacement only
+changed a few bytes of a large document. That's deliberate. The old value's
+blob chunks can't be patched in place or partially reused: the deletion
+context hands the *entire* old value to the in-tree deleter so that detached
+copies stay valid for concurrent snapshot readers and secondary-index
+cleanup, and a chunk that's shared between the old and new value would have
+two owners with different lifetimes. There's also no cheap way to know which
+chunks changed -- the serialization is a single varint-delimited stream, so
+a one-byte length change early in the document shifts every chunk after it,
+and nothing upstream computes a field-level diff (changefeeds ship whole
+old/new values). Note that true no-op replacements never get here at all;
+`rdb_replace_and_return_superblock()` bails out before writing when the old
+and new rows compare equal. */
 MUST_USE ql::serialization_result_t
 kv_location_set(keyvalue_location_t *kv_location,
                 const store_key_t &key,
@@ -206,6 +221,64 @@ kv_location_set(keyvalue_location_t *kv_location,
     return ql::serialization_result_t::SUCCESS;
 }
 
+/* Writes `serialized_data` -- a datum serialization as produced by
+`datum_serialize_onto_blob()` -- into a fresh blob verbatim.  This is the
+backfill apply path: values arrive as a copy of the sender's on-disk
+serialization, so writing the bytes straight back out skips re-serializing
+the datum.  The bytes already passed the disk serialization checks when the
+sender originally wrote them, hence no error checking here. */
+MUST_USE ql::serialization_result_t
+kv_location_set_serialized(keyvalue_location_t *kv_location,
+                           const store_key_t &key,
+                           const std::vector<char> &serialized_data,
+                           repli_timestamp_t timestamp,
+                           const deletion_context_t *deletion_context,
+                           rdb_modification_info_t *mod_info_out) THROWS_NOTHING {
+    scoped_malloc_t<rdb_value_t> new_value(blob::btree_maxreflen);
+    memset(new_value.get(), 0, blob::btree_maxreflen);
+
+    const max_block_size_t block_size = kv_location->buf.cache()->max_block_size();
+    {
+        blob_t blob(block_size, new_value->value_ref(), blob::btree_maxreflen);
+        blob.append_region(buf_parent_t(&kv_location->buf), serialized_data.size());
+        blob_acq_t acq;
+        buffer_group_t group;
+        blob.expose_all(buf_parent_t(&kv_location->buf), access_t::write,
+                        &group, &acq);
+        buffer_group_write_stream_t stream(&group);
+        int64_t res = stream.write(serialized_data.data(), serialized_data.size());
+        guarantee(res == static_cast<int64_t>(serialized_data.size()));
+        guarantee(stream.entire_stream_filled());
+    }
+
+    if (mod_info_out) {
+        guarantee(mod_info_out->added.second.empty());
+        mod_info_out->added.second.assign(new_value->value_ref(),
+            new_value->value_ref() + new_value->inline_size(block_size));
+    }
+
+    if (kv_location->value.has()) {
+        deletion_context->in_tree_deleter()->delete_value(
+                buf_parent_t(&kv_location->buf), kv_location->value.get());
+        if (mod_info_out != nullptr) {
+            guarantee(mod_info_out->deleted.second.empty());
+            mod_info_out->deleted.second.assign(
+                    kv_location->value_as<rdb_value_t>()->value_ref(),
+                    kv_location->value_as<rdb_value_t>()->value_ref()
+                    + kv_location->value_as<rdb_value_t>()->inline_size(block_size));
+        }
+    }
+
+    // Actually update the leaf, if needed.
+    kv_location->value = std::move(new_value);
+    rdb_value_sizer_t sizer(block_size);
+    apply_keyvalue_change(&sizer, kv_location, key.btree_key(),
+                          timestamp,
+                          deletion_context->balancing_detacher(),
+                          delete_mode_t::REGULAR_QUERY);
+    return ql::serialization_result_t::SUCCESS;
+}
+
 batched_replace_response_t rdb_replace_and_return_superblock(
     const btree_loc_info_t &info,
     const btree_point_replacer_t *replacer,
@@ -333,16 +406,17 @@ ql::datum_t btree_batched_replacer_t::apply_write_hook(
         }
         ql::datum_t modified;
         try {
-            cond_t non_interruptor;
-            ql::env_t write_hook_env(&non_interruptor,
-                                     ql::return_empty_normal_batches_t::NO,
-                                     reql_version_t::LATEST);
+            if (!hook_env.has()) {
+                hook_env.init(new ql::env_t(&hook_env_non_interruptor,
+                                            ql::return_empty_normal_batches_t::NO,
+                                            reql_version_t::LATEST));
+            }
 
             ql::datum_object_builder_t builder;
             builder.overwrite("primary_key", std::move(primary_key));
             builder.overwrite("timestamp", write_timestamp);
 
-            modified = write_hook->call(&write_hook_env,
+            modified = write_hook->call(hook_env.get(),
                                         std::vector<ql::datum_t>{
                                             std::move(builder).to_datum(),
                                                 d,
@@ -423,6 +497,25 @@ void do_a_replace_from_batched_replace(
         mod_report, update_pkey_cfeeds, &sindex_spot, &stamp_spot);
 }
 
+/* This is as "bulk" as inserts get: every key in `keys` is applied inside
+the one btree transaction backing `*superblock`, so a batched insert or
+replace costs a single superblock acquisition and a single flush
+participation no matter how many documents it touches.  Within the batch
+each key still runs as its own pipelined replace (up to
+`MAX_CONCURRENT_REPLACES` descents in flight, handing the superblock down
+the fifo queue), because even an import-style insert needs per-row conflict
+resolution, write hooks, sindex updates, and changefeed stamps.  A bottom-up
+btree build that bypassed this machinery would also bypass the replication
+timestamps the dispatcher assigns per write, so it could only ever run
+against a table with no history -- at which point the expensive parts
+(sindex construction, replica copies) still happen afterwards through the
+normal paths.
+
+What the batch is NOT is all-or-nothing: each document's outcome is reported
+individually in the stats, and a failed replace doesn't undo the ones that
+already applied -- there's no undo log in the btree to roll back with.
+Readers looking for "atomic multi-key writes" should batch their documents
+into one insert/replace; that's this path. */
 batched_replace_response_t rdb_batched_replace(
     const btree_info_t &info,
     scoped_ptr_t<real_superblock_t> *superblock,
@@ -552,6 +645,40 @@ void rdb_set(const store_key_t &key,
         (had_value ? point_write_result_t::DUPLICATE : point_write_result_t::STORED);
 }
 
+void rdb_backfill_set(const store_key_t &key,
+                      ql::datum_t data,
+                      const std::vector<char> &serialized_data,
+                      btree_slice_t *slice,
+                      repli_timestamp_t timestamp,
+                      superblock_t *superblock,
+                      const deletion_context_t *deletion_context,
+                      rdb_modification_info_t *mod_info,
+                      promise_t<superblock_t *> *pass_back_superblock) {
+    keyvalue_location_t kv_location;
+    rdb_value_sizer_t sizer(superblock->cache()->max_block_size());
+    find_keyvalue_location_for_write(&sizer, superblock, key.btree_key(), timestamp,
+                                     deletion_context->balancing_detacher(),
+                                     &kv_location, nullptr, pass_back_superblock);
+    slice->stats.pm_keys_set.record();
+    slice->stats.pm_total_keys_set += 1;
+    const bool had_value = kv_location.value.has();
+
+    /* update the modification report */
+    if (had_value) {
+        mod_info->deleted.first = get_data(kv_location.value_as<rdb_value_t>(),
+                                           buf_parent_t(&kv_location.buf));
+    }
+
+    mod_info->added.first = data;
+
+    ql::serialization_result_t res =
+        kv_location_set_serialized(&kv_location, key, serialized_data, timestamp,
+                                   deletion_context, mod_info);
+    r_sanity_check(!ql::bad(res));
+    guarantee(mod_info->deleted.second.empty() == !had_value &&
+              !mod_info->added.second.empty());
+}
+
 void rdb_delete(const store_key_t &key, btree_slice_t *slice,
                 repli_timestamp_t timestamp,
                 real_superblock_t *superblock,
@@ -650,10 +777,7 @@ public:
                                         sorting,
                                         batcher.get(),
                                         require_sindex_val)) {
-        for (size_t i = 0; i < _transforms.size(); ++i) {
-            transformers.push_back(ql::make_op(_transforms[i]));
-        }
-        guarantee(transformers.size() == _transforms.size());
+        ql::make_ops(_transforms, &transformers);
     }
     job_data_t(job_data_t &&) = default;
 
@@ -732,6 +856,46 @@ private:
     optional<std::string> skey_left;
 };
 
+// Used for multi-gets (`get_all` with a set of primary keys): one traversal
+// over the span of the requested keys instead of one descent per key.
+// `filter_range` prunes subtrees that contain none of the keys, and
+// `is_key_interesting` drops non-requested pairs in shared leaves.
+class rget_multi_get_cb_wrapper_t : public concurrent_traversal_callback_t {
+public:
+    rget_multi_get_cb_wrapper_t(
+            rget_cb_t *_cb,
+            const std::map<store_key_t, uint64_t> *_primary_keys)
+        : cb(_cb), primary_keys(_primary_keys) { }
+    virtual void filter_range(
+            const btree_key_t *left_excl_or_null,
+            const btree_key_t *right_incl,
+            bool *skip_out) {
+        auto it = left_excl_or_null == nullptr
+            ? primary_keys->begin()
+            : primary_keys->upper_bound(store_key_t(left_excl_or_null));
+        *skip_out = it == primary_keys->end()
+            || store_key_t(right_incl) < it->first;
+    }
+    virtual bool is_key_interesting(const btree_key_t *key) {
+        return primary_keys->count(store_key_t(key)) != 0;
+    }
+    virtual continue_bool_t handle_pair(
+        scoped_key_value_t &&keyvalue,
+        concurrent_traversal_fifo_enforcer_signal_t waiter)
+        THROWS_ONLY(interrupted_exc_t) {
+        auto it = primary_keys->find(store_key_t(keyvalue.key()));
+        guarantee(it != primary_keys->end());
+        return cb->handle_pair(
+            std::move(keyvalue),
+            it->second,
+            r_nullopt,
+            std::move(waiter));
+    }
+private:
+    rget_cb_t *cb;
+    const std::map<store_key_t, uint64_t> *primary_keys;
+};
+
 rget_cb_t::rget_cb_t(rget_io_data_t &&_io,
                      job_data_t &&_job,
                      optional<rget_sindex_data_t> &&_sindex)
@@ -788,6 +952,13 @@ continue_bool_t rget_cb_t::handle_pair(
     io.slice->stats.pm_keys_read.record();
     io.slice->stats.pm_total_keys_read += 1;
     // We only load the value if we actually use it (`count` does not).
+    // Note that for sindex traversals the value we load here comes from the
+    // *sindex* leaf: sindex entries carry a full copy of the row, so sindex
+    // range reads never touch the primary tree.  In that sense every sindex
+    // read is already a "covering" read.  We can't skip the load for
+    // val-less terminals on an sindex, though, because `lazy_sindex_val`
+    // below may need to re-run the index function on the row to disambiguate
+    // truncated boundary keys, and the leaf buf is released right after this.
     if (job.accumulator->uses_val() || job.transformers.size() != 0 || sindex) {
         val = row.get();
     } else {
@@ -1040,33 +1211,19 @@ void rdb_rget_slice(
     direction_t direction = reversed(sorting) ? BACKWARD : FORWARD;
     continue_bool_t cont = continue_bool_t::CONTINUE;
     if (primary_keys.has_value()) {
-        auto cb = [&](const std::pair<store_key_t, uint64_t> &pair, bool is_last) {
-            rget_cb_wrapper_t wrapper(&callback, pair.second, r_nullopt);
-            return btree_concurrent_traversal(
-                superblock,
-                key_range_t::one_key(pair.first),
-                &wrapper,
-                direction,
-                is_last ? release_superblock : release_superblock_t::KEEP);
-        };
-        if (!reversed(sorting)) {
-            for (auto it = primary_keys->begin(); it != primary_keys->end();) {
-                auto this_it = it++;
-                if (cb(*this_it, it == primary_keys->end()) == continue_bool_t::ABORT) {
-                    // If required the superblock will get released further up the stack.
-                    cont = continue_bool_t::ABORT;
-                    break;
-                }
-            }
-        } else {
-            for (auto it = primary_keys->rbegin(); it != primary_keys->rend();) {
-                auto this_it = it++;
-                if (cb(*this_it, it == primary_keys->rend()) == continue_bool_t::ABORT) {
-                    // If required the superblock will get released further up the stack.
-                    cont = continue_bool_t::ABORT;
-                    break;
-                }
-            }
+        // Multi-get: one traversal over the span of the requested keys, so
+        // interior blocks on paths shared between keys are acquired once
+        // rather than once per key.  The wrapper prunes subtrees that
+        // contain none of the keys and skips non-requested pairs in shared
+        // leaves, so this visits exactly the same rows the per-key descents
+        // used to, in the same order.
+        if (!primary_keys->empty()) {
+            rget_multi_get_cb_wrapper_t wrapper(&callback, &*primary_keys);
+            key_range_t span(
+                key_range_t::closed, primary_keys->begin()->first,
+                key_range_t::closed, primary_keys->rbegin()->first);
+            cont = btree_concurrent_traversal(
+                superblock, span, &wrapper, direction, release_superblock);
         }
     } else {
         rget_cb_wrapper_t wrapper(&callback, 1, r_nullopt);
@@ -1515,6 +1672,7 @@ std::vector<std::string> expand_geo_key(
 void compute_keys(const store_key_t &primary_key,
                   ql::datum_t doc,
                   const sindex_disk_info_t &index_info,
+                  ql::env_t *sindex_env,
                   std::vector<std::pair<store_key_t, ql::datum_t> > *keys_out,
                   std::vector<index_pair_t> *cfeed_keys_out) {
 
@@ -1523,15 +1681,8 @@ void compute_keys(const store_key_t &primary_key,
     const reql_version_t reql_version =
         index_info.mapping_version_info.latest_compatible_reql_version;
 
-    // Secondary index functions are deterministic (so no need for an rdb_context_t)
-    // and evaluated in a pristine environment (without global optargs).
-    cond_t non_interruptor;
-    ql::env_t sindex_env(&non_interruptor,
-                         ql::return_empty_normal_batches_t::NO,
-                         reql_version);
-
     ql::datum_t index =
-        index_info.mapping.compile_wire_func()->call(&sindex_env, doc)->as_datum();
+        index_info.mapping.compile_wire_func()->call(sindex_env, doc)->as_datum();
 
     if (index_info.multi == sindex_multi_bool_t::MULTI
         && index.get_type() == ql::datum_t::R_ARRAY) {
@@ -1753,12 +1904,20 @@ void rdb_update_single_sindex(
     guarantee(cfeed_old_keys_out == nullptr || cfeed_old_keys_out->size() == 0);
     guarantee(cfeed_new_keys_out == nullptr || cfeed_new_keys_out->size() == 0);
 
-    sindex_disk_info_t sindex_info;
-    try {
-        deserialize_sindex_info_or_crash(sindex->sindex.opaque_definition, &sindex_info);
-    } catch (const archive_exc_t &e) {
-        crash("%s", e.what());
-    }
+    // The deserialized definition is cached on the store: re-parsing the
+    // index function for every updated row is a measurable part of the write
+    // path on tables with several indexes.
+    const sindex_disk_info_t &sindex_info =
+        store->cached_sindex_info(sindex->sindex);
+    // Secondary index functions are deterministic (so no need for an
+    // rdb_context_t) and evaluated in a pristine environment (without global
+    // optargs).  The environment is cached on the store because it owns the
+    // per-environment regex cache: with a fresh environment per evaluation, a
+    // regex-based index function would recompile its pattern for every
+    // updated row.
+    ql::env_t *sindex_env = store->cached_sindex_env(
+        sindex->sindex,
+        sindex_info.mapping_version_info.latest_compatible_reql_version);
     // TODO(2015-01): Actually get real profiling information for
     // secondary index updates.
     profile::trace_t *const trace = nullptr;
@@ -1767,6 +1926,34 @@ void rdb_update_single_sindex(
 
     auto cserver = store->changefeed_server(modification->primary_key);
 
+    // If the secondary index is being deleted, we don't add any new values to
+    // the sindex tree.
+    // This is so we don't race against any sindex erase about who is faster
+    // (we with inserting new entries, or the erase with removing them).
+    const bool sindex_is_being_deleted = sindex->sindex.being_deleted;
+    const bool adds_row =
+        !sindex_is_being_deleted && modification->info.added.first.has();
+
+    // For updates, the new row's keys are computed up front, for two reasons:
+    // the deletion pass below can then skip entries the insertion pass is
+    // about to overwrite in place (when the index function doesn't look at
+    // the fields an update changed, the old and new key sets coincide, and
+    // deleting such entries first just doubles the btree descents), and the
+    // index function only gets evaluated once per row instead of twice.
+    std::vector<std::pair<store_key_t, ql::datum_t> > new_keys;
+    bool new_keys_computed = false;
+    if (adds_row) {
+        try {
+            compute_keys(
+                modification->primary_key, modification->info.added.first,
+                sindex_info, sindex_env, &new_keys, cfeed_new_keys_out);
+            new_keys_computed = true;
+        } catch (const ql::base_exc_t &) {
+            // The new row can't be converted to index keys; it is simply
+            // dropped from the index below.
+        }
+    }
+
     if (modification->info.deleted.first.has()) {
         guarantee(!modification->info.deleted.second.empty());
         try {
@@ -1775,7 +1962,7 @@ void rdb_update_single_sindex(
             std::vector<std::pair<store_key_t, ql::datum_t> > keys;
             compute_keys(
                 modification->primary_key, deleted, sindex_info,
-                &keys, cfeed_old_keys_out);
+                sindex_env, &keys, cfeed_old_keys_out);
             if (cserver.first != nullptr) {
                 cserver.first->foreach_limit(
                     make_optional(sindex->name.name),
@@ -1793,6 +1980,21 @@ void rdb_update_single_sindex(
                     }, cserver.second);
             }
             for (auto it = keys.begin(); it != keys.end(); ++it) {
+                if (new_keys_computed) {
+                    // The insertion pass below overwrites this entry in
+                    // place; there's no point in a separate descent just to
+                    // delete it first.
+                    bool rewritten_below = false;
+                    for (const auto &new_pair : new_keys) {
+                        if (new_pair.first == it->first) {
+                            rewritten_below = true;
+                            break;
+                        }
+                    }
+                    if (rewritten_below) {
+                        continue;
+                    }
+                }
                 promise_t<superblock_t *> return_superblock_local;
                 {
                     keyvalue_location_t kv_location;
@@ -1830,24 +2032,13 @@ void rdb_update_single_sindex(
         }
     }
 
-    // If the secondary index is being deleted, we don't add any new values to
-    // the sindex tree.
-    // This is so we don't race against any sindex erase about who is faster
-    // (we with inserting new entries, or the erase with removing them).
-    const bool sindex_is_being_deleted = sindex->sindex.being_deleted;
-    if (!sindex_is_being_deleted && modification->info.added.first.has()) {
-        bool decremented_updates_left = false;
+    if (adds_row && new_keys_computed) {
         try {
             ql::datum_t added = modification->info.added.first;
 
-            std::vector<std::pair<store_key_t, ql::datum_t> > keys;
-
-            compute_keys(
-                modification->primary_key, added, sindex_info,
-                &keys, cfeed_new_keys_out);
+            const std::vector<std::pair<store_key_t, ql::datum_t> > &keys = new_keys;
             if (keys_available_cond != nullptr) {
                 guarantee(*updates_left > 0);
-                decremented_updates_left = true;
                 if (--*updates_left == 0) {
                     keys_available_cond->pulse();
                 }
@@ -1898,24 +2089,15 @@ void rdb_update_single_sindex(
                     return_superblock_local.wait());
             }
         } catch (const ql::base_exc_t &) {
-            // Do nothing (we just drop the row from the index).
-
-            // If we've decremented `updates_left` already, that means we might
-            // have sent a change with new values for this key even though we're
-            // actually dropping the row.  I *believe* that this catch statement
-            // can only be triggered by an exception thrown from `compute_keys`
-            // (which begs the question of why so many other statements are
-            // inside of it), so this guarantee should never trip.
-            if (keys_available_cond != nullptr) {
-                guarantee(!decremented_updates_left);
-                guarantee(cfeed_new_keys_out->size() == 0);
-                guarantee(*updates_left > 0);
-                if (--*updates_left == 0) {
-                    keys_available_cond->pulse();
-                }
-            }
+            // Historically the only thing that threw in this block was
+            // `compute_keys`, and its keys are now computed before the
+            // deletion pass, so this should be unreachable.
+            crash("Unexpected exception during a secondary index update.");
         }
     } else {
+        // Either this modification adds no row, the index is being deleted,
+        // or `compute_keys` rejected the new row (which is then simply
+        // dropped from the index).
         if (keys_available_cond != nullptr) {
             guarantee(*updates_left > 0);
             if (--*updates_left == 0) {
@@ -2008,6 +2190,16 @@ void rdb_update_sindexes(
     }
 }
 
+/* Post-construction walks the primary tree with a concurrent traversal, so
+the leaf reads are pipelined and several indexes created together are filled
+by one pass.  The writes, though, go through `rdb_update_sindexes` one row at
+a time under `wtxn_lock_`: a btree only tolerates one writer, so partitioning
+the primary range across coroutines would just contend on that lock.  The
+chunked HARD-durability transactions are also deliberate back-pressure — they
+keep construction from filling the cache with dirty pages faster than they
+flush.  Building the sindex bottom-up from sorted output would avoid the
+per-row descents entirely, but there is no bulk btree builder (or external
+sort to feed one) in this tree. */
 class post_construct_traversal_helper_t : public concurrent_traversal_callback_t {
 public:
     post_construct_traversal_helper_t(
@@ -2218,6 +2410,7 @@ void post_construct_secondary_index_range(
         store_t *store,
         const std::set<uuid_u> &sindex_ids_to_post_construct,
         key_range_t *construction_range_inout,
+        cache_account_t *cache_account,
         const std::function<bool(int64_t)> &check_should_abort,
         signal_t *interruptor)
     THROWS_ONLY(interrupted_exc_t) {
@@ -2229,8 +2422,7 @@ void post_construct_secondary_index_range(
     // Mind the destructor ordering.
     // The superblock must be released before txn (`btree_concurrent_traversal`
     // usually already takes care of that).
-    // The txn must be destructed before the cache_account.
-    cache_account_t cache_account;
+    // The txn must be destructed before the caller's cache_account.
     scoped_ptr_t<txn_t> txn;
     scoped_ptr_t<real_superblock_t> superblock;
 
@@ -2255,9 +2447,7 @@ void post_construct_secondary_index_range(
         check_should_abort,
         interruptor);
 
-    cache_account
-        = txn->cache()->create_cache_account(SINDEX_POST_CONSTRUCTION_CACHE_PRIORITY);
-    txn->set_account(&cache_account);
+    txn->set_account(cache_account);
 
     continue_bool_t cont = btree_concurrent_traversal(
         superblock.get(),
@@ -2284,4 +2474,156 @@ void post_construct_secondary_index_range(
     }
 }
 
+/* Number of leaf nodes one call to `rdb_defragment_range()` inspects before
+returning, so the caller can pace the scan. */
+static const int64_t DEFRAG_LEAVES_PER_PASS = 128;
+
+/* Number of underfull leaves one pass fixes. Each fix is its own small write
+transaction, so this bounds the write work a pass can queue up behind
+foreground writes. */
+static const size_t DEFRAG_FIXES_PER_PASS = 16;
+
+/* Collects a descent key for each underfull leaf in the traversed range. Only
+leaf headers are inspected; `handle_pre_leaf()` skips the pairs. */
+class defrag_leaf_collector_t : public depth_first_traversal_callback_t {
+public:
+    defrag_leaf_collector_t(value_sizer_t *sizer, signal_t *interruptor)
+        : aborted_(false), leaves_visited_(0),
+          sizer_(sizer), interruptor_(interruptor) { }
+
+    continue_bool_t handle_pre_leaf(
+            const counted_t<counted_buf_lock_and_read_t> &buf,
+            UNUSED const btree_key_t *left_excl_or_null,
+            const btree_key_t *right_incl,
+            signal_t *,
+            bool *skip_out) {
+        *skip_out = true;
+        const leaf_node_t *lnode = static_cast<const leaf_node_t *>(
+            buf->read->get_data_read());
+        if (leaf::is_underfull(sizer_, lnode)) {
+            /* `right_incl` is the tightest upper bound the parent nodes put
+            on this leaf, so a later write descent for it ends up in this
+            leaf (or wherever its contents have moved to by then). */
+            collected_keys_.push_back(store_key_t(right_incl));
+        }
+        traversed_right_bound_ = store_key_t(right_incl);
+        ++leaves_visited_;
+        if (leaves_visited_ >= DEFRAG_LEAVES_PER_PASS
+                || collected_keys_.size() >= DEFRAG_FIXES_PER_PASS
+                || interruptor_->is_pulsed()) {
+            aborted_ = true;
+            return continue_bool_t::ABORT;
+        }
+        return continue_bool_t::CONTINUE;
+    }
+
+    continue_bool_t handle_pair(scoped_key_value_t &&, signal_t *) {
+        /* We always skip the leaf's pairs in `handle_pre_leaf()`. */
+        unreachable();
+    }
+
+    const std::vector<store_key_t> &get_collected_keys() const {
+        return collected_keys_;
+    }
+
+    bool get_aborted() const {
+        return aborted_;
+    }
+
+    store_key_t get_traversed_right_bound() const {
+        return traversed_right_bound_;
+    }
+
+private:
+    std::vector<store_key_t> collected_keys_;
+    bool aborted_;
+    int64_t leaves_visited_;
+    store_key_t traversed_right_bound_;
+
+    value_sizer_t *sizer_;
+    signal_t *interruptor_;
+
+    DISABLE_COPYING(defrag_leaf_collector_t);
+};
+
+void rdb_defragment_range(
+        store_t *store,
+        key_range_t *range_inout,
+        cache_account_t *cache_account,
+        signal_t *interruptor)
+    THROWS_ONLY(interrupted_exc_t) {
+    rdb_value_sizer_t sizer(store->cache->max_block_size());
+
+    /* Step 1: Find underfull leaves with a snapshotted read traversal. Only
+    leaf headers are inspected, so a well-packed range scans quickly. */
+    defrag_leaf_collector_t collector(&sizer, interruptor);
+    {
+        read_token_t read_token;
+        store->new_read_token(&read_token);
+        scoped_ptr_t<txn_t> txn;
+        scoped_ptr_t<real_superblock_t> superblock;
+        store->acquire_superblock_for_read(
+            &read_token, &txn, &superblock, interruptor, true /* USE_SNAPSHOT */);
+        txn->set_account(cache_account);
+        btree_depth_first_traversal(
+            superblock.get(), *range_inout, &collector, access_t::read,
+            direction_t::FORWARD, release_superblock_t::RELEASE, interruptor);
+        if (interruptor->is_pulsed()) {
+            /* The traversal stops early on interruption but doesn't throw. */
+            throw interrupted_exc_t();
+        }
+    }
+
+    /* Step 2: Fix each underfull leaf in its own small write transaction. A
+    write descent for a key in the leaf merges or levels underfull internal
+    nodes on the way down, and `check_and_handle_underfull()` then does the
+    same for the leaf itself -- the identical machinery a regular write would
+    run, just without changing any value. Concurrent writes may have repacked
+    or split a collected leaf in the meantime; the underfull check simply
+    comes up false then and the transaction is a no-op. */
+    rdb_live_deletion_context_t deletion_context;
+    for (const store_key_t &key : collector.get_collected_keys()) {
+        scoped_ptr_t<txn_t> txn;
+        scoped_ptr_t<real_superblock_t> superblock;
+        write_token_t token;
+        store->new_write_token(&token);
+        store->acquire_superblock_for_write(
+            2, write_durability_t::SOFT, &token, &txn, &superblock, interruptor);
+        txn->set_account(cache_account);
+        {
+            keyvalue_location_t kv_location;
+            find_keyvalue_location_for_write(
+                &sizer,
+                superblock.get(),
+                key.btree_key(),
+                /* don't update subtree recencies as we traverse the tree */
+                repli_timestamp_t::distant_past,
+                deletion_context.balancing_detacher(),
+                &kv_location,
+                nullptr /* profile::trace_t */,
+                nullptr /* pass_back_superblock */);
+            check_and_handle_underfull(
+                &sizer, &kv_location.buf, &kv_location.last_buf,
+                kv_location.superblock, key.btree_key(),
+                deletion_context.balancing_detacher());
+        }
+        superblock.reset();
+        txn->commit();
+    }
+
+    /* Step 3: Update `*range_inout` for the next pass. */
+    if (!collector.get_aborted()) {
+        *range_inout = key_range_t::empty();
+    } else {
+        store_key_t new_left = collector.get_traversed_right_bound();
+        if (new_left.increment()
+                && (range_inout->right.unbounded
+                    || new_left < range_inout->right.key())) {
+            range_inout->left = new_left;
+        } else {
+            *range_inout = key_range_t::empty();
+        }
+    }
+}
+
 void noop_value_deleter_t::delete_value(buf_parent_t, const void *) const { }
@@ -16,6 +16,7 @@
 #include "rdb_protocol/store.hpp"
 
 class btree_slice_t;
+class cache_account_t;
 enum class delete_mode_t;
 class deletion_context_t;
 class key_tester_t;
@@ -103,6 +104,15 @@ struct btree_batched_replacer_t {
         const ql::datum_t &res_,
         const ql::datum_t &write_timestamp,
         const counted_t<const ql::func_t> &write_hook) const;
+
+private:
+    // The environment the write hook runs in.  It is built lazily on the
+    // first hooked document and then reused for the rest of the batch; write
+    // hooks are required to be deterministic, so the env carries no
+    // per-document state, and constructing one per row (with its regex cache
+    // and optarg machinery) is measurable on hook-heavy inserts.
+    mutable cond_t hook_env_non_interruptor;
+    mutable scoped_ptr_t<ql::env_t> hook_env;
 };
 struct btree_point_replacer_t {
     virtual ~btree_point_replacer_t() { }
@@ -131,6 +141,21 @@ void rdb_set(const store_key_t &key, ql::datum_t data,
              profile::trace_t *trace,
              promise_t<superblock_t *> *pass_back_superblock = nullptr);
 
+/* Like `rdb_set()` with `overwrite`, but also takes the datum's serialization
+(a copy of the sender's on-disk bytes, as backfill items carry them) and
+writes those bytes into the new blob verbatim instead of re-serializing
+`data`.  `data` is still used for the modification report, which the caller
+needs for secondary index updates. */
+void rdb_backfill_set(const store_key_t &key,
+                      ql::datum_t data,
+                      const std::vector<char> &serialized_data,
+                      btree_slice_t *slice,
+                      repli_timestamp_t timestamp,
+                      superblock_t *superblock,
+                      const deletion_context_t *deletion_context,
+                      rdb_modification_info_t *mod_info,
+                      promise_t<superblock_t *> *pass_back_superblock = nullptr);
+
 void rdb_delete(const store_key_t &key, btree_slice_t *slice, repli_timestamp_t
                 timestamp, real_superblock_t *superblock,
                 const deletion_context_t *deletion_context,
@@ -337,14 +362,34 @@ void rdb_update_sindexes(
     index_vals_t *old_keys_out,
     index_vals_t *new_keys_out);
 
+/* `cache_account` is the (low-priority) account the traversal's reads get
+charged to.  The caller owns it so that one account can serve all of a
+construction's passes; creating and destroying an account means two hops to
+the serializer thread, which adds up over the thousands of passes a large
+table's construction runs. */
 void post_construct_secondary_index_range(
         store_t *store,
         const std::set<uuid_u> &sindexes_to_post_construct,
         key_range_t *construction_range_inout,
+        cache_account_t *cache_account,
         const std::function<bool(int64_t)> &check_should_abort,
         signal_t *interruptor)
     THROWS_ONLY(interrupted_exc_t);
 
+/* Performs one bounded pass of leaf defragmentation over `*range_inout`:
+scans a limited number of leaves with a snapshotted read traversal, then
+merges or levels the underfull ones through the same machinery the write path
+uses. Updates `*range_inout` to the range still to be scanned (empty once the
+whole range has been covered), so the caller can loop and pace the passes.
+`cache_account` should be a low-priority account, as for
+`post_construct_secondary_index_range`. */
+void rdb_defragment_range(
+        store_t *store,
+        key_range_t *range_inout,
+        cache_account_t *cache_account,
+        signal_t *interruptor)
+    THROWS_ONLY(interrupted_exc_t);
+
 /* This deleter actually deletes the value and all associated blocks. */
 class rdb_value_deleter_t : public value_deleter_t {
 public:
@@ -4,6 +4,7 @@
 #include <functional>  // NOLINT(build/include_order)
 
 #include "arch/runtime/coroutines.hpp"
+#include "arch/timing.hpp"
 #include "btree/depth_first_traversal.hpp"
 #include "btree/leaf_node.hpp"
 #include "btree/node.hpp"
@@ -21,9 +22,11 @@
 #include "containers/scoped.hpp"
 #include "logger.hpp"
 #include "rdb_protocol/btree.hpp"
+#include "rdb_protocol/env.hpp"
 #include "rdb_protocol/erase_range.hpp"
 #include "rdb_protocol/protocol.hpp"
 #include "stl_utils.hpp"
+#include "time.hpp"
 
 // The maximal number of writes that can be in line for a superblock acquisition
 // at a time (including the write that's currently holding the superblock, if any).
@@ -77,6 +80,50 @@ const char* sindex_not_ready_exc_t::what() const throw() {
 
 sindex_not_ready_exc_t::~sindex_not_ready_exc_t() throw() { }
 
+class store_t::sindex_info_cache_t {
+public:
+    // Maps the sindex id to the serialized definition we deserialized from
+    // and the result of deserializing it.
+    std::map<uuid_u, std::pair<std::vector<char>, sindex_disk_info_t> > entries;
+
+    // Long-lived evaluation environments for index functions, paired with the
+    // ReQL version they were built for.  Index functions are deterministic
+    // and evaluated non-interruptibly, so one never-pulsed interruptor serves
+    // all of them.
+    cond_t non_interruptor;
+    std::map<uuid_u, std::pair<reql_version_t, scoped_ptr_t<ql::env_t> > > envs;
+};
+
+const sindex_disk_info_t &store_t::cached_sindex_info(
+        const secondary_index_t &sindex) {
+    assert_thread();
+    auto *entry = &sindex_info_cache->entries[sindex.id];
+    if (entry->first != sindex.opaque_definition) {
+        sindex_disk_info_t info;
+        try {
+            deserialize_sindex_info_or_crash(sindex.opaque_definition, &info);
+        } catch (const archive_exc_t &e) {
+            crash("%s", e.what());
+        }
+        entry->first = sindex.opaque_definition;
+        entry->second = std::move(info);
+    }
+    return entry->second;
+}
+
+ql::env_t *store_t::cached_sindex_env(
+        const secondary_index_t &sindex, reql_version_t reql_version) {
+    assert_thread();
+    auto *entry = &sindex_info_cache->envs[sindex.id];
+    if (!entry->second.has() || entry->first != reql_version) {
+        entry->first = reql_version;
+        entry->second.init(new ql::env_t(&sindex_info_cache->non_interruptor,
+                                         ql::return_empty_normal_batches_t::NO,
+                                         reql_version));
+    }
+    return entry->second.get();
+}
+
 store_t::store_t(const region_t &_region,
                  serializer_t *serializer,
                  cache_balancer_t *balancer,
@@ -91,6 +138,13 @@ store_t::store_t(const region_t &_region,
                  which_cpu_shard_t which_cpu_shard)
     : store_view_t(_region),
       perfmon_collection(),
+      pm_write_token_wait(secs_to_ticks(1)),
+      pm_write_superblock_wait(secs_to_ticks(1)),
+      pm_write_commit(secs_to_ticks(1)),
+      pm_write_stages_membership(&perfmon_collection,
+          &pm_write_token_wait, "write_token_wait",
+          &pm_write_superblock_wait, "write_superblock_wait",
+          &pm_write_commit, "write_commit"),
       io_backender_(io_backender), base_path_(base_path),
       perfmon_collection_membership(parent_perfmon_collection, &perfmon_collection, perfmon_name),
       ctx(_ctx),
@@ -99,6 +153,7 @@ store_t::store_t(const region_t &_region,
 {
     cache.init(new cache_t(serializer, balancer, &perfmon_collection, which_cpu_shard));
     general_cache_conn.init(new cache_conn_t(cache.get()));
+    sindex_info_cache.init(new sindex_info_cache_t);
 
     if (create) {
         vector_stream_t key;
@@ -192,6 +247,14 @@ void store_t::read(
         signal_t *interruptor)
         THROWS_ONLY(interrupted_exc_t) {
     assert_thread();
+    /* Point reads are deliberately not micro-batched here (collecting gets
+    that arrive within some window into one composite read). The superblock is
+    acquired in read mode, so any number of point reads share it concurrently
+    -- there is no per-read serialization that batching would amortize, only
+    the cheap acquisition itself -- and a time-window batcher would put a
+    latency floor under every get to help only the overloaded case. Clients
+    that genuinely want batched gets already have `r.getAll`, which arrives as
+    a single read. */
     scoped_ptr_t<txn_t> txn;
     scoped_ptr_t<real_superblock_t> superblock;
 
@@ -216,6 +279,14 @@ void store_t::write(
         THROWS_ONLY(interrupted_exc_t) {
     assert_thread();
 
+    /* Each write gets its own cache transaction. Merging concurrent writes
+    into a shared transaction here would buy less than it seems: the page
+    cache already merges the `page_txn_t`s of transactions that commit close
+    together into a single flush (see `merge_into_waiting_for_spawn_flush()`
+    in buffer_cache/page_cache.cc), and the superblock is handed to the next
+    write as soon as this one has descended past it. What remains per write
+    is the metainfo update and the timestamp, and replication relies on those
+    being applied one write at a time. */
     scoped_ptr_t<txn_t> txn;
     scoped_ptr_t<real_superblock_t> real_superblock;
     // We assume one block per document, plus changes to the stats block and superblock.
@@ -233,10 +304,12 @@ void store_t::write(
         // transaction, or doesn't perform any changes at all).
         // Hence it should be save to commit here even when interrupted.
         real_superblock.reset();
+        block_pm_duration commit_timer(&pm_write_commit);
         txn->commit();
         throw;
     }
     real_superblock.reset();
+    block_pm_duration commit_timer(&pm_write_commit);
     txn->commit();
 }
 
@@ -261,8 +334,13 @@ void store_t::reset_data(
         const int expected_change_count = 2 + max_erased_per_pass;
         write_token_t token;
         new_write_token(&token);
+        /* Each pass leaves the tree and the metainfo mutually consistent, so
+        a crash between passes just looks like the erase hadn't gotten as far.
+        Hence the passes can commit with soft durability -- syncing once per
+        `max_erased_per_pass` keys made large erases (resharding cleanup)
+        fsync-bound -- and a single hard commit below covers all of them. */
         acquire_superblock_for_write(expected_change_count,
-                                     durability,
+                                     write_durability_t::SOFT,
                                      &token,
                                      &txn,
                                      &superblock,
@@ -301,6 +379,27 @@ void store_t::reset_data(
         sindex_block.reset_buf_lock();
         txn->commit();
     }
+
+    if (durability == write_durability_t::HARD) {
+        /* Re-writing the metainfo for the whole subregion is idempotent, and
+        it dirties the same blocks the passes above touched, so this commit's
+        flush cannot be reordered ahead of theirs.  Waiting on it therefore
+        makes the entire erase hard-durable. */
+        scoped_ptr_t<txn_t> txn;
+        scoped_ptr_t<real_superblock_t> superblock;
+        write_token_t token;
+        new_write_token(&token);
+        acquire_superblock_for_write(1,
+                                     write_durability_t::HARD,
+                                     &token,
+                                     &txn,
+                                     &superblock,
+                                     interruptor);
+        metainfo->update(superblock.get(),
+                         region_map_t<binary_blob_t>(subregion, zero_metainfo));
+        superblock.reset();
+        txn->commit();
+    }
 }
 
 std::map<std::string, std::pair<sindex_config_t, sindex_status_t> > store_t::sindex_list(
@@ -716,11 +815,18 @@ void store_t::clear_sindex_data(
         const key_range_t &pkey_range_to_clear,
         signal_t *interruptor)
         THROWS_ONLY(interrupted_exc_t) {
-    /* Delete one piece of the secondary index at a time */
+    /* Delete one piece of the secondary index at a time, and pace ourselves:
+    clearing a dropped index is pure background maintenance, but each chunk is
+    a write transaction that competes with live queries for the superblock,
+    the cache, and the disk.  After committing a chunk we nap for as long as
+    the chunk took, which caps the clearing job at roughly half of the IO it
+    would otherwise consume and lets it run flat out on an idle store (cheap
+    chunks make for short naps). */
     key_range_t remaining_range = key_range_t::universe();
     for (bool reached_end = false; !reached_end;)
     {
         coro_t::yield();
+        const ticks_t chunk_start_time = get_ticks();
 
         /* Start a write transaction. */
         write_token_t token;
@@ -823,10 +929,19 @@ void store_t::clear_sindex_data(
 
         sindex_superblock.reset();
         txn->commit();
+
+        if (!reached_end) {
+            const int64_t chunk_ms =
+                (get_ticks().nanos - chunk_start_time.nanos) / MILLION;
+            nap(std::min<int64_t>(chunk_ms, 1000), interruptor);
+        }
     }
 }
 
 void store_t::drop_sindex(uuid_u sindex_id) THROWS_NOTHING {
+    sindex_info_cache->entries.erase(sindex_id);
+    sindex_info_cache->envs.erase(sindex_id);
+
     /* Start a transaction. */
     write_token_t token;
     new_write_token(&token);
@@ -1267,8 +1382,14 @@ void store_t::acquire_superblock_for_write(
     assert_thread();
 
     object_buffer_t<fifo_enforcer_sink_t::exit_write_t>::destruction_sentinel_t destroyer(&token->main_write_token);
-    wait_interruptible(token->main_write_token.get(), interruptor);
+    {
+        block_pm_duration timer(&pm_write_token_wait);
+        wait_interruptible(token->main_write_token.get(), interruptor);
+    }
 
+    /* This covers both the transaction throttler (inside the `txn_t`
+    constructor) and the wait for the superblock. */
+    block_pm_duration timer(&pm_write_superblock_wait);
     get_btree_superblock_and_txn_for_writing(
             general_cache_conn.get(),
             &write_superblock_acq_semaphore,
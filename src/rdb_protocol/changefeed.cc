@@ -9,6 +9,7 @@
 #include "concurrency/cross_thread_signal.hpp"
 #include "concurrency/interruptor.hpp"
 #include "containers/archive/boost_types.hpp"
+#include "perfmon/perfmon.hpp"
 #include "rdb_protocol/artificial_table/backend.hpp"
 #include "rdb_protocol/btree.hpp"
 #include "rdb_protocol/env.hpp"
@@ -25,6 +26,17 @@ namespace ql {
 
 namespace changefeed {
 
+// Node-wide visibility into slow changefeed consumers: how many subscription
+// queues we've had to coalesce because the consumer fell behind, and how many
+// changes we've dropped outright.  These are registered in the global
+// collection, so they show up in the server stats next to the coroutine and
+// allocator counters.
+static perfmon_counter_t pm_changefeed_queues_coalesced, pm_changefeed_changes_dropped;
+static perfmon_multi_membership_t pm_changefeed_membership(
+    &get_global_perfmon_collection(),
+    &pm_changefeed_queues_coalesced, "changefeed_queues_coalesced",
+    &pm_changefeed_changes_dropped, "changefeed_changes_dropped");
+
 struct indexed_datum_t {
     indexed_datum_t(
             datum_t _val,
@@ -165,6 +177,13 @@ void debug_print(printf_buffer_t *buf, const T &t) {
 }
 
 enum class pop_type_t { RANGE, POINT };
+/* Per-subscription buffer between the feed fan-out and the client cursor.
+The `squash` optarg selects the implementation: `squashing_queue_t` coalesces
+successive changes to the same key (and drops changes that cancel out), and a
+numeric `squash` additionally sets `min_interval` on the subscription, which
+is the latency budget we wait before draining the queue.  Everything queued
+when a batch is assembled goes out in a single response frame, so a squashed
+feed ships one batch per interval instead of one message per change. */
 class maybe_squashing_queue_t {
 public:
     virtual ~maybe_squashing_queue_t() { }
@@ -518,6 +537,14 @@ void server_t::send_one_with_lock(
     send(manager, client->first, stamped_msg_t(uuid, stamp, std::move(msg)));
 }
 
+/* Note that squashing happens on the client side (see
+`maybe_squashing_queue_t`), not here, even though squashing before the send
+would also save network traffic.  The granularity doesn't allow it: `clients`
+has one entry per peer *node*, and the single stamped stream we send to a
+peer feeds every subscription on that node — squashed and unsquashed, point
+and range — while `squash` is a per-subscription setting.  Squashing here
+would also mean dropping stamps, and `get_stamp`/`purge_below` assume the
+client can account for every stamp up to the one it read. */
 void server_t::send_all(
         const msg_t &msg,
         const store_key_t &key,
@@ -884,9 +911,7 @@ limit_manager_t::limit_manager_t(
         nullptr);
 
     guarantee(ops.size() == 0);
-    for (const auto &transform : spec.range.transforms) {
-        ops.push_back(make_op(transform));
-    }
+    make_ops(spec.range.transforms, &ops);
 
     guarantee(item_queue.size() == 0);
     for (const auto &pair : item_vec) {
@@ -1544,9 +1569,15 @@ public:
           last_stamp(std::make_pair(nil_uuid(), std::numeric_limits<uint64_t>::max())) {
         if (init_squashing_queue == init_squashing_queue_t::YES && squash) {
             queue = make_scoped<squashing_queue_t>();
+            queue_is_squashing = true;
         } else {
             queue = make_scoped<nonsquashing_queue_t>();
+            queue_is_squashing = false;
         }
+        // Range subs may still need to `purge_below`, which is illegal on a
+        // squashing queue, so they only allow coalescing once their start
+        // stamps are reconciled (see `maybe_enable_squashing`).
+        coalescing_safe = (init_squashing_queue == init_squashing_queue_t::YES);
     }
     virtual void add_el(
         const uuid_u &shard_uuid,
@@ -1569,8 +1600,21 @@ public:
                 std::move(new_val)
                 DEBUG_ONLY(, sindex)));
             if (queue->size() > limits.changefeed_queue_size()) {
-                skipped += queue->size();
-                queue->clear();
+                // Degrade gracefully before dropping anything: fall back to
+                // keeping only the latest change per key, which bounds the
+                // queue by the number of distinct keys touched and still
+                // gives the consumer a consistent view of where every key
+                // ended up.  Only if even that doesn't fit do we drop the
+                // queue and report how much was skipped.
+                if (coalescing_safe && !queue_is_squashing) {
+                    enable_squashing();
+                    pm_changefeed_queues_coalesced += 1;
+                }
+                if (queue->size() > limits.changefeed_queue_size()) {
+                    skipped += queue->size();
+                    pm_changefeed_changes_dropped += queue->size();
+                    queue->clear();
+                }
             } else if (queue->size() > limits.changefeed_queue_size() / 2) {
                 // We do this even if the queue is only half full because we
                 // expect it to take some time to process and we want to be
@@ -1589,8 +1633,24 @@ public:
     const change_val_t &peek_change_val() { return queue->peek(); }
     bool active() { return !exc; }
 protected:
+    // Replaces `queue` with a squashing queue holding the same changes.
+    // Callers must make sure nothing will `purge_below` afterwards.
+    void enable_squashing() {
+        if (queue_is_squashing) return;
+        scoped_ptr_t<maybe_squashing_queue_t> old_queue = std::move(queue);
+        queue = make_scoped<squashing_queue_t>();
+        while (old_queue->size() != 0) {
+            queue->add(old_queue->pop());
+        }
+        queue_is_squashing = true;
+    }
     // The queue of changes we've accumulated since the last time we were read from.
     scoped_ptr_t<maybe_squashing_queue_t> queue;
+    bool queue_is_squashing;
+    // Whether `enable_squashing` is legal, even for subs that didn't ask to
+    // squash.  (We coalesce under memory pressure rather than dropping
+    // changes; see `add_el`.)
+    bool coalescing_safe;
 private:
     std::pair<uuid_u, uint64_t> last_stamp;
     virtual void apply_queued_changes() { } // Changes are never queued.
@@ -2182,9 +2242,7 @@ public:
           sent_state(state_t::NONE),
           artificial_include_initial(false) {
         env = make_env(outer_env);
-        for (const auto &transform : spec.transforms) {
-            ops.push_back(make_op(transform));
-        }
+        make_ops(spec.transforms, &ops);
         store_keys = spec.datumspec.primary_key_map();
         if (!store_keys.has_value()) {
             store_key_range.set(spec.datumspec.covering_range().to_primary_keyrange());
@@ -2284,12 +2342,11 @@ public:
     }
 
     void maybe_enable_squashing() {
+        // The start stamps are reconciled, so nothing will purge the queue
+        // anymore and coalescing it becomes legal whether or not we squash.
+        coalescing_safe = true;
         if (squash) {
-            scoped_ptr_t<maybe_squashing_queue_t> old_queue = std::move(queue);
-            queue = make_scoped<squashing_queue_t>();
-            while (old_queue->size() != 0) {
-                queue->add(old_queue->pop());
-            }
+            enable_squashing();
         }
     }
 
@@ -2841,6 +2898,37 @@ public:
         feed->each_range_sub(*lock, [&](range_sub_t *sub) {
             datum_t new_val = null, old_val = null;
             if (!sub->active()) return;
+            // A sub whose range can't match this change discards it below
+            // anyway; probe the cheap key/range state up front so we don't
+            // run the sub's ops (filter/map terms) on changes it can never
+            // emit.
+            optional<std::string> sindex = sub->sindex();
+            if (sindex) {
+                bool in_range = false;
+                auto old_it = change.old_indexes.find(*sindex);
+                if (old_it != change.old_indexes.end()) {
+                    for (const auto &idx : old_it->second) {
+                        if (sub->copies(idx.first) != 0) {
+                            in_range = true;
+                            break;
+                        }
+                    }
+                }
+                if (!in_range) {
+                    auto new_it = change.new_indexes.find(*sindex);
+                    if (new_it != change.new_indexes.end()) {
+                        for (const auto &idx : new_it->second) {
+                            if (sub->copies(idx.first) != 0) {
+                                in_range = true;
+                                break;
+                            }
+                        }
+                    }
+                }
+                if (!in_range) return;
+            } else {
+                if (sub->copies(change.pkey) == 0) return;
+            }
             bool trivial = false;
             if (sub->has_ops()) {
                 if (change.new_val.has()) {
@@ -2869,7 +2957,6 @@ public:
                 }
             }
             ASSERT_NO_CORO_WAITING;
-            optional<std::string> sindex = sub->sindex();
             if (sindex) {
                 std::vector<indexed_datum_t> old_idxs, new_idxs;
                 auto old_it = change.old_indexes.find(*sindex);
@@ -462,6 +462,22 @@ public:
 // There is one `server_t` per `store_t`, and it is used to send changes that
 // occur on that `store_t` to any subscribed `real_feed_t`s contained in a
 // `client_t`.
+//
+// Feeds are served by the primary replica only, so fan-out CPU lands on the
+// same node that must apply writes.  Serving feeds from secondary replicas
+// keeps coming up as the fix, and the blocker is worth recording: the stamps
+// in `stamped_msg_t` are per-(server, client) counters handed out *here*, in
+// write order under `cfeed_stamp_lock`, and a subscription's initial
+// `get_stamp` handshake is only coherent because the stamp and the read it is
+// paired with both go through this object.  A replica applies the same writes
+// but has no access to this stamp stream, so it would have to either forward
+// stamp traffic to the primary (reintroducing the load being offloaded) or
+// the replication stream would need to carry the stamps -- i.e. changefeed
+// ordering would become part of the replication protocol and of failover,
+// at which point it is a clustering project, not a changefeed change.  What
+// *is* cheap locally: `send_all` serializes one message per subscribed peer
+// node, not per subscription; client-side `real_feed_t`s do the per-sub
+// fan-out on their own nodes.
 class server_t {
 public:
     typedef server_addr_t addr_t;
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <deque>
 #include <functional>
 #include <iterator>
 
@@ -21,6 +22,7 @@
 #include "math.hpp"
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/rapidjson.h"
+#include "rapidjson/reader.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
 #include "rdb_protocol/datum_stream/array.hpp"
@@ -511,6 +513,108 @@ datum_t to_datum(const rapidjson::Value &json, const configured_limits_t &limits
     }
 }
 
+// Builds datums straight from rapidjson's SAX events, so that parsing a JSON
+// string into a datum doesn't have to materialize an intermediate DOM first.
+// Produces the same datums and the same errors as running the parser into a
+// `rapidjson::Document` and passing that to `to_datum` above.
+class json_to_datum_handler_t {
+public:
+    explicit json_to_datum_handler_t(const configured_limits_t &limits)
+        : limits_(limits) { }
+
+    bool Null() { return add(datum_t::null()); }
+    bool Bool(bool b) { return add(datum_t::boolean(b)); }
+    bool Int(int i) { return add(datum_t(static_cast<double>(i))); }
+    bool Uint(unsigned int u) { return add(datum_t(static_cast<double>(u))); }
+    bool Int64(int64_t i) { return add(datum_t(static_cast<double>(i))); }
+    bool Uint64(uint64_t u) { return add(datum_t(static_cast<double>(u))); }
+    bool Double(double d) { return add(datum_t(d)); }
+    bool RawNumber(const char *, rapidjson::SizeType, bool) {
+        // Only called when parsing with `kParseNumbersAsStringsFlag`.
+        unreachable();
+    }
+    bool String(const char *str, rapidjson::SizeType length, bool) {
+        fail_if_invalid(str, length);
+        return add(datum_t(datum_string_t(length, str)));
+    }
+    bool StartObject() {
+        objects_.emplace_back();
+        keys_.emplace_back();
+        in_object_.push_back(true);
+        return true;
+    }
+    bool Key(const char *str, rapidjson::SizeType length, bool) {
+        fail_if_invalid(str, length);
+        keys_.back() = datum_string_t(length, str);
+        return true;
+    }
+    bool EndObject(rapidjson::SizeType) {
+        const std::set<std::string> pts = { pseudo::literal_string };
+        datum_t d = std::move(objects_.back()).to_datum(pts);
+        objects_.pop_back();
+        keys_.pop_back();
+        in_object_.pop_back();
+        return add(std::move(d));
+    }
+    bool StartArray() {
+        arrays_.emplace_back(limits_);
+        in_object_.push_back(false);
+        return true;
+    }
+    bool EndArray(rapidjson::SizeType) {
+        datum_t d = std::move(arrays_.back()).to_datum();
+        arrays_.pop_back();
+        in_object_.pop_back();
+        return add(std::move(d));
+    }
+
+    datum_t result() {
+        r_sanity_check(result_.has());
+        return result_;
+    }
+
+private:
+    bool add(datum_t d) {
+        if (in_object_.empty()) {
+            result_ = std::move(d);
+        } else if (in_object_.back()) {
+            const datum_string_t &key = keys_.back();
+            bool dup = objects_.back().add(key, std::move(d));
+            rcheck_datum(!dup, base_exc_t::LOGIC,
+                         strprintf("Duplicate key %s in JSON.",
+                                   datum_t(key).print().c_str()));
+        } else {
+            arrays_.back().add(std::move(d));
+        }
+        return true;
+    }
+
+    // `deque`s because the builders are neither copyable nor movable.
+    std::deque<datum_object_builder_t> objects_;
+    std::deque<datum_array_builder_t> arrays_;
+    std::vector<datum_string_t> keys_;
+    std::vector<bool> in_object_;
+    const configured_limits_t &limits_;
+    datum_t result_;
+};
+
+datum_t parse_json_to_datum(char *json_buf,
+                            const configured_limits_t &limits,
+                            rapidjson::ParseResult *result_out) {
+    json_to_datum_handler_t handler(limits);
+    rapidjson::Reader reader;
+    rapidjson::InsituStringStream stream(json_buf);
+    // The iterative parser keeps its own parse stack, so deeply nested
+    // documents don't consume C++ stack (which is why this doesn't need
+    // `call_with_enough_stack`, unlike the recursive `to_datum` above).
+    *result_out = reader.Parse<rapidjson::kParseInsituFlag
+                               | rapidjson::kParseIterativeFlag>(stream, handler);
+    if (result_out->IsError()) {
+        return datum_t();
+    }
+    return handler.result();
+}
+
 const shared_buf_ref_t<char> *datum_t::get_buf_ref() const {
     if (data.get_internal_type() == internal_type_t::BUF_R_ARRAY
         || data.get_internal_type() == internal_type_t::BUF_R_OBJECT) {
@@ -1488,18 +1592,53 @@ std::pair<datum_string_t, datum_t> datum_t::unchecked_get_pair(size_t index) con
 }
 
 datum_t datum_t::get_field(const datum_string_t &key, throw_bool_t throw_bool) const {
-    // Use binary search on top of unchecked_get_pair()
+    return get_field_impl(key.size(), key.data(), throw_bool);
+}
+
+datum_t datum_t::get_field(const char *key, throw_bool_t throw_bool) const {
+    return get_field_impl(strlen(key), key, throw_bool);
+}
+
+datum_t datum_t::get_field_impl(
+        const size_t key_size,
+        const char *key_data,
+        throw_bool_t throw_bool) const {
+    /* Binary search over the sorted field array. This is hot enough (pluck,
+    filter, sindex functions, ...) that we keep the per-probe work minimal:
+    - The key's size is a varint decode, not a field read, so we hoist
+      size()/data() out of the loop instead of re-decoding them on every
+      probe through `compare(const datum_string_t &)`.
+    - We don't go through `unchecked_get_pair()`, which for buffer-backed
+      objects deserializes the *value* of every probed pair (and for vector-
+      backed ones copies the pair, bumping two refcounts). Probes only need
+      the key; the value is materialized once, on a hit.
+    - Taking the key as a size/data pair lets the C-string overload skip
+      allocating a `datum_string_t` for the lookup entirely. */
     size_t range_beg = 0;
     // The obj_size() also makes sure that this has the right type (R_OBJECT)
     size_t range_end = obj_size();
+    const bool is_buf =
+        data.get_internal_type() == internal_type_t::BUF_R_OBJECT;
     while (range_beg < range_end) {
         const size_t center = range_beg + ((range_end - range_beg) / 2);
-        auto center_pair = unchecked_get_pair(center);
-        const int cmp_res = key.compare(center_pair.first);
-        if (cmp_res == 0) {
-            // Found it
-            return center_pair.second;
-        } else if (cmp_res < 0) {
+        int cmp_res;
+        if (is_buf) {
+            const size_t offset = datum_get_element_offset(data.buf_ref, center);
+            datum_string_t center_key(data.buf_ref.make_child(offset));
+            cmp_res = -center_key.compare(key_size, key_data);
+            if (cmp_res == 0) {
+                return datum_deserialize_from_buf(
+                    data.buf_ref, offset + datum_serialized_size(center_key));
+            }
+        } else {
+            const std::pair<datum_string_t, datum_t> &center_pair =
+                (*data.r_object)[center];
+            cmp_res = -center_pair.first.compare(key_size, key_data);
+            if (cmp_res == 0) {
+                return center_pair.second;
+            }
+        }
+        if (cmp_res < 0) {
             range_end = center;
         } else {
             range_beg = center + 1;
@@ -1510,15 +1649,12 @@ datum_t datum_t::get_field(const datum_string_t &key, throw_bool_t throw_bool) c
     // Didn't find it
     if (throw_bool == THROW) {
         rfail(base_exc_t::NON_EXISTENCE,
-              "No attribute `%s` in object:\n%s", key.to_std().c_str(), print().c_str());
+              "No attribute `%s` in object:\n%s",
+              std::string(key_data, key_size).c_str(), print().c_str());
     }
     return datum_t();
 }
 
-datum_t datum_t::get_field(const char *key, throw_bool_t throw_bool) const {
-    return get_field(datum_string_t(key), throw_bool);
-}
-
 template <class json_writer_t>
 void write_json_unchecked_stack(const datum_t &datum, json_writer_t *writer) {
     switch (datum.get_type()) {
@@ -1735,22 +1871,31 @@ int derived_cmp(T a, T b) {
 }
 
 int datum_t::cmp_unchecked_stack(const datum_t &rhs) const {
-    bool lhs_ptype = is_ptype() && !pseudo_compares_as_obj();
-    bool rhs_ptype = rhs.is_ptype() && !rhs.pseudo_compares_as_obj();
-    if (lhs_ptype && rhs_ptype) {
-        if (get_reql_type() != rhs.get_reql_type()) {
-            return derived_cmp(get_reql_type(), rhs.get_reql_type());
+    const type_t lhs_type = get_type();
+    const type_t rhs_type = rhs.get_type();
+    // Only R_BINARY and R_OBJECT datums can be pseudotypes, so for scalar
+    // compares -- the bulk of sorting and sindex traversal -- we skip the
+    // ptype checks below, each of which costs a binary search for
+    // `$reql_type$` (and a string compare of the type on a hit).
+    if (lhs_type == R_BINARY || lhs_type == R_OBJECT
+        || rhs_type == R_BINARY || rhs_type == R_OBJECT) {
+        bool lhs_ptype = is_ptype() && !pseudo_compares_as_obj();
+        bool rhs_ptype = rhs.is_ptype() && !rhs.pseudo_compares_as_obj();
+        if (lhs_ptype && rhs_ptype) {
+            if (get_reql_type() != rhs.get_reql_type()) {
+                return derived_cmp(get_reql_type(), rhs.get_reql_type());
+            }
+            return pseudo_cmp(rhs);
+        } else if (lhs_ptype || rhs_ptype) {
+            return derived_cmp(get_type_name(name_for_sorting_t::YES),
+                               rhs.get_type_name(name_for_sorting_t::YES));
         }
-        return pseudo_cmp(rhs);
-    } else if (lhs_ptype || rhs_ptype) {
-        return derived_cmp(get_type_name(name_for_sorting_t::YES),
-                           rhs.get_type_name(name_for_sorting_t::YES));
     }
 
-    if (get_type() != rhs.get_type()) {
-        return derived_cmp(get_type(), rhs.get_type());
+    if (lhs_type != rhs_type) {
+        return derived_cmp(lhs_type, rhs_type);
     }
-    switch (get_type()) {
+    switch (lhs_type) {
     case R_NULL: return 0;
     case MINVAL: return 0;
     case MAXVAL: return 0;
@@ -2150,6 +2295,17 @@ void datum_array_builder_t::add(datum_t val) {
     rcheck_array_size_datum(vector, limits);
 }
 
+void datum_array_builder_t::add_all(std::vector<datum_t> &&vals) {
+    if (vector.empty()) {
+        vector = std::move(vals);
+    } else {
+        vector.insert(vector.end(),
+                      std::make_move_iterator(vals.begin()),
+                      std::make_move_iterator(vals.end()));
+    }
+    rcheck_array_size_datum(vector, limits);
+}
+
 void datum_array_builder_t::change(size_t index, datum_t val) {
     rcheck_datum(index < vector.size(),
                  base_exc_t::NON_EXISTENCE,
@@ -101,6 +101,17 @@ struct components_t {
 
 // A `datum_t` is basically a JSON value, with some special handling for
 // ReQL pseudo-types.
+//
+// A note on allocation: scalars (null, booleans, numbers, minval/maxval) are
+// stored inline and never touch the heap.  Rows loaded from disk or received
+// over the network arrive as BUF_R_ARRAY/BUF_R_OBJECT datums, which share a
+// single `shared_buf_t` holding the whole serialized tree; nested values are
+// materialized lazily as offsets into that buffer and the row is freed as one
+// unit when the last reference drops.  Only datums built up value by value
+// (e.g. inside `term_t::eval`) allocate per node.  Datums are refcounted and
+// routinely outlive the query that created them -- they get stored in the
+// query cache, changefeed state and cross-thread responses -- so their
+// lifetime cannot be tied to any scope narrower than the references to them.
 class datum_t {
 private:
     // Placed here so it's kept in sync with type_t. All enum values from
@@ -404,6 +415,12 @@ private:
     datum_t drop_literals(bool *encountered_literal_out) const;
     datum_t drop_literals_unchecked_stack(bool *encountered_literal_out) const;
 
+    // Shared implementation of the `get_field` overloads. Takes the key as a
+    // size/data pair so that looking up a C-string key doesn't have to
+    // allocate a `datum_string_t` first.
+    datum_t get_field_impl(size_t key_size, const char *key_data,
+                           throw_bool_t throw_bool) const;
+
     // The data_wrapper makes sure we perform proper cleanup when exceptions
     // happen during construction
     class data_wrapper_t {
@@ -528,6 +545,9 @@ public:
     // Note that these methods produce behavior that is actually specific to the
     // definition of certain ReQL terms.
     void add(datum_t val);
+    // Appends a whole batch of elements with a single move and a single
+    // array-size check. Useful when draining a stream batch by batch.
+    void add_all(std::vector<datum_t> &&vals);
     void change(size_t i, datum_t val);
 
     // On v1_13, insert and splice don't enforce the array size limit.
@@ -10,6 +10,17 @@ datum_t to_datum(
     const rapidjson::Value &json,
     const configured_limits_t &,
     reql_version_t);
+
+// Parses `json_buf` (a null-terminated, writable buffer; parsing happens
+// in-situ) directly into a datum through rapidjson's SAX interface, skipping
+// the intermediate DOM that the `to_datum` overload above needs.  On a parse
+// error, sets `*result_out` and returns an uninitialized datum; datum-level
+// errors (invalid UTF-8, duplicate keys, oversized arrays) throw just like
+// `to_datum`.
+datum_t parse_json_to_datum(
+    char *json_buf,
+    const configured_limits_t &,
+    rapidjson::ParseResult *result_out);
 }
 
 #endif  // RDB_PROTOCOL_DATUM_JSON_HPP_
@@ -3,6 +3,7 @@
 
 #include <map>
 
+#include "concurrency/pmap.hpp"
 #include "math.hpp"
 #include "rdb_protocol/batching.hpp"
 #include "rdb_protocol/datum_stream/array.hpp"
@@ -727,6 +728,16 @@ rget_reader_t::do_range_read(env_t *env, const read_t &read) {
     return unshard(rr->sorting, std::move(res));
 }
 
+/* Each `do_range_read` fans out to every live shard in parallel (see the
+`pmap` in `table_query_client_t`), so a batch costs one round trip at the
+latency of the slowest shard rather than the sum of all shards.  The
+all-shards barrier is `read_t::unshard`: we can't hand rows to the caller
+until every shard has answered, both because sorted reads need all
+substreams present for the merge and because the changefeed stamp
+validation below assumes a complete response.  Overlapping reads with the
+client round trip (issuing the next read per shard while this batch
+drains) would require per-shard cursors with their own stamp and
+`active_ranges` bookkeeping instead of the single combined read. */
 bool rget_reader_t::load_items(env_t *env, const batchspec_t &batchspec) {
     started = true;
     while (items_index >= items.size() && !shards_exhausted()) {
@@ -1489,9 +1500,9 @@ datum_t eager_datum_stream_t::as_array(env_t *env) {
     batchspec_t batchspec = batchspec_t::user(batch_type_t::TERMINAL, env);
     {
         profile::sampler_t sampler("Evaluating stream eagerly.", env->trace);
-        datum_t d;
-        while (d = next(env, batchspec), d.has()) {
-            arr.add(d);
+        std::vector<datum_t> batch;
+        while (batch = next_batch(env, batchspec), !batch.empty()) {
+            arr.add_all(std::move(batch));
             sampler.new_sample();
         }
     }
@@ -2142,9 +2153,9 @@ datum_t union_datum_stream_t::as_array(env_t *env) {
     batchspec_t batchspec = batchspec_t::user(batch_type_t::TERMINAL, env);
     {
         profile::sampler_t sampler("Evaluating stream eagerly.", env->trace);
-        datum_t d;
-        while (d = next(env, batchspec), d.has()) {
-            arr.add(d);
+        std::vector<datum_t> batch;
+        while (batch = next_batch(env, batchspec), !batch.empty()) {
+            arr.add_all(std::move(batch));
             sampler.new_sample();
         }
     }
@@ -2252,6 +2263,68 @@ map_datum_stream_t::next_raw_batch(env_t *env, const batchspec_t &batchspec) {
         batchspec_inner = batchspec_t::default_for(batch_type_t::NORMAL);
     }
     while (!is_exhausted()) {
+        // Fast path for the common one-stream map: loop over the inner batch
+        // directly instead of cycling every element through `cache`.
+        if (streams.size() == 1 && cache[0].size() == 0 && args.empty()) {
+            std::vector<datum_t> new_items
+                = streams[0]->next_batch(env, batchspec_inner);
+            if (new_items.size() == 0) {
+                if (union_type == feed_type_t::not_feed) {
+                    r_sanity_check(is_exhausted());
+                }
+                return batch;
+            }
+            for (size_t i = 0; i < new_items.size(); ++i) {
+                args.push_back(std::move(new_items[i]));
+                datum_t datum = func->call(env, args)->as_datum();
+                r_sanity_check(datum.has());
+                args.clear();
+                batcher.note_el(datum);
+                batch.push_back(std::move(datum));
+                if (batcher.should_send_batch()) {
+                    // Keep whatever is left of the inner batch for next time.
+                    for (size_t j = i + 1; j < new_items.size(); ++j) {
+                        cache[0].push_back(std::move(new_items[j]));
+                    }
+                    return batch;
+                }
+            }
+            continue;
+        }
+        // With multiple sources, refill every empty cache in parallel before
+        // assembling rows. The serial loop below blocks on one source at a
+        // time, so a multi-table map would pay each source's read latency in
+        // sequence; fetching concurrently costs one round of reads at the pace
+        // of the slowest source. The trace is disabled around the concurrent
+        // reads because `trace_t` can't handle reentrant use (same reason
+        // `union_datum_stream_t` disables it for its read coroutines).
+        size_t num_empty_caches = 0;
+        for (const auto &c : cache) {
+            num_empty_caches += c.empty() ? 1 : 0;
+        }
+        if (num_empty_caches > 1 && args.empty()) {
+            profile::disabler_t disabler(env->trace);
+            std::exception_ptr first_exc;
+            pmap(streams.size(), [&](int64_t i) {
+                if (!cache[i].empty()) {
+                    return;
+                }
+                try {
+                    std::vector<datum_t> new_items =
+                        streams[i]->next_batch(env, batchspec_inner);
+                    for (auto &&item : new_items) {
+                        cache[i].push_back(std::move(item));
+                    }
+                } catch (...) {
+                    if (first_exc == nullptr) {
+                        first_exc = std::current_exception();
+                    }
+                }
+            });
+            if (first_exc != nullptr) {
+                std::rethrow_exception(first_exc);
+            }
+        }
         while (args.size() < streams.size()) {
             if (cache[args.size()].size() == 0) {
                 std::vector<datum_t> new_items = streams[args.size()]->next_batch(
@@ -2311,14 +2384,22 @@ eq_join_datum_stream_t::eq_join_datum_stream_t(counted_t<datum_stream_t> _stream
     is_infinite_eq_join(stream->is_infinite()),
     eq_join_type(stream->cfeed_type()) { }
 
+// The number of left-stream rows an ordered eq_join reads per lookup round.
+// Batching the keys amortizes the multi-get round trip over many rows; the
+// right-side matches of a round are buffered to restore the left stream's
+// order, so the round size also bounds that buffer.
+const int64_t ORDERED_EQ_JOIN_ROWS_PER_ROUND = 64;
+
 std::vector<datum_t> eq_join_datum_stream_t::next_raw_batch(
     env_t *env,
     const batchspec_t &batchspec) {
     batcher_t batcher = batchspec.to_batcher();
 
-    batchspec_t inner_batchspec = ordered ?
-        batchspec_t::all().with_at_most(1) :
-        batchspec;
+    if (ordered) {
+        return next_ordered_batch(env, batchspec, &batcher);
+    }
+
+    batchspec_t inner_batchspec = batchspec;
 
     std::vector<datum_t> res;
     while (!is_exhausted() && !batcher.should_send_batch()) {
@@ -2398,9 +2479,94 @@ std::vector<datum_t> eq_join_datum_stream_t::next_raw_batch(
     return res;
 }
 
+std::vector<datum_t> eq_join_datum_stream_t::next_ordered_batch(
+    env_t *env,
+    const batchspec_t &batchspec,
+    batcher_t *batcher) {
+    std::vector<datum_t> res;
+    const datum_string_t right("right");
+    const datum_string_t left("left");
+    while (!is_exhausted() && !batcher->should_send_batch()) {
+        if (ordered_pending.empty()) {
+            // Start a new round. Ordered joins used to read one left row per
+            // lookup, paying a full round trip per row; reading a bounded run
+            // of rows lets one multi-get serve the whole run.
+            ordered_right_rows.clear();
+            std::vector<datum_t> stream_batch = stream->next_batch(
+                env,
+                batchspec_t::all().with_at_most(ORDERED_EQ_JOIN_ROWS_PER_ROUND));
+            if (stream_batch.empty()) {
+                // The input stream is either exhausted or a changefeed. In
+                // either case we abort and emit our current results.
+                break;
+            }
+            std::map<datum_t, uint64_t> keys;
+            for (size_t i = 0; i < stream_batch.size(); ++i) {
+                datum_t key_val;
+                try {
+                    key_val = predicate->call(
+                        env,
+                        std::vector<datum_t>{stream_batch[i]})->as_datum();
+                } catch (const exc_t &e) {
+                    if (e.get_type() == base_exc_t::NON_EXISTENCE) {
+                        continue;
+                    } else {
+                        throw;
+                    }
+                }
+                if (key_val.get_type() != datum_t::type_t::R_NULL) {
+                    keys[key_val] = 1;
+                    ordered_pending.push_back(
+                        std::make_pair(key_val, stream_batch[i]));
+                }
+            }
+            if (ordered_pending.empty()) {
+                continue;
+            }
+            scoped_ptr_t<reader_t> reader = table->get_all_with_sindexes(
+                env,
+                datumspec_t(std::move(keys)),
+                join_index.to_std(),
+                backtrace());
+            // Drain this round's matches. They arrive in shard order, not
+            // left-stream order, so they have to be buffered before we can
+            // emit anything; the round size bounds this buffer.
+            while (!reader->is_finished()) {
+                std::vector<rget_item_t> items =
+                    reader->raw_next_batch(env, batchspec);
+                for (auto &&item : items) {
+                    datum_t key = item.sindex_key.has()
+                        ? item.sindex_key
+                        : item.data.get_field(join_index);
+                    ordered_right_rows.insert(
+                        std::make_pair(std::move(key), std::move(item.data)));
+                }
+            }
+        }
+        while (!ordered_pending.empty() && !batcher->should_send_batch()) {
+            std::pair<datum_t, datum_t> pending =
+                std::move(ordered_pending.front());
+            ordered_pending.pop_front();
+            auto range = ordered_right_rows.equal_range(pending.first);
+            for (auto pair = range.first; pair != range.second; ++pair) {
+                ql::datum_object_builder_t res_item;
+                bool conflict = true;
+                conflict &= res_item.add(right, pair->second);
+                conflict &= res_item.add(left, pending.second);
+                guarantee(!conflict);
+                datum_t res_datum = std::move(res_item).to_datum();
+                batcher->note_el(res_datum);
+                res.push_back(std::move(res_datum));
+            }
+        }
+    }
+    return res;
+}
+
 bool eq_join_datum_stream_t::is_exhausted() const {
     if (stream->is_exhausted() &&
         get_all_items.empty() &&
+        ordered_pending.empty() &&
         (!get_all_reader.has() || get_all_reader->is_finished())) {
         return batch_cache_exhausted();
     }
@@ -60,6 +60,21 @@ struct changespec_t {
     counted_t<datum_stream_t> stream;
 };
 
+/* A stream has exactly one consumer and lives inside one query's evaluation;
+`single_threaded_countable_t` means the refcount itself is not even
+thread-safe.  A "shared" stream that materializes batches once and serves
+several cursors has been proposed for the dashboard-style workload where many
+clients run the same expensive subquery.  It doesn't fit at this layer:
+cursors belong to different connections (different `query_cache_t`s, possibly
+different threads and different authenticated users), queries have no
+server-side identity to dedupe on (two textually identical queries arrive as
+independent term trees), and a spool would need an invalidation story the
+moment the underlying table changes.  The supported way to fan one computation
+out to many clients is a changefeed (`.changes()` with `include_initial`):
+shard-side changefeed machinery is explicitly multi-client and pushes each
+change once per server rather than once per viewer.  Failing that, caching
+identical query results belongs in the application tier, which knows the
+staleness budget. */
 class datum_stream_t : public single_threaded_countable_t<datum_stream_t>,
                        public bt_rcheckable_t {
 public:
@@ -30,6 +30,9 @@ public:
     }
 
 private:
+    std::vector<datum_t> next_ordered_batch(
+        env_t *env, const batchspec_t &batchspec, batcher_t *batcher);
+
     counted_t<datum_stream_t> stream;
     scoped_ptr_t<reader_t> get_all_reader;
     std::vector<rget_item_t> get_all_items;
@@ -40,6 +43,14 @@ private:
     std::multimap<ql::datum_t,
                   ql::datum_t> sindex_to_datum;
 
+    // State for ordered joins, which work in rounds: a run of left rows is
+    // read, their keys are looked up with one multi-get, and the matches are
+    // buffered in `ordered_right_rows` so the output can follow the left
+    // stream's order. `ordered_pending` holds the (key, left row) pairs of
+    // the current round that haven't been emitted yet.
+    std::deque<std::pair<ql::datum_t, ql::datum_t> > ordered_pending;
+    std::multimap<ql::datum_t, ql::datum_t> ordered_right_rows;
+
     counted_t<const func_t> predicate;
 
     bool ordered;
@@ -15,10 +15,21 @@
 #include "debug.hpp"
 #include "utils.hpp"
 
-datum_string_t::datum_string_t() {
-    init(0, "");
+/* All empty strings share one buffer (holding just the varint-encoded length
+0), so default construction and `init(0, ...)` don't allocate. The refcount on
+`shared_buf_t` is atomic, so handing out references across threads is fine. */
+static const shared_buf_ref_t<char> &empty_string_ref() {
+    static const shared_buf_ref_t<char> *ref = []() {
+        counted_t<shared_buf_t> buffer = shared_buf_t::create(1);
+        serialize_varint_uint64_into_buf(
+            0, reinterpret_cast<uint8_t *>(buffer->data()));
+        return new shared_buf_ref_t<char>(std::move(buffer), 0);
+    }();
+    return *ref;
 }
 
+datum_string_t::datum_string_t() : data_(empty_string_ref()) { }
+
 datum_string_t::datum_string_t(size_t _size, const char *_data) {
     init(_size, _data);
 }
@@ -38,6 +49,10 @@ datum_string_t::datum_string_t(const std::string &str) {
 }
 
 void datum_string_t::init(size_t _size, const char *_data) {
+    if (_size == 0) {
+        data_ = empty_string_ref();
+        return;
+    }
     const size_t str_offset = varint_uint64_serialized_size(_size);
     counted_t<shared_buf_t> buffer = shared_buf_t::create(str_offset + _size);
     serialize_varint_uint64_into_buf(_size, reinterpret_cast<uint8_t *>(buffer->data()));
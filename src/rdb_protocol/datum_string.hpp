@@ -14,6 +14,16 @@
  *
  * Underneath `datum_string_t` uses a `shared_buf_ref_t`. This makes it
  * relatively cheap to copy.
+ *
+ * Don't be tempted to deduplicate field names through an intern pool to get
+ * pointer-compare equality. Most object field names never pass through a
+ * `datum_string_t` constructor at all: a buffer-backed object
+ * (`BUF_R_OBJECT`) keeps its names inline in the row's serialized buffer and
+ * wraps them lazily on access, so an intern table would only ever see the
+ * minority of strings built by query evaluation, and equality would still
+ * need a content compare whenever either side is buffer-backed -- i.e.
+ * always. Interning would also mean copying names out of row buffers, giving
+ * up exactly the zero-copy property this representation exists for.
  */
 class datum_string_t {
 public:
@@ -43,6 +53,12 @@ public:
 
     int compare(const datum_string_t &other) const;
 
+    // Like compare(other), but takes the other string's size and data
+    // directly. size() decodes a varint, so callers that compare one string
+    // against many (e.g. a binary search) should hoist size()/data() out of
+    // the loop and use this overload.
+    int compare(size_t other_size, const char *other_data) const;
+
     // Short cut for comparing to C-strings and STD strings
     bool operator==(const char *other) const;
     bool operator!=(const char *other) const;
@@ -57,7 +73,6 @@ public:
 
 private:
     void init(size_t _size, const char *_data);
-    int compare(size_t other_size, const char *other_data) const;
 
     // Contains the length of the string in varint encoding, followed by the actual
     // string content.
@@ -57,6 +57,13 @@ js_runner_t *env_t::get_js_runner() {
     return &js_runner_;
 }
 
+/* The tracing profiler is strictly opt-in per query: with `profile=False` no trace
+object exists, every `profile::*_t` helper checks for a null trace and does nothing, so
+the always-off cost is a branch. It's the opt-in cost that's high -- one heap-allocated
+event per traced term, because the output is a faithful event log, not a sample. An
+always-on profiler would have to be a different thing entirely (sampled tuples in
+per-thread buffers, surfaced through a system table) rather than this event log with
+the allocations shaved down. */
 scoped_ptr_t<profile::trace_t> maybe_make_profile_trace(profile_bool_t profile) {
     return profile == profile_bool_t::PROFILE
         ? make_scoped<profile::trace_t>()
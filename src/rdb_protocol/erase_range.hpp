@@ -36,6 +36,16 @@ struct always_true_key_tester_t : public key_tester_t {
 /* `rdb_erase_small_range` has a complexity of O(log n * m) where n is the size of
 the btree, and m is the number of documents actually being deleted.
 
+The per-document cost is not an artifact of the leaf format, so don't expect
+range tombstones (a leaf entry meaning "everything in [a, b) is deleted", with
+physical removal deferred to compaction) to turn this into O(log n): each
+deleted document's value has to be read anyway to build the modification
+report that removes its secondary-index entries and feeds changefeeds, and
+each value's blob chain has to be walked to detach its external blocks. A
+tombstone could only defer that per-document work, not avoid it, while adding
+a new entry code to the on-disk leaf format (a migration for every existing
+table) and an intersection check to every read path that walks a leaf.
+
 It also requires O(m) memory.
 
 It returns a number of modification reports that should be applied to secondary indexes
@@ -59,6 +59,13 @@ reql_func_t::reql_func_t(scoped_ptr_t<term_storage_t> &&_storage,
 
 reql_func_t::~reql_func_t() { }
 
+/* Each call re-walks the body's term tree.  The tree itself is compiled and
+cached once -- `wire_func_t` ships the compiled `func_t` and shards reuse it
+across batches -- so the per-row cost is the scope copy below plus one
+virtual `eval` per term node.  Lowering row predicates to something flatter
+would have to reproduce what `eval` threads through every node: backtraces
+on error, interruption and yield checks, profiling, and scoped stack-space
+checks. */
 scoped_ptr_t<val_t> reql_func_t::call(env_t *env,
                                       const std::vector<datum_t> &args,
                                       eval_flags_t eval_flags) const {
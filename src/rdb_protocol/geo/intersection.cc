@@ -70,6 +70,59 @@ bool geo_does_intersect(const ql::datum_t &g1,
     return visit_geojson(&tester, g1);
 }
 
+/* Clones the S2 geometry passed to it into a `compiled_geometry_t`, so it
+outlives the `visit_geojson()` call. */
+class geometry_compiler_t : public s2_geo_visitor_t<void> {
+public:
+    explicit geometry_compiler_t(compiled_geometry_t *out) : out_(out) { }
+
+    void on_point(const S2Point &point) {
+        out_->point_ = make_scoped<S2Point>(point);
+    }
+    void on_line(const S2Polyline &line) {
+        out_->line_.init(line.Clone());
+    }
+    void on_polygon(const S2Polygon &polygon) {
+        out_->polygon_.init(polygon.Clone());
+    }
+    void on_latlngrect(const S2LatLngRect &rect) {
+        out_->latlngrect_.init(rect.Clone());
+    }
+
+private:
+    compiled_geometry_t *out_;
+};
+
+compiled_geometry_t::compiled_geometry_t() { }
+compiled_geometry_t::~compiled_geometry_t() { }
+
+void compiled_geometry_t::init(const ql::datum_t &geojson) {
+    geometry_compiler_t compiler(this);
+    visit_geojson(&compiler, geojson);
+}
+
+bool compiled_geometry_t::has() const {
+    return point_.has() || line_.has() || polygon_.has() || latlngrect_.has();
+}
+
+bool geo_does_intersect(const compiled_geometry_t &g1,
+                        const ql::datum_t &g2) {
+    if (g1.point_.has()) {
+        inner_intersection_tester_t<S2Point> tester(g1.point_.get());
+        return visit_geojson(&tester, g2);
+    } else if (g1.line_.has()) {
+        inner_intersection_tester_t<S2Polyline> tester(g1.line_.get());
+        return visit_geojson(&tester, g2);
+    } else if (g1.polygon_.has()) {
+        inner_intersection_tester_t<S2Polygon> tester(g1.polygon_.get());
+        return visit_geojson(&tester, g2);
+    } else {
+        guarantee(g1.latlngrect_.has());
+        inner_intersection_tester_t<S2LatLngRect> tester(g1.latlngrect_.get());
+        return visit_geojson(&tester, g2);
+    }
+}
+
 bool geo_does_intersect(const S2Point &point,
                         const S2Point &other_point) {
     return point == other_point;
@@ -3,6 +3,7 @@
 #define RDB_PROTOCOL_GEO_INTERSECTION_HPP_
 
 #include "containers/counted.hpp"
+#include "containers/scoped.hpp"
 #include "rdb_protocol/geo/s2/util/math/vector3.h"
 
 namespace geo {
@@ -20,6 +21,37 @@ class datum_t;
 bool geo_does_intersect(const ql::datum_t &g1,
                         const ql::datum_t &g2);
 
+/* Holds the S2 representation of a GeoJSON object. Code that tests many
+geometries against the same query geometry (such as the geospatial index
+traversals) can parse the query once instead of re-parsing the GeoJSON
+object for every single test. */
+class compiled_geometry_t {
+public:
+    compiled_geometry_t();
+    ~compiled_geometry_t();
+
+    // Can throw `geo_exception_t`, just like the GeoJSON conversion functions.
+    void init(const ql::datum_t &geojson);
+    bool has() const;
+
+private:
+    friend class geometry_compiler_t;
+    friend bool geo_does_intersect(const compiled_geometry_t &g1,
+                                   const ql::datum_t &g2);
+
+    // At most one of these is set, depending on the GeoJSON type.
+    scoped_ptr_t<geo::S2Point> point_;
+    scoped_ptr_t<geo::S2Polyline> line_;
+    scoped_ptr_t<geo::S2Polygon> polygon_;
+    scoped_ptr_t<geo::S2LatLngRect> latlngrect_;
+
+    DISABLE_COPYING(compiled_geometry_t);
+};
+
+/* A variant whose left-hand side has been parsed ahead of time */
+bool geo_does_intersect(const compiled_geometry_t &g1,
+                        const ql::datum_t &g2);
+
 /* Variants for each pair of S2 geometry */
 bool geo_does_intersect(const geo::S2Point &point,
                         const geo::S2Point &other_point);
@@ -69,10 +69,7 @@ geo_job_data_t::geo_job_data_t(
                                         : sorting_t::UNORDERED,
                                     batcher.get(),
                                     require_sindexes_t::NO)) {
-    for (size_t i = 0; i < _transforms.size(); ++i) {
-        transformers.push_back(ql::make_op(_transforms[i]));
-    }
-    guarantee(transformers.size() == _transforms.size());
+    ql::make_ops(_transforms, &transformers);
 }
 
 /* ----------- geo_intersecting_cb_t -----------*/
@@ -100,6 +97,7 @@ geo_intersecting_cb_t::geo_intersecting_cb_t(
 
 void geo_intersecting_cb_t::init_query(const ql::datum_t &_query_geometry) {
     query_geometry = _query_geometry;
+    compiled_query_geometry.init(_query_geometry);
     std::vector<geo::S2CellId> covering(
         compute_cell_covering(query_geometry, QUERYING_GOAL_GRID_CELLS));
     geo_index_traversal_helper_t::init_query(
@@ -174,9 +172,8 @@ continue_bool_t geo_intersecting_cb_t::on_candidate(
             }
         }
 
-        // TODO (daniel): This is a little inefficient because we re-parse
-        // the query_geometry for each test.
-        if ((definitely_intersects || geo_does_intersect(query_geometry, sindex_val))
+        if ((definitely_intersects
+             || geo_does_intersect(compiled_query_geometry, sindex_val))
             && post_filter(sindex_val, val)) {
             if (distinct_emitted->size() >= env->limits().array_size_limit()) {
                 emit_error(ql::exc_t(ql::base_exc_t::RESOURCE,
@@ -17,6 +17,7 @@
 #include "rdb_protocol/geo/ellipsoid.hpp"
 #include "rdb_protocol/geo/exceptions.hpp"
 #include "rdb_protocol/geo/indexing.hpp"
+#include "rdb_protocol/geo/intersection.hpp"
 #include "rdb_protocol/geo/lon_lat_types.hpp"
 #include "rdb_protocol/protocol.hpp"
 #include "rdb_protocol/shards.hpp"
@@ -115,6 +116,9 @@ private:
     btree_slice_t *slice;
     geo_sindex_data_t sindex;
     ql::datum_t query_geometry;
+    // The S2 representation of `query_geometry`. Parsing it once here saves
+    // `on_candidate()` from re-parsing the GeoJSON for every candidate row.
+    compiled_geometry_t compiled_query_geometry;
 
     ql::env_t *env;
 
@@ -6,6 +6,10 @@
 #include "buffer_cache/blob.hpp"
 #include "rdb_protocol/datum.hpp"
 
+/* The in-leaf representation of a row: a blob ref of at most
+`blob::btree_maxreflen` bytes.  Small values are stored inline in the ref;
+larger ones live in blob blocks outside the leaf and are only read when the
+datum is actually needed. */
 struct rdb_value_t {
     char contents[1];
 
@@ -141,4 +141,55 @@ bool lt_cmp_t::operator()(env_t *env,
     return false;
 }
 
+std::vector<datum_t> lt_cmp_t::eval_sort_key(env_t *env,
+                                             profile::sampler_t *sampler,
+                                             datum_t el) const {
+    if (sampler != nullptr) {
+        sampler->new_sample();
+    }
+
+    std::vector<datum_t> key;
+    key.reserve(comparisons.size());
+    for (auto it = comparisons.begin(); it != comparisons.end(); ++it) {
+        datum_t val;
+        try {
+            val = it->second->call(env, el)->as_datum();
+        } catch (const base_exc_t &e) {
+            if (e.get_type() != base_exc_t::NON_EXISTENCE) {
+                throw;
+            }
+        }
+        key.push_back(std::move(val));
+    }
+    return key;
+}
+
+bool lt_cmp_t::sort_key_lt(const std::vector<datum_t> &l,
+                           const std::vector<datum_t> &r) const {
+    rassert(l.size() == comparisons.size());
+    rassert(r.size() == comparisons.size());
+
+    for (size_t i = 0; i < comparisons.size(); ++i) {
+        const datum_t &lval = l[i];
+        const datum_t &rval = r[i];
+
+        if (!lval.has() && !rval.has()) {
+            continue;
+        }
+        if (!lval.has()) {
+            return true != (comparisons[i].first == DESC);
+        }
+        if (!rval.has()) {
+            return false != (comparisons[i].first == DESC);
+        }
+        int cmp_res = lval.cmp(rval);
+        if (cmp_res == 0) {
+            continue;
+        }
+        return (cmp_res < 0) != (comparisons[i].first == DESC);
+    }
+
+    return false;
+}
+
 } // namespace ql
@@ -54,6 +54,18 @@ public:
                     datum_t l,
                     datum_t r) const;
 
+    // For sorting materialized sequences: evaluates the sort functions on
+    // `el` once, yielding the element's sort key (one datum per comparison;
+    // an unset datum means the function hit NON_EXISTENCE).  Sorting by
+    // precomputed keys with `sort_key_lt` orders elements exactly like
+    // `operator()`, but calls each function once per element instead of once
+    // per comparison.
+    std::vector<datum_t> eval_sort_key(env_t *env,
+                                       profile::sampler_t *sampler,
+                                       datum_t el) const;
+    bool sort_key_lt(const std::vector<datum_t> &l,
+                     const std::vector<datum_t> &r) const;
+
 private:
     const std::vector<std::pair<order_direction_t, counted_t<const func_t> > >
         comparisons;
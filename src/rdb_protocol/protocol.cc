@@ -35,6 +35,7 @@ void post_construct_and_drain_queue(
         key_range_t *construction_range_inout,
         int64_t max_pairs_to_construct,
         store_t *store,
+        cache_account_t *cache_account,
         scoped_ptr_t<disk_backed_queue_wrapper_t<rdb_modification_report_t> >
             &&mod_queue)
     THROWS_NOTHING;
@@ -101,6 +102,12 @@ void resume_construct_sindex(
     we're constructing. We then drain the queue and atomically delete it, before we
     start the next pass. */
     const int64_t PAIRS_TO_CONSTRUCT_PER_PASS = 512;
+    /* One low-priority IO account serves every pass of this construction.
+    Creating an account hops to the serializer thread (and destroying it hops
+    again), so doing it per pass would cost two hops every
+    `PAIRS_TO_CONSTRUCT_PER_PASS` pairs. */
+    cache_account_t cache_account =
+        store->cache->create_cache_account(SINDEX_POST_CONSTRUCTION_CACHE_PRIORITY);
     key_range_t remaining_range = construct_range;
     while (!remaining_range.is_empty()) {
         scoped_ptr_t<disk_backed_queue_wrapper_t<rdb_modification_report_t> > mod_queue;
@@ -170,6 +177,7 @@ void resume_construct_sindex(
             &remaining_range,
             PAIRS_TO_CONSTRUCT_PER_PASS,
             store,
+            &cache_account,
             std::move(mod_queue));
 
         // Update the progress value
@@ -186,6 +194,7 @@ void post_construct_and_drain_queue(
         key_range_t *construction_range_inout,
         int64_t max_pairs_to_construct,
         store_t *store,
+        cache_account_t *cache_account,
         scoped_ptr_t<disk_backed_queue_wrapper_t<rdb_modification_report_t> >
             &&mod_queue)
     THROWS_NOTHING {
@@ -205,6 +214,7 @@ void post_construct_and_drain_queue(
             store,
             sindexes_to_bring_up_to_date,
             construction_range_inout,
+            cache_account,
             // Abort if the mod_queue gets larger than the `MOD_QUEUE_SIZE_LIMIT`, or
             // we've constructed `max_pairs_to_construct` pairs.
             [&](int64_t pairs_constructed) {
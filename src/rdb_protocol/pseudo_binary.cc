@@ -4,6 +4,8 @@
 #include "errors.hpp"
 
 #include "utils.hpp"
+#include "containers/archive/varint.hpp"
+#include "containers/shared_buffer.hpp"
 #include "rapidjson/rapidjson.h"
 #include "rdb_protocol/base64.hpp"
 #include "rdb_protocol/datum.hpp"
@@ -64,9 +66,28 @@ datum_string_t decode_base64_ptype(
         } else if(it->first == data_key) {
             has_data = true;
             datum_string_t base64_data = it->second.as_str();
-            std::string decoded_str = decode_base64(base64_data.data(),
-                                                    base64_data.size());
-            res = datum_string_t(decoded_str.size(), decoded_str.data());
+            /* Decode straight into the `shared_buf_t` that will back the
+            resulting `datum_string_t`, rather than going through an
+            intermediate `std::string` that the `datum_string_t` constructor
+            would copy again. The exact decoded size isn't known up front
+            (whitespace and padding), so we allocate for the worst case, leave
+            room for the largest possible varint length prefix, and place the
+            actual prefix flush against the data once the size is known. */
+            const size_t max_decoded_size =
+                decode_base64_max_size(base64_data.size());
+            const size_t max_prefix_size =
+                varint_uint64_serialized_size(max_decoded_size);
+            counted_t<shared_buf_t> buf =
+                shared_buf_t::create(max_prefix_size + max_decoded_size);
+            const size_t decoded_size = decode_base64_into(
+                base64_data.data(), base64_data.size(),
+                buf->data(max_prefix_size));
+            const size_t str_offset =
+                max_prefix_size - varint_uint64_serialized_size(decoded_size);
+            serialize_varint_uint64_into_buf(
+                decoded_size, reinterpret_cast<uint8_t *>(buf->data(str_offset)));
+            res = datum_string_t(
+                shared_buf_ref_t<char>(std::move(buf), str_offset));
         } else {
             rfail_datum(base_exc_t::LOGIC,
                         "Invalid binary pseudotype: illegal `%s` key.",
@@ -8,6 +8,13 @@
 
 namespace ql {
 
+// `serve()` grows a cursor's batch time budget when the client turns
+// `CONTINUE`s around faster than this.
+static const int64_t FAST_TURNAROUND_USECS = 10 * 1000;
+// The batch time budget never exceeds this multiple of the configured
+// maximum batch duration.
+static const int64_t MAX_BATCH_DUR_SCALE = 8;
+
 query_cache_t::query_cache_t(
             rdb_context_t *_rdb_ctx,
             ip_and_port_t _client_addr_port,
@@ -47,6 +54,14 @@ scoped_ptr_t<query_cache_t::ref_t> query_cache_t::create(query_params_t *query_p
             backtrace_registry_t::EMPTY_BACKTRACE);
     }
 
+    /* Every query is parsed, walked and compiled from scratch here.  Caching
+    compiled trees across queries ("prepared statements") would buy less than
+    it appears to: the wire protocol has no parameter placeholders, so literal
+    values are part of the term tree and two runs of the same query shape are
+    only byte-identical if every embedded value matches.  The compiled tree
+    also aliases `term_storage` (and through it the query's network buffer),
+    so a cache would have to retain that storage per entry.  Compilation is a
+    single linear pass over the query; evaluation is where the time goes. */
     global_optargs_t global_optargs;
     counted_t<const term_t> term_tree;
     try {
@@ -315,9 +330,39 @@ void query_cache_t::ref_t::serve(env_t *env, response_t *res) {
     batch_type_t batch_type = entry->has_sent_batch
                                   ? batch_type_t::NORMAL
                                   : batch_type_t::NORMAL_FIRST;
-    std::vector<datum_t> ds = entry->stream->next_batch(
-            env, batchspec_t::user(batch_type, env));
+    batchspec_t batchspec = batchspec_t::user(batch_type, env);
+    if (cfeed_type == feed_type_t::not_feed
+        && !env->get_optarg(env, "max_batch_seconds").has()) {
+        // Adapt the batch's time budget to the client's drain rate.  A client
+        // that turns a `CONTINUE` around almost immediately is consuming
+        // faster than we produce, so the per-batch round trip is pure
+        // overhead and a longer batch raises throughput.  A client that takes
+        // longer than the (scaled) budget itself to come back is the
+        // bottleneck, so we fall back toward the default and its lower
+        // latency.  The byte cap is unaffected; it already scales with row
+        // width.  We don't adapt when the user set `max_batch_seconds`
+        // explicitly, nor for feeds (a feed batch ends when the data arrives,
+        // not when the clock runs out).
+        if (entry->has_sent_batch) {
+            const int64_t turnaround_micros =
+                get_kiloticks().micros - entry->last_batch_sent_time.micros;
+            if (turnaround_micros <= FAST_TURNAROUND_USECS) {
+                entry->batch_dur_scale =
+                    std::min(entry->batch_dur_scale * 2, MAX_BATCH_DUR_SCALE);
+            } else if (turnaround_micros
+                       > batchspec.get_max_dur().micros * entry->batch_dur_scale) {
+                entry->batch_dur_scale = std::max<int64_t>(
+                    entry->batch_dur_scale / 2, 1);
+            }
+        }
+        if (entry->batch_dur_scale > 1) {
+            batchspec = batchspec.with_max_dur(kiloticks_t{
+                batchspec.get_max_dur().micros * entry->batch_dur_scale});
+        }
+    }
+    std::vector<datum_t> ds = entry->stream->next_batch(env, batchspec);
     entry->has_sent_batch = true;
+    entry->last_batch_sent_time = get_kiloticks();
     res->set_data(std::move(ds));
 
     // Note that `SUCCESS_SEQUENCE` is possible for feeds if you call `.limit`
@@ -371,7 +416,9 @@ query_cache_t::entry_t::entry_t(query_params_t *query_params,
         deterministic_time(_deterministic_time),
         start_time(get_kiloticks()),
         term_tree(std::move(_term_tree)),
-        has_sent_batch(false) { }
+        has_sent_batch(false),
+        last_batch_sent_time(kiloticks_t{0}),
+        batch_dur_scale(1) { }
 
 query_cache_t::entry_t::~entry_t() { }
 
@@ -32,6 +32,16 @@
 
 namespace ql {
 
+/* The query cache holds the server-side state of every outstanding query on
+one connection: cursor position lives in the stream inside each `entry_t`, so
+it dies with the connection and a scan interrupted by a reconnect cannot be
+picked up where it left off.  Clients that need restartable bulk scans should
+order by primary key (or a non-multi secondary index) and re-enter with
+`between(last_seen_key, upper_bound, left_bound='open')` -- the btree seek
+makes that as cheap as a server-kept position would be.  Handing out opaque
+continuation tokens instead would need a wire-protocol extension and a
+defined re-delivery semantics for truncated and multi sindex keys, where a
+key does not uniquely identify a position in the index. */
 class query_cache_t : public home_thread_mixin_t {
     class entry_t;
 public:
@@ -136,6 +146,12 @@ private:
         counted_t<datum_stream_t> stream;
         bool has_sent_batch;
 
+        // Feedback for the adaptive batch durations in `serve()`: when the
+        // previous batch was handed off, and the current time-budget
+        // multiplier for this cursor.
+        kiloticks_t last_batch_sent_time;
+        int64_t batch_dur_scale;
+
         // The order of these is very important, do not move them around
         new_mutex_t mutex; // Only one coroutine may be using this query at a time
         auto_drainer_t drainer; // Keep this entry alive until all refs are destroyed
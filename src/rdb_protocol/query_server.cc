@@ -1,6 +1,7 @@
 // Copyright 2010-2015 RethinkDB, all rights reserved.
 #include "rdb_protocol/query_server.hpp"
 
+#include "logger.hpp"
 #include "perfmon/perfmon.hpp"
 #include "rdb_protocol/pseudo_time.hpp"
 #include "rdb_protocol/rdb_backtrace.hpp"
@@ -8,6 +9,12 @@
 #include "rdb_protocol/query_cache.hpp"
 #include "rdb_protocol/query_params.hpp"
 #include "rdb_protocol/response.hpp"
+#include "time.hpp"
+
+// Queries whose first batch takes longer than this get a log line.  This is
+// deliberately coarse: it is always on, so it has to be cheap (two
+// `get_ticks()` calls per query) and quiet under normal load.
+const double SLOW_QUERY_LOG_THRESHOLD_SECS = 1.0;
 
 rdb_query_server_t::rdb_query_server_t(
     const std::set<ip_address_t> &local_addresses, int port,
@@ -35,6 +42,7 @@ void rdb_query_server_t::run_query(ql::query_params_t *query_params,
                                    signal_t *interruptor) {
     guarantee(interruptor != nullptr);
     guarantee(rdb_ctx->cluster_interface != nullptr);
+    const ticks_t start_ticks = get_ticks();
     try {
         // TODO: make this perfmon correct now that we have parallelized queries
         scoped_perfmon_counter_t client_active(&rdb_ctx->stats.clients_active);
@@ -79,6 +87,20 @@ void rdb_query_server_t::run_query(ql::query_params_t *query_params,
 #endif // NDEBUG
     }
 
+    // Only time START: a CONTINUE on a changefeed legitimately blocks until
+    // there is something to send, so its duration says nothing about query
+    // cost.  We log the token rather than the query text; the text can
+    // contain user data, and the client driver can map the token back to the
+    // query if needed.
+    if (query_params->type == Query::START) {
+        const double duration_secs =
+            ticks_to_secs(ticks_t{get_ticks().nanos - start_ticks.nanos});
+        if (duration_secs >= SLOW_QUERY_LOG_THRESHOLD_SECS) {
+            logNTC("Slow query: %.3f seconds to first batch (token %" PRIi64 ").",
+                   duration_secs, query_params->token);
+        }
+    }
+
     rdb_ctx->stats.queries_per_sec.record();
     ++rdb_ctx->stats.queries_total;
 }
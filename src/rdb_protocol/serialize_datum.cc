@@ -23,6 +23,14 @@ namespace ql {
 // before attempting to recurse into a datum (de-)serialization function
 const size_t MIN_DATUM_SERIALIZATION_STACK_SPACE = 16 * KILOBYTE;
 
+// R_ARRAY and R_OBJECT are the legacy formats, where elements are simply
+// serialized back to back and nothing can be read without deserializing
+// everything before it.  Arrays and objects have been written as BUF_R_ARRAY
+// and BUF_R_OBJECT since 2.1: those carry an element offset table up front
+// (object keys sorted), so a datum backed by the serialized buffer can look a
+// field up by binary search and materialize just that field -- a pluck of two
+// fields from a 50-field row deserializes two values, not fifty.  See
+// `datum_deserialize_from_buf` and `datum_t::get_field`.
 enum class datum_serialized_type_t {
     R_ARRAY = 1,
     R_BOOL = 2,
@@ -989,6 +997,12 @@ MUST_USE archive_result_t datum_deserialize(
         return archive_result_t::RANGE_ERROR;
     }
 
+    if (sz == 0) {
+        // Empty strings share a static buffer; don't allocate one.
+        *out = datum_string_t();
+        return archive_result_t::SUCCESS;
+    }
+
     const size_t str_offset = varint_uint64_serialized_size(sz);
     counted_t<shared_buf_t> buf =
         shared_buf_t::create(str_offset + static_cast<size_t>(sz));
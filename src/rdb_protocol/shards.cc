@@ -569,9 +569,22 @@ private:
             // Order in fact does NOT matter here.  The reason is, each `kv->first`
             // value is different, which means each operation works on a different
             // key/value pair of `acc`.
+            //
+            // Both maps use the same ordering, so rather than paying a full
+            // O(log n) key lookup per group -- which adds up with
+            // high-cardinality groups, since comparing datum keys isn't cheap
+            // -- merge with a linear two-pointer scan and hinted insertions.
+            optional_datum_less_t less;
+            auto acc_it = _acc->begin();
             for (auto kv = gres->begin(); kv != gres->end(); ++kv) {
-                auto t_it = _acc->insert(std::make_pair(kv->first, *_default_val)).first;
-                unshard_impl(env, &t_it->second, &kv->second);
+                while (acc_it != _acc->end() && less(acc_it->first, kv->first)) {
+                    ++acc_it;
+                }
+                if (acc_it == _acc->end() || less(kv->first, acc_it->first)) {
+                    acc_it = _acc->insert(
+                        acc_it, std::make_pair(kv->first, *_default_val));
+                }
+                unshard_impl(env, &acc_it->second, &kv->second);
             }
         }
     }
@@ -1101,6 +1114,65 @@ private:
     }
 };
 
+/* A run of adjacent row-local transforms (`map`, `filter`, `zip`) fused into
+a single pass over the batch.  Each row flows through the stages in order and
+a row dropped by a `filter` short-circuits the stages after it, so a typical
+`.filter(...).map(...).pluck(...)` pipeline costs one loop and one compaction
+of the batch instead of one per stage. */
+class fused_row_trans_t : public ungrouped_op_t {
+public:
+    enum class stage_kind_t { MAP, FILTER, ZIP };
+    struct stage_t {
+        stage_kind_t kind;
+        counted_t<const func_t> f;           // MAP and FILTER only
+        counted_t<const func_t> default_val; // FILTER only
+    };
+    explicit fused_row_trans_t(std::vector<stage_t> &&_stages)
+        : stages(std::move(_stages)) { }
+private:
+    virtual void lst_transform(
+        env_t *env, datums_t *lst, const std::function<datum_t()> &) {
+        auto loc = lst->begin();
+        for (auto it = lst->begin(); it != lst->end(); ++it) {
+            datum_t row = std::move(*it);
+            bool keep = true;
+            for (const auto &stage : stages) {
+                switch (stage.kind) {
+                case stage_kind_t::MAP:
+                    try {
+                        row = stage.f->call(env, row)->as_datum();
+                    } catch (const datum_exc_t &e) {
+                        throw exc_t(e, stage.f->backtrace(), 1);
+                    }
+                    break;
+                case stage_kind_t::FILTER:
+                    try {
+                        keep = stage.f->filter_call(env, row, stage.default_val);
+                    } catch (const datum_exc_t &e) {
+                        throw exc_t(e, stage.f->backtrace(), 1);
+                    }
+                    break;
+                case stage_kind_t::ZIP: {
+                    datum_t left = row.get_field("left", NOTHROW);
+                    datum_t right = row.get_field("right", NOTHROW);
+                    rcheck_datum(left.has(), base_exc_t::LOGIC,
+                           "ZIP can only be called on the result of a join.");
+                    row = right.has() ? left.merge(right) : left;
+                } break;
+                default: unreachable();
+                }
+                if (!keep) break;
+            }
+            if (keep) {
+                *loc = std::move(row);
+                ++loc;
+            }
+        }
+        lst->erase(loc, lst->end());
+    }
+    std::vector<stage_t> stages;
+};
+
 class transform_visitor_t : public boost::static_visitor<op_t *> {
 public:
     transform_visitor_t() { }
@@ -1128,6 +1200,42 @@ scoped_ptr_t<op_t> make_op(const transform_variant_t &tv) {
     return scoped_ptr_t<op_t>(boost::apply_visitor(transform_visitor_t(), tv));
 }
 
+void make_ops(const std::vector<transform_variant_t> &transforms,
+              std::vector<scoped_ptr_t<op_t> > *ops_out) {
+    std::vector<fused_row_trans_t::stage_t> run;
+    auto flush_run = [&]() {
+        if (!run.empty()) {
+            ops_out->push_back(scoped_ptr_t<op_t>(
+                new fused_row_trans_t(std::move(run))));
+            run.clear();
+        }
+    };
+    for (const auto &tv : transforms) {
+        if (const map_wire_func_t *map = boost::get<map_wire_func_t>(&tv)) {
+            run.push_back({fused_row_trans_t::stage_kind_t::MAP,
+                           map->compile_wire_func(),
+                           counted_t<const func_t>()});
+        } else if (const filter_wire_func_t *filter
+                       = boost::get<filter_wire_func_t>(&tv)) {
+            run.push_back({fused_row_trans_t::stage_kind_t::FILTER,
+                           filter->filter_func.compile_wire_func(),
+                           filter->default_filter_val.has_value()
+                               ? filter->default_filter_val->compile_wire_func()
+                               : counted_t<const func_t>()});
+        } else if (boost::get<zip_wire_func_t>(&tv) != nullptr) {
+            run.push_back({fused_row_trans_t::stage_kind_t::ZIP,
+                           counted_t<const func_t>(),
+                           counted_t<const func_t>()});
+        } else {
+            /* `group`, `distinct` and `concat_map` aren't row-local (they
+            restructure or expand the batch), so they end the current run. */
+            flush_run();
+            ops_out->push_back(make_op(tv));
+        }
+    }
+    flush_run();
+}
+
 RDB_IMPL_SERIALIZABLE_3_FOR_CLUSTER(rget_item_t, key, sindex_key, data);
 RDB_IMPL_SERIALIZABLE_2_FOR_CLUSTER(keyed_stream_t, stream, last_key);
 RDB_IMPL_SERIALIZABLE_1_FOR_CLUSTER(stream_t, substreams);
@@ -221,6 +221,21 @@ archive_result_t deserialize_grouped(read_stream_t *s, datums_t *ds) {
 }
 
 // This is basically a templated typedef with special serialization.
+//
+// Memory use is proportional to group cardinality (plus, for the stream_t
+// case, group contents), bounded only by the array size limit checks in the
+// accumulators.  Spilling oversized accumulations to disk comes up every time
+// someone wants to group a large table by a high-cardinality key, and it
+// doesn't decompose the way it first appears to: `disk_backed_queue_t` is a
+// FIFO, while grouping needs keyed aggregation, so a spill path is really an
+// external sort-merge per partition; the accumulation runs inside read
+// transactions on each shard, where stalling on writes to a scratch file
+// inverts IO priorities against the very traffic the query is competing
+// with; and for grouped map/reduce the shards aren't even the problem --
+// each shard only sees its slice, and the full-cardinality map materializes
+// on the query-home server when the per-shard results merge.  A real fix is
+// a spilling merge on the unsharding side, which is an execution-engine
+// project, not a change to this container.
 template<class T>
 class grouped_t {
 public:
@@ -279,6 +294,14 @@ public:
     insert(std::pair<datum_t, T> &&val) {
         return m.insert(std::move(val));
     }
+    // Hinted insertion, for merging in another (identically ordered)
+    // grouped_t with a linear scan.  See `deserialize` above for the same
+    // trick applied to sorted wire data.
+    typename std::map<datum_t, T, optional_datum_less_t>::iterator
+    insert(typename std::map<datum_t, T, optional_datum_less_t>::iterator hint,
+           std::pair<datum_t, T> &&val) {
+        return m.insert(hint, std::move(val));
+    }
     void
     erase(typename std::map<datum_t, T, optional_datum_less_t>::iterator pos) {
         m.erase(pos);
@@ -431,6 +454,12 @@ scoped_ptr_t<accumulator_t> make_terminal(const terminal_variant_t &t);
 scoped_ptr_t<eager_acc_t> make_to_array();
 scoped_ptr_t<eager_acc_t> make_eager_terminal(const terminal_variant_t &t);
 scoped_ptr_t<op_t> make_op(const transform_variant_t &tv);
+/* Like `make_op` for a whole transform stack, except that runs of adjacent
+row-local transforms (`map`, `filter`, `zip`) are fused into one op that makes
+a single pass over each batch.  Note that `ops_out` can end up shorter than
+`transforms`. */
+void make_ops(const std::vector<transform_variant_t> &transforms,
+              std::vector<scoped_ptr_t<op_t> > *ops_out);
 
 } // namespace ql
 
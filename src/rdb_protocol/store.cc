@@ -3,6 +3,7 @@
 
 #include <list>
 
+#include "arch/timing.hpp"
 #include "btree/backfill_debug.hpp"
 #include "btree/reql_specific.hpp"
 #include "btree/superblock.hpp"
@@ -149,6 +150,38 @@ void store_t::help_construct_bring_sindexes_up_to_date() {
 
     sindex_block.reset_buf_lock();
     txn->commit();
+
+    /* Kick off a background pass that merges underfull leaf nodes. The write
+    path only repacks a leaf when a write happens to descend into it, so
+    leaves in cold ranges of long-lived tables can sit at low occupancy
+    indefinitely, wasting cache space and scan bandwidth. The pass runs at
+    most half the time (each chunk of work is followed by a nap of the same
+    length, capped at a second), charges its reads to a low-priority cache
+    account, and skips well-packed leaves cheaply, so on a healthy table it
+    amounts to a slow, paced scan. */
+    auto defragment = [this](auto_drainer_t::lock_t store_keepalive) {
+        try {
+            with_priority_t p(CORO_PRIORITY_DEFRAGMENTATION);
+            cache_account_t defrag_account =
+                cache->create_cache_account(DEFRAGMENTATION_CACHE_PRIORITY);
+            key_range_t remaining_range = get_region().inner;
+            while (!remaining_range.is_empty()) {
+                const ticks_t pass_start_time = get_ticks();
+                rdb_defragment_range(
+                    this,
+                    &remaining_range,
+                    &defrag_account,
+                    store_keepalive.get_drain_signal());
+                const int64_t pass_ms =
+                    (get_ticks().nanos - pass_start_time.nanos) / MILLION;
+                nap(std::min<int64_t>(pass_ms, 1000),
+                    store_keepalive.get_drain_signal());
+            }
+        } catch (const interrupted_exc_t &e) {
+            /* Ignore */
+        }
+    };
+    coro_t::spawn_sometime(std::bind(defragment, drainer.lock()));
 }
 
 scoped_ptr_t<sindex_superblock_t> acquire_sindex_for_read(
@@ -209,6 +242,39 @@ void do_read(ql::env_t *env,
         if (sindex_id_out != nullptr) {
             *sindex_id_out = r_nullopt;
         }
+        // A count over everything this store holds doesn't need to touch the
+        // tree at all: every write path funnels through
+        // `apply_keyvalue_change()`, which keeps the stat block's population
+        // up to date (the distribution logic already relies on it).  This is
+        // what `r.table().count()` sends, and dashboards poll it.
+        if (rget.terminal.has_value()
+            && boost::get<ql::count_wire_func_t>(&*rget.terminal) != nullptr
+            && rget.transforms.empty()
+            && !rget.primary_keys.has_value()
+            && region_is_superset(rget.region, store->get_region())) {
+            const block_id_t stat_block_id = superblock->get_stat_block_id();
+            if (stat_block_id != NULL_BLOCK_ID) {
+                int64_t population;
+                {
+                    buf_lock_t stat_block(superblock->expose_buf(),
+                                          stat_block_id, access_t::read);
+                    buf_read_t stat_read(&stat_block);
+                    population = static_cast<const btree_statblock_t *>(
+                        stat_read.get_data_read())->population;
+                }
+                if (release_superblock == release_superblock_t::RELEASE) {
+                    superblock->release();
+                }
+                ql::grouped_t<uint64_t> count;
+                if (population > 0) {
+                    // Ungrouped rows accumulate under the empty datum, and a
+                    // scan that sees no rows creates no group at all.
+                    count[ql::datum_t()] = population;
+                }
+                res->result = std::move(count);
+                return;
+            }
+        }
         rdb_rget_slice(
             btree,
             *rget.current_shard,
@@ -314,9 +380,7 @@ struct rdb_read_visitor_t : public boost::static_visitor<void> {
         optional<uuid_u> sindex_id;
         {
             std::vector<scoped_ptr_t<ql::op_t> > ops;
-            for (const auto &transform : s.spec.range.transforms) {
-                ops.push_back(make_op(transform));
-            }
+            make_ops(s.spec.range.transforms, &ops);
             rget_read_t rget;
             rget.region = s.region;
             rget.current_shard = s.current_shard;
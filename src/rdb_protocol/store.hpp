@@ -40,6 +40,11 @@ class superblock_t;
 class txn_t;
 class cache_balancer_t;
 struct rdb_modification_report_t;
+struct sindex_disk_info_t;
+
+namespace ql {
+class env_t;
+}
 
 class sindex_not_ready_exc_t : public std::exception {
 public:
@@ -73,6 +78,24 @@ enum class update_sindexes_t {
     LEAVE_ALONE
 };
 
+/* `store_t` is the per-cpu-shard storage engine for one table: it owns the
+primary btree, the secondary index trees, and the changefeed server, and
+executes the reads, writes, and backfills that the clustering layer routes to
+it.
+
+A recurring feature idea is first-class TTL expiry: a per-table expiry field
+with a background sweeper per store that walks a timestamp sindex in small
+paced transactions, instead of users running cron-driven
+`between().delete()` queries.  The storage-side half would slot in here --
+the sweeper is a repeating timer issuing the same kind of bounded sindex-range
+deletes that `reset_data()` does for resharding, reusing the sindex read
+machinery.  The larger half is above this layer: the expiry field belongs in
+`table_config`, which means a config schema change, contract plumbing so all
+replicas sweep consistently (expiry must go through the primary as ordinary
+timestamped writes, or replicas diverge), and semantics for changefeeds on
+expiring rows.  Until someone signs up for that, expiry-by-query at least
+gets the benefit that deletes are ordinary writes the balancer and throttler
+already pace. */
 class store_t final : public store_view_t {
 public:
     using home_thread_mixin_t::assert_thread;
@@ -300,6 +323,25 @@ public:
         return secondary_index_slices.at(id).get();
     }
 
+    // Returns the deserialized `opaque_definition` of `sindex`, caching the
+    // result per sindex id.  The definition contains the index function, and
+    // deserializing it once per updated row is measurable on write-heavy
+    // tables.  The cached copy is revalidated against the serialized bytes,
+    // so a rewritten definition (see
+    // `update_sindex_last_compatible_version`) is never returned stale.  The
+    // returned reference stays valid until the index is dropped.
+    const sindex_disk_info_t &cached_sindex_info(const secondary_index_t &sindex);
+
+    // Returns a long-lived evaluation environment for `sindex`'s index
+    // function, cached per sindex id like `cached_sindex_info()`.  The
+    // environment owns the per-environment regex cache, so reusing it across
+    // rows lets a regex-based index function compile its pattern once instead
+    // of once per evaluated row.  The environment is rebuilt if the index's
+    // ReQL version changes; the returned pointer stays valid until then (or
+    // until the store is destroyed).
+    ql::env_t *cached_sindex_env(const secondary_index_t &sindex,
+                                 reql_version_t reql_version);
+
     void protocol_read(const read_t &read,
                        read_response_t *response,
                        real_superblock_t *superblock,
@@ -372,6 +414,16 @@ public:
     fifo_enforcer_sink_t main_token_sink, sindex_token_sink;
 
     perfmon_collection_t perfmon_collection;
+    /* Stage timings for the write path, so that a latency spike in the stats
+    table can be attributed to a stage: waiting behind earlier writes for the
+    fifo token, transaction throttling plus superblock acquisition, or the
+    commit.  The serializer and disk layers sample their own stages
+    (`pm_serializer_index_writes`, the disk read/write samplers), so together
+    these cover a write end to end. */
+    perfmon_duration_sampler_t pm_write_token_wait;
+    perfmon_duration_sampler_t pm_write_superblock_wait;
+    perfmon_duration_sampler_t pm_write_commit;
+    perfmon_multi_membership_t pm_write_stages_membership;
     // Mind the constructor ordering. We must destruct the cache and btree
     // before we destruct perfmon_collection
     scoped_ptr_t<cache_t> cache;
@@ -433,6 +485,12 @@ private:
 
     sindex_context_map_t sindex_context;
 
+    // Backs `cached_sindex_info()`.  Defined in btree_store.cc because
+    // `sindex_disk_info_t` lives in rdb_protocol/btree.hpp, which includes
+    // this header.
+    class sindex_info_cache_t;
+    scoped_ptr_t<sindex_info_cache_t> sindex_info_cache;
+
     // Having a lot of writes queued up waiting for the superblock to become available
     // can stall reads for unacceptably long time periods.
     // We use this semaphore to limit the number of writes that can be in line for a
@@ -9,6 +9,17 @@
 
 class real_superblock_t;
 
+/* Keeps an in-memory mirror of the metainfo stored in the superblock, so that
+reading it never touches the superblock *page* -- the constructor loads it once
+and `update()` writes through. What every accessor still does is wait on the
+caller's superblock *acquisition*. That wait is not about the metainfo at all:
+the superblock queue is the per-shard ordering point, and a read that consulted
+a lock-free (root block, metainfo) snapshot without queueing behind it could
+run against a tree that predates a write that was already acknowledged, which
+breaks read-your-writes. Since a read must acquire the superblock anyway to
+fetch the root and start its snapshot, the metainfo lookup is free once it's in
+line; the hold time is already minimized by the release-when-child-acquired
+discipline in `btree/operations.cc`. */
 class store_metainfo_manager_t {
 public:
     explicit store_metainfo_manager_t(real_superblock_t *superblock);
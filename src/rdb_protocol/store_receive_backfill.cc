@@ -2,6 +2,7 @@
 
 #include "btree/backfill.hpp"
 #include "btree/reql_specific.hpp"
+#include "containers/archive/buffer_stream.hpp"
 #include "rdb_protocol/btree.hpp"
 
 /* `MAX_CONCURRENT_BACKFILL_ITEMS` is the maximum number of coroutines we'll spawn in
@@ -194,14 +195,18 @@ void apply_item_pair(
     mod_reports_out->resize(mod_reports_out->size() + 1);
     mod_reports_out->back().primary_key = pair.key;
     if (static_cast<bool>(pair.value)) {
-        vector_read_stream_t read_stream(std::move(*pair.value));
+        /* The value arrives as a copy of the sender's on-disk serialization.
+        We still need the deserialized datum for the modification report
+        (secondary index updates), but the serialized bytes go back into the
+        new blob verbatim via `rdb_backfill_set()` instead of being
+        re-serialized. */
+        buffer_read_stream_t read_stream(pair.value->data(), pair.value->size());
         ql::datum_t datum;
         archive_result_t res = datum_deserialize(&read_stream, &datum);
         guarantee(res == archive_result_t::SUCCESS);
 
-        point_write_response_t dummy_response;
-        rdb_set(pair.key, datum, true, slice, pair.recency, superblock,
-            &deletion_context, &dummy_response, &mod_reports_out->back().info, nullptr,
+        rdb_backfill_set(pair.key, datum, *pair.value, slice, pair.recency,
+            superblock, &deletion_context, &mod_reports_out->back().info,
             pass_back_superblock);
     } else {
         point_delete_response_t dummy_response;
@@ -11,6 +11,20 @@
 release the superblock and start a new transaction. */
 static const int MAX_BACKFILL_ITEMS_PER_TXN = 100;
 
+/* The backfill producer keeps coming up as a candidate for a client-visible
+bulk-export stream, since it moves rows so much faster than cursors. It isn't
+one, and the speed doesn't come from anything a dump could reuse directly:
+backfill is a replica-sync *diff* protocol. It walks the tree comparing
+recency timestamps against another replica's version map, emits deletion
+ranges as well as rows, and -- as the constant above shows -- releases the
+superblock every hundred items, so the stream as a whole is not a consistent
+snapshot; consistency is only re-established because the receiving store
+folds the items into its own version history. What makes it fast is simply
+reading leaves in key order without per-row query evaluation, which the
+normal read path also does for an `rget` with large batch parameters. A real
+export endpoint would need its own access control, wire format, and resume
+tokens; the machinery here would contribute almost nothing to that. */
+
 /* `limiting_btree_backfill_pre_item_consumer_t` accepts `backfill_pre_item_t`s from
 `btree_send_backfill_pre()` and forwards them to the given
 `store_view_t::backfill_pre_item_consumer_t`, but it aborts after it receives a certain
@@ -253,7 +267,11 @@ continue_bool_t store_t::send_backfill(
             scoped_ptr_t<txn_t> txn;
             scoped_ptr_t<real_superblock_t> sb;
             get_btree_superblock_and_txn_for_backfilling(
-                general_cache_conn.get(), btree->get_backfill_account(), &sb, &txn);
+                general_cache_conn.get(),
+                memory_tracker->is_receiver_congested()
+                    ? btree->get_congested_backfill_account()
+                    : btree->get_backfill_account(),
+                &sb, &txn);
 
             pre_item_producer->rewind(threshold);
             pre_item_adapter_t pre_item_adapter(pre_item_producer);
@@ -4,6 +4,7 @@
 #include "arch/address.hpp"
 #include "clustering/administration/jobs/report.hpp"
 #include "concurrency/cross_thread_watchable.hpp"
+#include "memory_utils.hpp"
 #include "rdb_protocol/rdb_backtrace.hpp"
 #include "rdb_protocol/env.hpp"
 #include "rdb_protocol/func.hpp"
@@ -263,10 +264,15 @@ const raw_term_t &term_t::get_src() const {
 scoped_ptr_t<val_t> runtime_term_t::eval_on_current_stack(
         scope_env_t *env,
         eval_flags_t eval_flags) const {
-        PROFILE_STARTER_IF_ENABLED(
-        env->env->profile() == profile_bool_t::PROFILE,
+    const bool profiling = env->env->profile() == profile_bool_t::PROFILE;
+    PROFILE_STARTER_IF_ENABLED(
+        profiling,
         strprintf("Evaluating %s.", name()),
         env->env->trace);
+    thread_allocation_stats_t allocs_before = {0, 0};
+    if (profiling) {
+        allocs_before = get_thread_allocation_stats();
+    }
     // This is basically a hook for unit tests to change things mid-query
     env->env->do_eval_callback();
     DBG("EVALUATING %s (%d):\n", name(), is_deterministic());
@@ -281,6 +287,24 @@ scoped_ptr_t<val_t> runtime_term_t::eval_on_current_stack(
 #endif // INSTRUMENT
         try {
             scoped_ptr_t<val_t> ret = term_eval(env, eval_flags);
+            if (profiling) {
+                /* Attribute buffer allocations to the term's span in the
+                profile, as a zero-duration nested event so the wire format of
+                the event log doesn't change. The delta is inclusive of
+                subterms (which report their own events) and thread-wide; see
+                `get_thread_allocation_stats`. */
+                const thread_allocation_stats_t allocs_after =
+                    get_thread_allocation_stats();
+                if (allocs_after.allocations > allocs_before.allocations) {
+                    profile::starter_t alloc_event(
+                        strprintf(
+                            "Allocated %" PRIi64 " buffers (%" PRIi64 " bytes)"
+                            " on this thread.",
+                            allocs_after.allocations - allocs_before.allocations,
+                            allocs_after.bytes - allocs_before.bytes),
+                        env->env->trace);
+                }
+            }
             DEC_DEPTH;
             DBG("%s returned %s\n", name(), ret->print().c_str());
             return ret;
@@ -119,6 +119,16 @@ private:
     }
 };
 
+/* A note on allocation, for anyone tempted to add a per-query bump arena
+here: the per-query metadata is already arena-shaped.  The query bytes live in
+one `scoped_array_t` buffer; the rapidjson `Document` parses in-situ into
+that buffer with rapidjson's pool allocator (a bump arena freed wholesale when
+the document dies); `raw_term_t` walks the parsed tree in place instead of
+building nodes; and the backtrace registry is a single flat vector of frames.
+All of it is destroyed wholesale with the `term_storage_t`.  What remains as
+per-node heap traffic -- compiled `term_t`s and `generated_term_t`s -- is
+refcounted and owns datums whose destructors must actually run (they release
+shared buffers), so it can't be dropped on the floor arena-style. */
 class term_storage_t {
 public:
     virtual ~term_storage_t() { }
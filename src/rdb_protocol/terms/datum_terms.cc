@@ -51,10 +51,34 @@ private:
 class make_array_term_t : public op_term_t {
 public:
     make_array_term_t(compile_env_t *env, const raw_term_t &term)
-        : op_term_t(env, term, argspec_t(0, -1)) { }
+        : op_term_t(env, term, argspec_t(0, -1)) {
+        /* Fold arrays of literals at compile time. Drivers send `r.expr([...])`
+        as a MAKE_ARRAY over DATUM children, so without this a big literal
+        array used inside a row predicate (e.g. as the subject of `contains`)
+        gets rebuilt for every row. A literal that arrives as a bare DATUM is
+        already materialized exactly once, without a size limit, by
+        `datum_term_t`; folding the all-literal MAKE_ARRAY form keeps the two
+        spellings equivalent. Any non-DATUM child disables the fold and we
+        evaluate per call as before. */
+        bool all_literals = true;
+        for (size_t i = 0; all_literals && i < term.num_args(); ++i) {
+            all_literals = term.arg(i).type() == Term::DATUM;
+        }
+        if (all_literals) {
+            datum_array_builder_t acc(configured_limits_t::unlimited);
+            acc.reserve(term.num_args());
+            for (size_t i = 0; i < term.num_args(); ++i) {
+                acc.add(term.arg(i).datum());
+            }
+            folded_datum = std::move(acc).to_datum();
+        }
+    }
 
 private:
     virtual scoped_ptr_t<val_t> eval_impl(scope_env_t *env, args_t *args, eval_flags_t) const {
+        if (folded_datum.has()) {
+            return new_val(folded_datum);
+        }
         datum_array_builder_t acc(env->env->limits());
         acc.reserve(args->num_args());
         {
@@ -67,6 +91,7 @@ private:
         return new_val(std::move(acc).to_datum());
     }
     virtual const char *name() const { return "make_array"; }
+    datum_t folded_datum;
 
     bool is_simple_selector() const {
         return recursive_is_simple_selector();
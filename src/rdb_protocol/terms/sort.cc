@@ -1,6 +1,7 @@
 // Copyright 2010-2015 RethinkDB, all rights reserved.
 #include "rdb_protocol/terms/terms.hpp"
 
+#include <numeric>
 #include <string>
 #include <utility>
 
@@ -117,8 +118,28 @@ private:
                 rcheck_array_size(to_sort, env->env->limits());
             }
             profile::sampler_t sampler("Sorting in-memory.", env->env->trace);
-            auto fn = std::bind(lt_cmp, env->env, &sampler, ph::_1, ph::_2);
-            std::stable_sort(to_sort.begin(), to_sort.end(), fn);
+            if (to_sort.size() > 1) {
+                // Decorate-sort-undecorate: evaluate the sort functions once
+                // per element up front, so the comparator below is pure datum
+                // comparison instead of O(n log n) function calls.
+                std::vector<std::vector<datum_t> > keys;
+                keys.reserve(to_sort.size());
+                for (const auto &el : to_sort) {
+                    keys.push_back(lt_cmp.eval_sort_key(env->env, &sampler, el));
+                }
+                std::vector<size_t> order(to_sort.size());
+                std::iota(order.begin(), order.end(), 0);
+                std::stable_sort(order.begin(), order.end(),
+                                 [&](size_t a, size_t b) {
+                                     return lt_cmp.sort_key_lt(keys[a], keys[b]);
+                                 });
+                std::vector<datum_t> sorted;
+                sorted.reserve(to_sort.size());
+                for (size_t i : order) {
+                    sorted.push_back(std::move(to_sort[i]));
+                }
+                to_sort = std::move(sorted);
+            }
             seq = make_counted<array_datum_stream_t>(
                 datum_t(std::move(to_sort), env->env->limits()),
                 backtrace());
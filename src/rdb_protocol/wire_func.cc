@@ -163,6 +163,17 @@ template archive_result_t deserialize<cluster_version_t::v2_0>(
         read_stream_t *, wire_func_t *);
 
 // deserialize function for 2.1 and above
+/* A cache of compiled funcs keyed by the serialized bytes (so repeated cursor
+batches skip the recompile) has been considered and doesn't fit here. The
+archive layer hands us a stream, not a span: by the time we could compute a
+key we've already done the expensive parts (the term tree's rapidjson parse
+inside `deserialize_term_tree()` and the scope deserialization), so a cache
+could only skip `compile_term()`. It would also key poorly: the captured
+`var_scope_t` is serialized inline, and for the common parameterized query it
+differs per request even when the function body is identical. The compiled
+func *is* already reused wherever we hold an object rather than bytes -- a
+`wire_func_t` wraps a `counted_t<const func_t>`, so every copy within one
+`read_t` shares one compilation. */
 template <cluster_version_t W>
 archive_result_t deserialize_wire_func(
         read_stream_t *s, wire_func_t *wf) {
@@ -44,6 +44,16 @@ struct hash_range_t {
 // particular is that every multistore should have a
 // get_region return value with .beg == 0, .end ==
 // HASH_REGION_HASH_SIZE.
+//
+// Keep the two sharding dimensions straight when reasoning about routing
+// cost.  The hash dimension only ever carries the fixed, even
+// CPU_SHARDING_FACTOR split within one server, and mapping a hash to its CPU
+// shard already is straight arithmetic (see
+// clustering/table_contract/cpu_sharding.cc).  The dimension that varies with
+// table_config is the *inner key range* -- cross-server shard boundaries are
+// user-visible split points on primary keys, not hash boundaries -- so a
+// shard lookup is inherently a comparison against an ordered set of keys, and
+// no shift-and-mask table over hash values can express it.
 template <class inner_region_t>
 class hash_region_t {
 public:
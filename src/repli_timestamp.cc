@@ -9,20 +9,6 @@
 #include "repli_timestamp.hpp"
 #include "utils.hpp"
 
-template <cluster_version_t W>
-void serialize(write_message_t *wm, const repli_timestamp_t &tstamp) {
-    serialize<W>(wm, tstamp.longtime);
-}
-
-INSTANTIATE_SERIALIZE_FOR_CLUSTER_AND_DISK(repli_timestamp_t);
-
-template <cluster_version_t W>
-MUST_USE archive_result_t deserialize(read_stream_t *s, repli_timestamp_t *tstamp) {
-    return deserialize<W>(s, &tstamp->longtime);
-}
-
-INSTANTIATE_DESERIALIZE_SINCE_v1_13(repli_timestamp_t);
-
 const repli_timestamp_t repli_timestamp_t::invalid = { UINT64_MAX };
 const repli_timestamp_t repli_timestamp_t::distant_past = { 0 };
 
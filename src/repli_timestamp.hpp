@@ -45,10 +45,9 @@ public:
 // Returns the max of x and y, treating invalid as a negative infinity value.
 repli_timestamp_t superceding_recency(repli_timestamp_t x, repli_timestamp_t y);
 
-template <cluster_version_t W>
-void serialize(write_message_t *wm, const repli_timestamp_t &tstamp);
-template <cluster_version_t W>
-archive_result_t deserialize(read_stream_t *s, repli_timestamp_t *tstamp);
+// A repli_timestamp_t is its `longtime` on the wire, so the flat path writes
+// the same eight bytes the old per-field path did.
+ARCHIVE_MAKE_FLAT_SERIALIZABLE(repli_timestamp_t);
 
 void debug_print(printf_buffer_t *buf, repli_timestamp_t tstamp);
 
@@ -1330,7 +1330,16 @@ join_result_t connectivity_cluster_t::run_t::handle(
 
         /* Main message-handling loop: read messages off the connection until
         it's closed, which may be due to network events, or the other end
-        shutting down, or us shutting down. */
+        shutting down, or us shutting down.
+
+        Even though this loop handles one message at a time, the per-message
+        cost is amortized across a whole socket buffer: all reads below go
+        through the connection's peek buffer (see `read_buffered`), which is
+        refilled with as much data as the socket has, so deserializing the tag
+        and the payload of each queued-up message is just memcpys from memory.
+        We can't split the stream into frames generically -- only each tag's
+        handler knows its payload's framing -- and we only yield once per
+        MESSAGE_HANDLER_MAX_BATCH_SIZE messages, not per message. */
         try {
             int messages_handled_since_yield = 0;
             while (true) {
@@ -1479,6 +1488,10 @@ void connectivity_cluster_t::send_message(connection_t *connection,
        serialize that as a string. It's horribly inefficient, of course. */
     // TODO: If we don't do it this way, we (or the caller) will need
     // to worry about having the writer run on the connection thread.
+    /* Offloading the serialization of large messages to another thread runs into the
+    same problem: many of the structures a message references are reference-counted
+    with non-atomic, thread-pinned refcounts (`single_threaded_countable_t`), so the
+    writer has to run here, on the thread that owns them. */
     vector_stream_t buffer;
     // Reserve some space to reduce overhead (especially for small messages)
     buffer.reserve(1024);
@@ -1519,6 +1532,12 @@ void connectivity_cluster_t::send_message(connection_t *connection,
 #endif
 
     if (connection->is_loopback()) {
+        /* Note that we serialize even for loopback delivery, although we skip the
+        network. That's not an oversight: the write callback may reference sender-side
+        state (stack-allocated messages, objects owned by the sending coroutine) that
+        becomes invalid as soon as this call returns, so the serialized buffer *is* the
+        ownership transfer. Handing a typed payload pointer across threads instead would
+        change the lifetime contract of every `send()` call site. */
         // We could be on any thread here! Oh no!
         std::vector<char> buffer_data;
         buffer.swap(&buffer_data);
@@ -1529,7 +1548,15 @@ void connectivity_cluster_t::send_message(connection_t *connection,
         on_thread_t threader(connection->conn->home_thread());
 
         /* Acquire the send-mutex so we don't collide with other things trying
-        to send on the same connection. */
+        to send on the same connection. Messages are framed contiguously, so a large
+        message (a big rget response, a backfill chunk) does delay everything queued
+        behind it on this connection. Two things keep that tolerable: backfill and
+        rget chunk sizes are bounded by their own flow control, and heartbeat liveness
+        doesn't depend on the heartbeat message getting through promptly -- any bytes
+        read on the connection count as evidence of life (see `heartbeat_manager_t`'s
+        `keepalive_read()`), so a long transfer can't cause a spurious heartbeat
+        timeout. Interleaved chunked framing would be a cluster wire-format change and
+        would need per-message reassembly buffers on the receive side. */
         {
             /* The `true` is for eager waiting, which is a significant performance
             optimization in this case. */
@@ -116,6 +116,14 @@ public:
     `get_drain_signal()`. There will never be two `connection_t` objects that refer to
     the same peer.
 
+    The one-connection-per-peer-pair invariant is not just an implementation
+    convenience. The handshake in `run_t::handle()` relies on it to resolve duelling
+    connection attempts, peers signal "I'm still alive" by the mere existence of the
+    connection, and everything layered on top -- directory, semilattices, mailboxes
+    with their fifo tokens -- assumes that messages to a peer form a single ordered
+    stream. Adding extra sockets per peer ("lanes") would push an ordering and
+    failover story onto all of those layers at once.
+
     `connection_t` is completely thread-safe. You can pass connections from thread to
     thread and call the methods on any thread. */
     class connection_t : public home_thread_mixin_debug_only_t {
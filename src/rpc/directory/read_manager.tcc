@@ -14,6 +14,12 @@
 #include "containers/archive/versioned.hpp"
 #include "stl_utils.hpp"
 
+/* This manager ships each peer's directory value as one blob, and any change to it
+re-sends the whole value. That's the right shape for state whose consumers want the
+entire value anyway, but it's the wrong tool for large per-table maps: for those, use
+`directory_map_write_manager_t`/`directory_map_read_manager_t`, which track dirty keys
+per connection, send only changed entries over the wire, and (via `watchable_map_t`'s
+per-key subscriptions) wake only the subscribers of the keys that changed. */
 template<class metadata_t>
 directory_read_manager_t<metadata_t>::directory_read_manager_t(
         connectivity_cluster_t *cm, connectivity_cluster_t::message_tag_t _tag)
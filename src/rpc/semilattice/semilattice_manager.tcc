@@ -71,7 +71,15 @@ void semilattice_manager_t<metadata_t>::root_view_t::join(const metadata_t &adde
     /* Distribute changes to all peers we can currently see. If we can't
     currently see a peer, that's OK; it will hear about the metadata change when
     it reconnects, via the `semilattice_manager_t`'s `on_connections_change()`
-    handler. */
+    handler.
+
+    Note that what goes over the wire is `added_metadata` -- the piece being
+    joined in -- not the full joined state. Join is idempotent, commutative, and
+    associative, so forwarding just the addition is correct, and the full-state
+    exchange on reconnect acts as anti-entropy. This means the wire cost of a
+    change is whatever the *caller* chose to join: callers that copy the whole
+    cluster metadata, tweak one field, and join the copy back pay for the whole
+    blob. The fix for that belongs at those call sites, not here. */
     auto_drainer_t::lock_t parent_keepalive(parent->drainers.get());
 
     for (const std::pair<peer_id_t, connectivity_cluster_t::connection_pair_t> &pair :
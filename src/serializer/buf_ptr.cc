@@ -2,13 +2,84 @@
 
 #include <algorithm>
 
+#include "arch/spinlock.hpp"
+#include "config/args.hpp"
 #include "math.hpp"
 
+/* A small global pool of buffers of the default aligned block size.  Every
+block read allocates (and every page eviction frees) one
+DEVICE_BLOCK_SIZE-aligned buffer -- mandatory for direct i/o -- and those
+buffers routinely change threads between allocation and death, so the pool is
+shared and guarded by a spinlock, which is much cheaper than the
+posix_memalign/free round trip it replaces.  Free buffers form an intrusive
+linked list through their own storage. */
+namespace {
+
+const size_t POOLED_ALIGNED_BUF_SIZE = DEFAULT_BTREE_BLOCK_SIZE;
+const size_t MAX_POOLED_ALIGNED_BUFS = 512;
+
+struct aligned_buf_pool_t {
+    spinlock_t lock;
+    void *free_list = nullptr;
+    size_t count = 0;
+
+    ~aligned_buf_pool_t() {
+        while (free_list != nullptr) {
+            void *buf = free_list;
+            free_list = *static_cast<void **>(buf);
+            raw_free_aligned(buf);
+        }
+    }
+};
+
+aligned_buf_pool_t aligned_buf_pool;
+
+void *try_take_pooled_aligned_buf() {
+    spinlock_acq_t acq(&aligned_buf_pool.lock);
+    void *buf = aligned_buf_pool.free_list;
+    if (buf != nullptr) {
+        aligned_buf_pool.free_list = *static_cast<void **>(buf);
+        --aligned_buf_pool.count;
+    }
+    return buf;
+}
+
+void return_pooled_aligned_buf(void *buf) {
+    {
+        spinlock_acq_t acq(&aligned_buf_pool.lock);
+        if (aligned_buf_pool.count < MAX_POOLED_ALIGNED_BUFS) {
+            *static_cast<void **>(buf) = aligned_buf_pool.free_list;
+            aligned_buf_pool.free_list = buf;
+            ++aligned_buf_pool.count;
+            return;
+        }
+    }
+    raw_free_aligned(buf);
+}
+
+}  // namespace
+
+buf_ptr_t::~buf_ptr_t() {
+    if (ser_buffer_.has()
+        && compute_aligned_block_size(block_size_) == POOLED_ALIGNED_BUF_SIZE) {
+        return_pooled_aligned_buf(ser_buffer_.release());
+    }
+}
+
 buf_ptr_t buf_ptr_t::alloc_uninitialized(block_size_t size) {
     guarantee(size.ser_value() != 0);
     const size_t count = compute_aligned_block_size(size);
     buf_ptr_t ret;
     ret.block_size_ = size;
+    if (count == POOLED_ALIGNED_BUF_SIZE) {
+        void *pooled = try_take_pooled_aligned_buf();
+        if (pooled != nullptr) {
+            ret.ser_buffer_ = scoped_device_block_aligned_ptr_t<ser_buffer_t>(
+                scoped_device_block_aligned_ptr_t<ser_buffer_t>::adopt_t(),
+                static_cast<ser_buffer_t *>(pooled));
+            return ret;
+        }
+    }
     ret.ser_buffer_ = scoped_device_block_aligned_ptr_t<ser_buffer_t>(count);
     return ret;
 }
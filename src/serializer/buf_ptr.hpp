@@ -31,6 +31,10 @@ public:
         guarantee(ser_buffer_.has());
     }
 
+    // Returns buffers of the default aligned block size to a pool instead of
+    // freeing them (see buf_ptr.cc).
+    ~buf_ptr_t();
+
     buf_ptr_t &operator=(buf_ptr_t &&movee) {
         buf_ptr_t tmp(std::move(movee));
         std::swap(block_size_, tmp.block_size_);
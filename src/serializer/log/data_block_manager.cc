@@ -8,6 +8,7 @@
 
 #include "arch/arch.hpp"
 #include "arch/runtime/coroutines.hpp"
+#include "arch/timing.hpp"
 #include "concurrency/mutex.hpp"
 #include "concurrency/new_mutex.hpp"
 #include "errors.hpp"
@@ -19,6 +20,12 @@
 // Max amount of bytes which can be read ahead in one i/o transaction (if enabled)
 const int64_t APPROXIMATE_READ_AHEAD_SIZE = 32 * DEFAULT_BTREE_BLOCK_SIZE;
 
+// How many consecutive forward, LBA-adjacent cold reads we take as evidence of a
+// sequential scan (e.g. a cold table scan walking the leaf level). Once a scan is
+// detected, read-ahead grows from APPROXIMATE_READ_AHEAD_SIZE to a whole extent,
+// so the scan moves extent-sized i/o transactions instead of small windows.
+const int SEQUENTIAL_READ_AHEAD_MIN_RUN = 3;
+
 /*****************
  * GC Parameters *
  *****************/
@@ -38,6 +45,20 @@ const int GC_IO_PRIORITY_NICE = 8;
 // 4 times the priority of all caches combined
 const int GC_IO_PRIORITY_HIGH = 4 * MERGER_BLOCK_WRITE_IO_PRIORITY;
 
+// The IO budget of the nice GC account: how many GC reads/writes may be
+// outstanding at once while the garbage ratio is uncritical. Keeping this
+// bounded stops a GC extent rewrite from flooding the disk queue underneath
+// latency-sensitive foreground writes. The high-priority account stays
+// unlimited, since by the time we switch to it we care about reclaiming space
+// more than about latency.
+const int GC_IO_NICE_OUTSTANDING_REQUESTS = 16;
+
+// How long one backpressure pause lasts, and how many of them a GC coroutine
+// accepts consecutively before it proceeds anyway (so that a sustained write
+// burst can delay GC, but never starve it outright).
+const int64_t GC_FOREGROUND_PAUSE_MS = 5;
+const int GC_MAX_CONSECUTIVE_FOREGROUND_PAUSES = 20;
+
 // The ratio at which we start GCing.
 constexpr double GC_START_RATIO = 0.1;
 // The ratio at which we don't want to keep GC'ing.
@@ -402,6 +423,7 @@ data_block_manager_t::data_block_manager_t(
     : stats(_stats), shutdown_callback(nullptr), state(state_unstarted),
       gc_enabled(true), static_config(_static_config), extent_manager(em),
       serializer(_serializer),
+      last_read_offset(-1), sequential_read_run(0),
       gc_index_write_pumper(std::bind(
           &data_block_manager_t::flush_gc_index_writes, this, std::placeholders::_1)),
       /* The capacity of the gc_index_write_semaphore will be scaled
@@ -453,7 +475,8 @@ void data_block_manager_t::start_existing(
         const dbm_metablock_mixin_t *last_metablock) {
     guarantee(state == state_unstarted);
     dbfile = file;
-    gc_io_account_nice.init(new file_account_t(file, GC_IO_PRIORITY_NICE));
+    gc_io_account_nice.init(new file_account_t(file, GC_IO_PRIORITY_NICE,
+                                               GC_IO_NICE_OUTSTANDING_REQUESTS));
     gc_io_account_high.init(new file_account_t(file, GC_IO_PRIORITY_HIGH));
 
     /* Reconstruct the active data block extents from the metablock. */
@@ -571,12 +594,13 @@ void read_ahead_interval(const int64_t block_offset,
 void read_ahead_offset_and_size(int64_t off_in,
                                 uint16_t ser_block_size_in,
                                 int64_t extent_size,
+                                int64_t read_ahead_size,
                                 const std::vector<uint32_t> &boundaries,
                                 int64_t *offset_out, int64_t *size_out) {
     int64_t offset;
     int64_t end_offset;
     read_ahead_interval(off_in, ser_block_size_in, extent_size,
-                        APPROXIMATE_READ_AHEAD_SIZE,
+                        read_ahead_size,
                         DEVICE_BLOCK_SIZE,
                         boundaries,
                         &offset,
@@ -602,6 +626,7 @@ public:
                                    const uint16_t ser_block_size_in,
                                    void *const buf_out,
                                    file_account_t *const io_account,
+                                   const int64_t approximate_read_ahead_size,
                                    log_serializer_stats_t *const stats) {
         const std::vector<uint32_t> boundaries = get_boundaries(parent, off_in);
 
@@ -612,6 +637,7 @@ public:
         read_ahead_offset_and_size(off_in,
                                    ser_block_size_in,
                                    parent->static_config->extent_size(),
+                                   approximate_read_ahead_size,
                                    boundaries,
                                    &read_ahead_offset,
                                    &read_ahead_size);
@@ -696,13 +722,32 @@ bool data_block_manager_t::should_perform_read_ahead(int64_t offset) {
     return !entry->was_written && serializer->should_perform_read_ahead();
 }
 
+int64_t data_block_manager_t::observe_read_for_read_ahead(int64_t offset) {
+    // A scan through LBA-adjacent blocks produces forward reads that stay within
+    // read-ahead distance of each other. (Blocks the scan finds in the cache never
+    // get here, so the run also survives a partially warm cache.)
+    if (offset >= last_read_offset
+        && offset - last_read_offset <= APPROXIMATE_READ_AHEAD_SIZE) {
+        ++sequential_read_run;
+    } else {
+        sequential_read_run = 0;
+    }
+    last_read_offset = offset;
+
+    return sequential_read_run >= SEQUENTIAL_READ_AHEAD_MIN_RUN
+        ? static_cast<int64_t>(static_config->extent_size())
+        : APPROXIMATE_READ_AHEAD_SIZE;
+}
+
 buf_ptr_t data_block_manager_t::read(int64_t off_in, block_size_t block_size,
                                    file_account_t *io_account) {
     guarantee(state == state_ready);
+    const int64_t read_ahead_size = observe_read_for_read_ahead(off_in);
     if (should_perform_read_ahead(off_in)) {
         buf_ptr_t ret = buf_ptr_t::alloc_uninitialized(block_size);
         dbm_read_ahead_t::perform_read_ahead(this, off_in, block_size.ser_value(),
-                                             ret.ser_buffer(), io_account, stats);
+                                             ret.ser_buffer(), io_account,
+                                             read_ahead_size, stats);
         // We have to fill the padding with zero, since only the first part of the
         // buf got memcpy'd into.
         ret.fill_padding_zero();
@@ -1029,10 +1074,30 @@ struct block_write_cond_t : public cond_t, public iocallback_t {
     }
 };
 
+void data_block_manager_t::yield_to_foreground_writes() {
+    // Backpressure between extents: while foreground index writes are in
+    // flight and the garbage ratio is still uncritical, hold the GC back in
+    // small pauses so the extent rewrites don't land in the middle of a client
+    // write burst. The pause count is bounded, and once the garbage ratio
+    // passes GC_HIGH_RATIO we stop yielding altogether -- reclaiming space
+    // then matters more than write latency.
+    int pauses = 0;
+    while (gc_enabled
+           && state == state_ready
+           && serializer->active_write_count > 0
+           && garbage_ratio() <= GC_HIGH_RATIO
+           && pauses < GC_MAX_CONSECUTIVE_FOREGROUND_PAUSES) {
+        ++pauses;
+        nap(GC_FOREGROUND_PAUSE_MS);
+    }
+}
+
 void data_block_manager_t::run_gc(gc_state_t *gc_state) {
     while (!gc_pq.empty()
            && should_we_keep_gcing()
            && !should_terminate_one_gc_thread()) {
+        yield_to_foreground_writes();
+
         gc_one_extent(gc_state);
 
         if (state == state_shutting_down) {
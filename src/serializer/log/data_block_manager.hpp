@@ -33,6 +33,17 @@ namespace data_block_manager {
 struct shutdown_callback_t;  // see log_serializer.hpp.
 }  // namespace data_block_manager
 
+/* The data block manager owns the data extents of a single serializer file
+and garbage-collects them. A recurring suggestion is to use the per-extent
+age/garbage tracking in `gc_entry_t` to migrate cold extents to a second,
+cheaper device. That doesn't fit this design: a block's address *is* its
+`int64_t` offset in the one serializer file -- that offset is what the LBA
+records on disk and what block tokens hold in memory -- so a second device
+would need a device id threaded through the LBA entry format, the metablock,
+and every token, i.e. a disk-format change plus a recovery story for two
+files that must stay mutually consistent. The supported way to put tables on
+different classes of storage is one serializer file per table, placed on
+whatever filesystem suits it. */
 class data_block_manager_t {
     friend class gc_entry_t;
     friend class dbm_read_ahead_t;
@@ -127,6 +138,10 @@ private:
     we should keep GCing. */
     void run_gc(gc_state_t *gc_state);
 
+    /* Pauses the calling GC coroutine (boundedly) while foreground writes are
+    in flight and the garbage ratio is uncritical. */
+    void yield_to_foreground_writes();
+
     void gc_one_extent(gc_state_t *gc_state);
 
     void write_gcs(
@@ -166,6 +181,11 @@ private:
 
     bool should_perform_read_ahead(int64_t offset);
 
+    // Tracks forward, LBA-adjacent read runs so that read-ahead grows to whole
+    // extents once a sequential scan is detected.  Returns the number of bytes
+    // that read-ahead around `offset` should cover.
+    int64_t observe_read_for_read_ahead(int64_t offset);
+
     log_serializer_stats_t *const stats;
 
     // This is permitted to destroy the data_block_manager.
@@ -188,6 +208,12 @@ private:
     log_serializer_t *const serializer;
 
     file_t *dbfile;
+
+    /* Sequential scan detection for read-ahead (see
+    `observe_read_for_read_ahead()`). */
+    int64_t last_read_offset;
+    int sequential_read_run;
+
     scoped_ptr_t<file_account_t> gc_io_account_nice;
     scoped_ptr_t<file_account_t> gc_io_account_high;
 
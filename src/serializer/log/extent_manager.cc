@@ -161,12 +161,31 @@ public:
     }
 
     void try_shrink_file() {
-        // Now potentially shrink the file.
-        bool shrink_file = false;
-        while (!extents.empty() && extents.back().state() == extent_info_t::state_free) {
-            shrink_file = true;
-            --held_extents_;
-            extents.pop_back();
+        /* Count the trailing run of free extents; those are the only ones we
+        can return to the filesystem, since this reclaims space by truncating
+        the file. (`gen_extent()` hands out the lowest-offset free extent
+        first, so live data migrates towards the head of the file and interior
+        free extents eventually become truncatable.) */
+        size_t trailing_free = 0;
+        while (trailing_free < extents.size()
+               && extents[extents.size() - 1 - trailing_free].state()
+                   == extent_info_t::state_free) {
+            ++trailing_free;
+        }
+
+        /* Keep a reserve of trailing free extents so a write burst right
+        after a deletion doesn't immediately regrow the file, and only shrink
+        once the run exceeds twice the reserve so we don't ftruncate on every
+        released extent when the run hovers around the threshold. The reserve
+        is sized like the growth chunking in `chunk_factor()`: 12.5% of the
+        file, capped at 64 extents. */
+        const size_t reserve = clamp<size_t>(extents.size() / 8, 1, 64);
+        const bool shrink_file = trailing_free > reserve * 2;
+        if (shrink_file) {
+            for (size_t i = 0; i < trailing_free - reserve; ++i) {
+                --held_extents_;
+                extents.pop_back();
+            }
         }
 
         if (shrink_file) {
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 
+#include "arch/runtime/coroutines.hpp"
 #include "containers/scoped.hpp"
 #include "math.hpp"
 
@@ -235,24 +236,11 @@ struct reader_t
         lba_disk_extent_t::read_info_t read_info;   // Opaque data used by extent_t::read()
         bool have_read;   // true if our extent has been loaded from disk
 
-        /* true if the extent before us called read_step_2(). We keep track of this
-        because we must be sure to call read_step_2() in the right order at all times;
-        otherwise more recent LBA data would be applied after less recent LBA data
-        and the LBA would be corrupted. */
-        bool prev_done;
-
         extent_reader_t(reader_t *p, lba_disk_extent_t *e)
             : parent(p), extent(e), have_read(false)
         {
             index = parent->readers.size();
             parent->readers.push_back(this);
-
-            if (index == 0) {
-                // We are the first; we don't have to wait for a previous extent
-                prev_done = true;
-            } else {
-                prev_done = false;
-            }
         }
         void start_reading() {
             parent->active_readers++;
@@ -261,23 +249,7 @@ struct reader_t
         void on_extent_read() {   // Called when our extent has been read from disk
             rassert(!have_read);
             have_read = true;
-            if (prev_done) done();
-        }
-        void on_prev_done() {   // Called by the previous extent_reader_t when it finishes
-            rassert(!prev_done);
-            prev_done = true;
-            if (have_read) done();
-        }
-        void done() {
-            extent->read_step_2(&read_info, parent->index);
-            parent->active_readers--;
-            parent->start_more_readers();
-            if (index == static_cast<int>(parent->readers.size()) - 1) {
-                parent->done();
-            } else {
-                parent->readers[index+1]->on_prev_done();
-            }
-            delete this;
+            parent->pump_apply();
         }
     };
     std::vector< extent_reader_t* > readers;
@@ -285,10 +257,19 @@ struct reader_t
     // The index of the next reader that we should call start_reading() on
     int next_reader;
 
-    // The number of readers that have done start_reading() but not done(). Used to
-    // throttle the reading process so that we stay under LBA_READ_BUFFER_SIZE.
+    // The number of readers that have done start_reading() but whose extents have
+    // not been merged into the index yet. Used to throttle the reading process so
+    // that we stay under LBA_READ_BUFFER_SIZE.
     int active_readers;
 
+    // The index of the next extent to be merged into the in-memory index. Extents
+    // must be merged strictly in order; otherwise more recent LBA data would be
+    // applied after less recent LBA data and the LBA would be corrupted.
+    int next_apply;
+
+    // True while an apply-worker coroutine is running for this shard.
+    bool apply_worker_active;
+
     reader_t(lba_disk_structure_t *_ds, in_memory_index_t *_index, lba_disk_structure_t::read_callback_t *cb)
         : ds(_ds), index(_index), rcb(cb)
     {
@@ -307,6 +288,8 @@ struct reader_t
         } else {
             next_reader = 0;
             active_readers = 0;
+            next_apply = 0;
+            apply_worker_active = false;
             start_more_readers();
         }
     }
@@ -319,6 +302,44 @@ struct reader_t
         }
     }
 
+    /* Spawns an apply-worker coroutine if the next extent in order has been read
+    and no worker is running yet. Merging used to happen synchronously inside the
+    IO completion callback, which blocked the event loop for the whole extent and
+    stalled the reads of all later extents (across all shards) behind the CPU
+    work. With one worker coroutine per shard, the four shards' merge work
+    interleaves with each other and with outstanding disk reads. */
+    void pump_apply() {
+        if (!apply_worker_active
+            && next_apply < static_cast<int>(readers.size())
+            && readers[next_apply]->have_read) {
+            apply_worker_active = true;
+            coro_t::spawn_sometime(std::bind(&reader_t::apply_worker, this));
+        }
+    }
+
+    void apply_worker() {
+        while (next_apply < static_cast<int>(readers.size())
+               && readers[next_apply]->have_read) {
+            extent_reader_t *r = readers[next_apply];
+            r->extent->read_step_2(&r->read_info, index);
+            ++next_apply;
+            active_readers--;
+            start_more_readers();
+            delete r;
+            if (next_apply == static_cast<int>(readers.size())) {
+                done();
+                return;
+            }
+            /* Yield between extents so that read completions (and the other
+            shards' workers) get a chance to run while we merge. */
+            coro_t::yield();
+        }
+        apply_worker_active = false;
+        /* A read may have completed for the next extent while we were
+        yielding; if so, start over. */
+        pump_apply();
+    }
+
     void done() {
         rcb->on_lba_extents_read();
         delete this;
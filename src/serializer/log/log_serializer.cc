@@ -6,11 +6,14 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <functional>
 
 #include "arch/io/disk.hpp"
 #include "arch/runtime/runtime.hpp"
 #include "arch/runtime/coroutines.hpp"
+#include "arch/runtime/thread_pool.hpp"
+#include "arch/timing.hpp"
 #include "buffer_cache/types.hpp"
 #include "concurrency/new_mutex.hpp"
 #include "logger.hpp"
@@ -18,6 +21,17 @@
 #include "serializer/buf_ptr.hpp"
 #include "serializer/log/data_block_manager.hpp"
 
+// Cache warmup constants: how often we persist the hot block id set, how many
+// ids we keep at most (the sidecar file is 8 bytes per id), and the io
+// priority of the warmup reads (lower than normal cache reads -- warmup must
+// not crowd out real traffic).
+const int64_t WARMUP_WRITE_INTERVAL_MS = 5 * 60 * 1000;
+const size_t WARMUP_MAX_BLOCK_IDS = 1 << 16;
+const int WARMUP_READS_IO_PRIORITY = 8;
+
+static const char warmup_file_magic[8]
+    = {'R', 'e', 'D', 'B', 'w', 'a', 'r', 'm'};
+
 filepath_file_opener_t::filepath_file_opener_t(const serializer_filepath_t &filepath,
                                                io_backender_t *backender)
     : filepath_(filepath),
@@ -416,6 +430,8 @@ log_serializer_t::log_serializer_t(dynamic_config_t _dynamic_config,
 #ifndef NDEBUG
       expecting_no_more_tokens(false),
 #endif
+      warmup_file_name(file_opener->file_name() + ".warmup"),
+      warmup_performed(false),
       dynamic_config(_dynamic_config),
       shutdown_callback(nullptr),
       shutdown_state(shutdown_not_started),
@@ -432,11 +448,29 @@ log_serializer_t::log_serializer_t(dynamic_config_t _dynamic_config,
     ls_start_existing_fsm_t *s = new ls_start_existing_fsm_t(this);
     cond_t cond;
     if (!s->run(&cond, file_opener)) cond.wait();
+
+    if (dynamic_config.read_ahead) {
+        warmup_write_timer.init(new repeating_timer_t(
+            WARMUP_WRITE_INTERVAL_MS,
+            [this]() {
+                coro_t::spawn_sometime(
+                    std::bind(&log_serializer_t::write_warmup_file, this,
+                              warmup_drainer.lock()));
+            }));
+    }
 }
 
 log_serializer_t::~log_serializer_t() {
     assert_thread();
 
+    /* Stop the warmup machinery and record the hot set one last time before we
+    start shutting down. */
+    warmup_write_timer.reset();
+    if (state == state_ready) {
+        write_warmup_file(warmup_drainer.lock());
+    }
+    warmup_drainer.drain();
+
     cond_t cond;
     shutdown(&cond);
     cond.wait();
@@ -465,6 +499,22 @@ buf_ptr_t log_serializer_t::block_read(const counted_t<block_token_t> &token,
     buf_ptr_t ret = data_block_manager->read(token->offset_, token->block_size(),
                                              io_account);
 
+    /* If the write that produced this token computed a content checksum (see
+    `data_block_manager_t::many_writes`), use it to verify what we just read.
+    This catches on-disk corruption of the block without an external scrubbing
+    pass.  Tokens holding `no_checksum()` or `datasync_checksum()` carry no
+    content checksum, so those reads are not verifiable. */
+    if (has_checksum(token->checksum_) && !is_datasync_checksum(token->checksum_)) {
+        const size_t wordcount
+            = ret.aligned_block_size() / serializer_checksum::word_size;
+        const serializer_checksum computed
+            = compute_checksum(ret.ser_buffer(), wordcount);
+        guarantee(computed.value == token->checksum_.value,
+                  "Checksum mismatch reading the block at offset %" PRIi64 " -- "
+                  "the database file is corrupted.",
+                  token->offset_);
+    }
+
     stats->pm_serializer_block_reads.end(&pm_time);
     return ret;
 }
@@ -820,6 +870,7 @@ counted_t<block_token_t> log_serializer_t::index_read(block_id_t block_id) {
 
     index_block_info_t info = lba_index->get_block_info(block_id);
     if (info.offset.has_value()) {
+        record_warmup_block_id(block_id);
         return generate_block_token(info.offset.get_value(),
                                     block_size_t::unsafe_make(info.ser_block_size));
     } else {
@@ -985,6 +1036,13 @@ void log_serializer_t::register_read_ahead_cb(serializer_read_ahead_callback_t *
     assert_thread();
 
     read_ahead_callbacks.push_back(cb);
+
+    if (!warmup_performed && dynamic_config.read_ahead) {
+        warmup_performed = true;
+        coro_t::spawn_sometime(
+            std::bind(&log_serializer_t::perform_warmup, this,
+                      warmup_drainer.lock()));
+    }
 }
 
 void log_serializer_t::unregister_read_ahead_cb(serializer_read_ahead_callback_t *cb) {
@@ -1014,6 +1072,105 @@ bool log_serializer_t::should_perform_read_ahead() {
     return dynamic_config.read_ahead && !read_ahead_callbacks.empty();
 }
 
+void log_serializer_t::record_warmup_block_id(block_id_t block_id) {
+    // (Only track the hot set when read-ahead -- and thus warmup -- is on.)
+    if (warmup_write_timer.has()
+        && warmup_block_ids.size() < WARMUP_MAX_BLOCK_IDS) {
+        warmup_block_ids.insert(block_id);
+    }
+}
+
+void log_serializer_t::write_warmup_file(UNUSED auto_drainer_t::lock_t keepalive) {
+    assert_thread();
+    if (state != state_ready || warmup_block_ids.empty()) {
+        return;
+    }
+
+    std::vector<block_id_t> ids(warmup_block_ids.begin(),
+                                warmup_block_ids.end());
+    const std::string path = warmup_file_name;
+    const std::string tmp_path = warmup_file_name + ".tmp";
+    linux_thread_pool_t::run_in_blocker_pool([&]() {
+        FILE *f = fopen(tmp_path.c_str(), "wb");
+        if (f == nullptr) {
+            return;
+        }
+        const uint64_t count = ids.size();
+        bool ok = fwrite(warmup_file_magic, 1, sizeof(warmup_file_magic), f)
+                == sizeof(warmup_file_magic)
+            && fwrite(&count, sizeof(count), 1, f) == 1
+            && fwrite(ids.data(), sizeof(block_id_t), ids.size(), f)
+                == ids.size();
+        ok = (fclose(f) == 0) && ok;
+        if (ok) {
+            ok = (rename(tmp_path.c_str(), path.c_str()) == 0);
+        }
+        if (!ok) {
+            unlink(tmp_path.c_str());
+        }
+    });
+}
+
+void log_serializer_t::perform_warmup(UNUSED auto_drainer_t::lock_t keepalive) {
+    assert_thread();
+    if (state != state_ready) {
+        return;
+    }
+
+    std::vector<block_id_t> ids;
+    {
+        const std::string path = warmup_file_name;
+        bool ok = false;
+        linux_thread_pool_t::run_in_blocker_pool([&]() {
+            FILE *f = fopen(path.c_str(), "rb");
+            if (f == nullptr) {
+                return;
+            }
+            char magic[sizeof(warmup_file_magic)];
+            uint64_t count;
+            if (fread(magic, 1, sizeof(magic), f) == sizeof(magic)
+                && memcmp(magic, warmup_file_magic, sizeof(magic)) == 0
+                && fread(&count, sizeof(count), 1, f) == 1
+                && count <= WARMUP_MAX_BLOCK_IDS) {
+                ids.resize(count);
+                ok = fread(ids.data(), sizeof(block_id_t), count, f) == count;
+            }
+            fclose(f);
+        });
+        if (!ok) {
+            return;
+        }
+    }
+
+    // Look up the blocks that still exist and read them in disk order.
+    std::vector<std::pair<block_id_t, counted_t<block_token_t> > > blocks;
+    blocks.reserve(ids.size());
+    for (block_id_t id : ids) {
+        counted_t<block_token_t> token = index_read(id);
+        if (token.has()) {
+            blocks.push_back(std::make_pair(id, std::move(token)));
+        }
+    }
+    std::sort(blocks.begin(), blocks.end(),
+              [](const std::pair<block_id_t, counted_t<block_token_t> > &a,
+                 const std::pair<block_id_t, counted_t<block_token_t> > &b) {
+                  return a.second->offset() < b.second->offset();
+              });
+
+    scoped_ptr_t<file_account_t> io_account(
+        make_io_account(WARMUP_READS_IO_PRIORITY));
+    for (auto &block : blocks) {
+        if (read_ahead_callbacks.empty() || state != state_ready) {
+            // The cache stopped taking read-ahead blocks (it filled up or is
+            // going away), so there's no point in reading more.
+            break;
+        }
+        buf_ptr_t buf = block_read(block.second, io_account.get());
+        offer_buf_to_read_ahead_callbacks(block.first, std::move(buf),
+                                          block.second);
+    }
+}
+
 block_token_t::block_token_t(log_serializer_t *serializer,
                              int64_t initial_offset,
                              block_size_t initial_block_size)
@@ -4,6 +4,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <list>
 
@@ -12,6 +13,7 @@
 #include "serializer/serializer.hpp"
 #include "serializer/log/config.hpp"
 #include "utils.hpp"
+#include "concurrency/auto_drainer.hpp"
 #include "concurrency/mutex_assertion.hpp"
 #include "concurrency/new_mutex.hpp"
 #include "concurrency/signal.hpp"
@@ -30,6 +32,7 @@ class data_block_manager_t;
 struct block_magic_t;
 class io_backender_t;
 class log_serializer_t;
+class repeating_timer_t;
 
 namespace data_block_manager {
 struct shutdown_callback_t {
@@ -221,8 +224,22 @@ private:
     bool expecting_no_more_tokens;
 #endif
 
+    /* Cache warmup.  We remember which blocks the cache asked for, persist
+    the ids to a sidecar file next to the database file, and on the next
+    startup read them back in disk order and offer the bufs through the
+    read-ahead callbacks, so the cache starts out hot. */
+    void record_warmup_block_id(block_id_t block_id);
+    void write_warmup_file(auto_drainer_t::lock_t keepalive);
+    void perform_warmup(auto_drainer_t::lock_t keepalive);
+
     std::vector<serializer_read_ahead_callback_t *> read_ahead_callbacks;
 
+    const std::string warmup_file_name;
+    std::unordered_set<block_id_t> warmup_block_ids;
+    scoped_ptr_t<repeating_timer_t> warmup_write_timer;
+    bool warmup_performed;
+    auto_drainer_t warmup_drainer;
+
     const dynamic_config_t dynamic_config;
     static_config_t static_config;
 
@@ -431,27 +431,71 @@ void metablock_manager_t::co_write_metablock(
         const scoped_device_block_aligned_ptr_t<crc_metablock_t> &crc_mb,
         file_account_t *io_account,
         optional<std::vector<checksum_filerange>> &&checksums) {
+    pending_metablock_write_t pending(crc_mb.get(), std::move(checksums));
+    pending_writes.push_back(&pending);
+
+    /* Callers that queue up here while a metablock write is in flight get group
+    committed: whoever acquires the lock next flushes the entire group with a
+    single disk write. */
     mutex_t::acq_t hold(&write_lock);
 
+    if (!pending.written.is_pulsed()) {
+        write_pending_group(io_account);
+    }
+    rassert(pending.written.is_pulsed());
+}
+
+void metablock_manager_t::write_pending_group(file_account_t *io_account) {
     rassert(state == state_ready);
+    rassert(!pending_writes.empty());
+
+    /* Snapshot the current group.  Callers that arrive while our disk write is
+    in flight form the next group. */
+    intrusive_list_t<pending_metablock_write_t> group;
+    group.append_and_clear(&pending_writes);
+
+    /* We only write the newest member's metablock -- it supersedes the earlier
+    ones -- but it has to carry every member's filerange checksums so that all
+    of their data blocks can be verified on recovery. */
+    bool have_all_checksums = true;
+    std::vector<checksum_filerange> merged_checksums;
+    for (pending_metablock_write_t *p = group.head();
+         p != nullptr && have_all_checksums;
+         p = group.next(p)) {
+        if (p->checksums.has_value()) {
+            merged_checksums.insert(merged_checksums.end(),
+                                    p->checksums->begin(), p->checksums->end());
+        } else {
+            have_all_checksums = false;
+        }
+    }
+
+    crc_metablock_t *newest_crc_mb = group.tail()->crc_mb;
 
     bool double_datasync
-        = crc_metablock::prepare(crc_mb.get(),
+        = crc_metablock::prepare(newest_crc_mb,
                                  static_cast<uint32_t>(cluster_version_t::LATEST_DISK),
                                  next_version_number++,
-                                 std::move(checksums));
-    rassert(crc_metablock::check_crc(crc_mb.get()));
+                                 have_all_checksums
+                                 ? make_optional(std::move(merged_checksums))
+                                 : r_nullopt);
+    rassert(crc_metablock::check_crc(newest_crc_mb));
 
     state = state_writing;
     int64_t offset = metablock_offsets::get(extent_manager->extent_size, next_mb_slot);
     next_mb_slot = metablock_offsets::next(extent_manager->extent_size, next_mb_slot);
-    co_write(dbfile, offset, METABLOCK_SIZE, crc_mb.get(), io_account,
+    co_write(dbfile, offset, METABLOCK_SIZE, newest_crc_mb, io_account,
              double_datasync
              ? datasync_op::wrap_in_datasyncs
              : datasync_op::datasync_after);
 
     state = state_ready;
     extent_manager->stats->bytes_written(METABLOCK_SIZE);
+
+    while (pending_metablock_write_t *p = group.head()) {
+        group.remove(p);
+        p->written.pulse();
+    }
 }
 
 void metablock_manager_t::write_metablock_callback(
@@ -9,7 +9,9 @@
 
 #include "arch/compiler.hpp"
 #include "arch/types.hpp"
+#include "concurrency/cond_var.hpp"
 #include "concurrency/mutex.hpp"
+#include "containers/intrusive_list.hpp"
 #include "serializer/log/extent_manager.hpp"
 #include "serializer/log/static_header.hpp"
 #include "serializer/log/metablock.hpp"
@@ -22,8 +24,6 @@
 
 
 
-/* TODO support multiple concurrent writes */
-
 std::vector<int64_t> initial_metablock_offsets(int64_t extent_size);
 
 class metablock_manager_t {
@@ -77,8 +77,29 @@ private:
 
     bool verify_checksum_fileranges(const crc_metablock_t *mb);
 
-    // Only one metablock write can happen at a time.  This isn't necessarily a
-    // desirable thing, but that's how this type works.
+    // One caller of `co_write_metablock()`, waiting to be covered by a metablock
+    // flush.
+    struct pending_metablock_write_t :
+            public intrusive_list_node_t<pending_metablock_write_t> {
+        pending_metablock_write_t(
+                crc_metablock_t *_crc_mb,
+                optional<std::vector<checksum_filerange>> &&_checksums)
+            : crc_mb(_crc_mb), checksums(std::move(_checksums)) { }
+        crc_metablock_t *crc_mb;
+        optional<std::vector<checksum_filerange>> checksums;
+        cond_t written;
+    };
+
+    // Flushes every entry currently in `pending_writes` with a single disk write
+    // and pulses their `written` conds.  Must be called with `write_lock` held.
+    void write_pending_group(file_account_t *io_account);
+
+    // Only one metablock write can be on disk at a time.  Callers that come in
+    // while a write is in flight accumulate here; they then share the next write
+    // (group commit), because each metablock is a complete snapshot of the
+    // serializer state and the newest pending one supersedes all earlier ones.
+    intrusive_list_t<pending_metablock_write_t> pending_writes;
+
     mutex_t write_lock;
 
     // Which metablock slot we should write next.
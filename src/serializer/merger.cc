@@ -14,7 +14,9 @@
 merger_serializer_t::merger_serializer_t(scoped_ptr_t<serializer_t> _inner,
                                          int _max_active_writes) :
     inner(std::move(_inner)),
-    block_writes_io_account(make_io_account(MERGER_BLOCK_WRITE_IO_PRIORITY)),
+    block_writes_io_account(
+        make_io_account(MERGER_BLOCK_WRITE_IO_PRIORITY,
+                        MERGER_BLOCK_WRITE_OUTSTANDING_REQUESTS_LIMIT)),
     write_committer(std::bind(&merger_serializer_t::do_index_write, this),
                     _max_active_writes) { }
 
@@ -71,6 +73,15 @@ void merger_serializer_t::do_index_write() {
     new_mutex_in_line_t outstanding_mutex_acq(&outstanding_index_write_mutex);
     outstanding_mutex_acq.acq_signal()->wait_lazily_unordered();
 
+    // With MERGER_SERIALIZER_MAX_ACTIVE_WRITES > 1, multiple instances of this
+    // callback can run concurrently, and an earlier instance may have already
+    // committed the ops that we were notified about. In that case there is
+    // nothing left for us to do (issuing an empty index write would just
+    // produce a pointless metablock write).
+    if (outstanding_index_write_ops.empty()) {
+        return;
+    }
+
     // Assemble the currently outstanding index writes into
     // a vector of index_write_op_t-s.
     std::vector<index_write_op_t> write_ops;
@@ -21,6 +21,11 @@
  * The advantage of this is that multiple index writes (e.g. coming from different
  * hash shards) can be merged together, improving efficiency and significantly
  * reducing the number of disk seeks on rotational drives.
+ * With `max_active_writes` > 1, independent batches are also pipelined into the
+ * inner serializer: `inner_index_write_mutex` is released by the log serializer
+ * as soon as a batch is in line for the metablock manager, so the LBA writes of
+ * the next batch overlap with the metablock write of the previous one. Only the
+ * metablock writes themselves stay ordered.
  *
  * As an additional optimization, merger_serializer_t uses a common file account
  * for all block_writes, so reduce the amount of random disk seeks that can
@@ -33,7 +33,19 @@ void debug_print(printf_buffer_t *buf, const index_write_op_t &write_op);
 
 /* serializer_t is an abstract interface that describes how each serializer should
 behave. It is implemented by merger_serializer_t, log_serializer_t, and
-translator_serializer_t. */
+translator_serializer_t.
+
+A RAM-only implementation of this interface (for tables whose contents are
+disposable, like session state) is smaller than it sounds -- the unit tests
+already run a full log_serializer_t against an in-memory mock_file_t -- but
+swapping the serializer is the easy part. The table's existence, shard
+contracts, and sindex definitions live in the cluster metadata file, which
+assumes every table it describes can be reopened after a restart; a server
+coming back with an empty store for a known table looks like data loss to
+the contract coordinator, not like a cache miss. Making that a supported
+mode means a per-table durability flag in table_config, a resync-on-restart
+story, and user-visible semantics for "all replicas restarted at once",
+which is clustering work rather than a serializer. */
 
 /* Except as otherwise noted, the serializer's methods should only be
    called from the thread it was created on, and it should be
@@ -61,6 +73,9 @@ public:
     virtual void unregister_read_ahead_cb(serializer_read_ahead_callback_t *cb) = 0;
 
     // Reading a block from the serializer.  Reads a block, blocks the coroutine.
+    // The returned buf_ptr_t owns the device-block-aligned buffer the data was
+    // read into, so the caller (in particular the page cache, which moves it
+    // straight into a page_t) takes ownership of it without copying.
     virtual buf_ptr_t block_read(const counted_t<block_token_t> &token,
                                  file_account_t *io_account) = 0;
 
@@ -0,0 +1,168 @@
+// Copyright 2010-2015 RethinkDB, all rights reserved.
+
+/* Microbenchmarks for a few storage and query primitives. They build into the
+regular unit test executable and are grouped under the `Benchmark` gtest
+prefix, so they can be run on their own with
+`rethinkdb-unittest --gtest_filter='Benchmark*'` or via `make bench`.
+
+Each benchmark prints one tab-separated, machine-readable line:
+
+    BENCH	<name>	<iters>	<min ns/op>	<median ns/op>
+
+The minimum over the trials is the number to regression-gate on -- it is the
+least contaminated by scheduling noise -- and the median gives a feel for how
+noisy the run was. The gtest assertions only check that the measured code
+actually ran, so a loaded CI machine cannot turn timing noise into failures. */
+
+#include <inttypes.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "arch/runtime/coroutines.hpp"
+#include "containers/archive/vector_stream.hpp"
+#include "rdb_protocol/configured_limits.hpp"
+#include "rdb_protocol/datum.hpp"
+#include "rdb_protocol/datum_json.hpp"
+#include "rdb_protocol/serialize_datum.hpp"
+#include "time.hpp"
+#include "unittest/gtest.hpp"
+#include "unittest/unittest_utils.hpp"
+
+namespace unittest {
+
+namespace {
+
+const int BENCH_TRIALS = 5;
+
+/* Runs `fn(iters)` -- which must perform `iters` operations -- once per trial
+and prints the per-operation time of the best and the median trial. */
+void run_benchmark(const char *name, int64_t iters,
+                   const std::function<void(int64_t)> &fn) {
+    std::vector<double> ns_per_op;
+    for (int trial = 0; trial < BENCH_TRIALS; ++trial) {
+        ticks_t start = get_ticks();
+        fn(iters);
+        ticks_t end = get_ticks();
+        ns_per_op.push_back(
+            static_cast<double>(end.nanos - start.nanos) / iters);
+    }
+    std::sort(ns_per_op.begin(), ns_per_op.end());
+    printf("BENCH\t%s\t%" PRIi64 "\t%.1f\t%.1f\n",
+           name, iters, ns_per_op.front(), ns_per_op[ns_per_op.size() / 2]);
+}
+
+/* A row shaped like typical user data: a primary key, a few scalars, a small
+array and a nested object. */
+ql::datum_t make_test_row() {
+    ql::configured_limits_t limits;
+    std::vector<ql::datum_t> tags;
+    for (int i = 0; i < 5; ++i) {
+        tags.push_back(ql::datum_t(static_cast<double>(i)));
+    }
+    std::map<datum_string_t, ql::datum_t> address;
+    address[datum_string_t("city")] = ql::datum_t("Mountain View");
+    address[datum_string_t("zip")] = ql::datum_t("94043");
+    std::map<datum_string_t, ql::datum_t> row;
+    row[datum_string_t("id")] = ql::datum_t("ade8b28f-5e35-4b94-a3bd-f4c04f281a42");
+    row[datum_string_t("name")] = ql::datum_t("Lorem ipsum dolor sit amet");
+    row[datum_string_t("score")] = ql::datum_t(3.14159);
+    row[datum_string_t("active")] = ql::datum_t::boolean(true);
+    row[datum_string_t("tags")] = ql::datum_t(std::move(tags), limits);
+    row[datum_string_t("address")] = ql::datum_t(std::move(address));
+    return ql::datum_t(std::move(row));
+}
+
+const char *test_row_json =
+    "{\"id\":\"ade8b28f-5e35-4b94-a3bd-f4c04f281a42\","
+    "\"name\":\"Lorem ipsum dolor sit amet\","
+    "\"score\":3.14159,\"active\":true,\"tags\":[0,1,2,3,4],"
+    "\"address\":{\"city\":\"Mountain View\",\"zip\":\"94043\"}}";
+
+}  // namespace
+
+TEST(Benchmark, DatumSerialize) {
+    ql::datum_t row = make_test_row();
+    size_t total = 0;
+    run_benchmark("datum_serialize", 20000, [&](int64_t iters) {
+        for (int64_t i = 0; i < iters; ++i) {
+            write_message_t wm;
+            ql::serialization_result_t res = ql::datum_serialize(
+                &wm, row, ql::check_datum_serialization_errors_t::NO);
+            guarantee(!bad(res));
+            total += wm.size();
+        }
+    });
+    ASSERT_GT(total, 0u);
+}
+
+TEST(Benchmark, DatumDeserialize) {
+    ql::datum_t row = make_test_row();
+    write_message_t wm;
+    ql::serialization_result_t sres = ql::datum_serialize(
+        &wm, row, ql::check_datum_serialization_errors_t::NO);
+    guarantee(!bad(sres));
+    vector_stream_t out;
+    ASSERT_EQ(0, send_write_message(&out, &wm));
+    const std::vector<char> buf = out.vector();
+    size_t total = 0;
+    run_benchmark("datum_deserialize", 20000, [&](int64_t iters) {
+        for (int64_t i = 0; i < iters; ++i) {
+            vector_read_stream_t in((std::vector<char>(buf)));
+            ql::datum_t parsed;
+            archive_result_t res = ql::datum_deserialize(&in, &parsed);
+            guarantee(res == archive_result_t::SUCCESS);
+            total += parsed.obj_size();
+        }
+    });
+    ASSERT_GT(total, 0u);
+}
+
+TEST(Benchmark, JsonToDatum) {
+    ql::configured_limits_t limits;
+    const std::string json(test_row_json);
+    size_t total = 0;
+    run_benchmark("json_to_datum", 20000, [&](int64_t iters) {
+        for (int64_t i = 0; i < iters; ++i) {
+            /* `parse_json_to_datum` parses in situ, so it needs a fresh
+            writable buffer; the copy is part of what the server pays per
+            query too. */
+            std::vector<char> json_buf(json.begin(), json.end());
+            json_buf.push_back('\0');
+            rapidjson::ParseResult res;
+            ql::datum_t parsed =
+                ql::parse_json_to_datum(json_buf.data(), limits, &res);
+            guarantee(parsed.has());
+            total += parsed.obj_size();
+        }
+    });
+    ASSERT_GT(total, 0u);
+}
+
+TPTEST(Benchmark, CoroSpawn) {
+    int64_t count = 0;
+    run_benchmark("coro_spawn_now", 20000, [&](int64_t iters) {
+        for (int64_t i = 0; i < iters; ++i) {
+            coro_t::spawn_now_dangerously([&]() {
+                ++count;
+            });
+        }
+    });
+    ASSERT_GT(count, 0);
+}
+
+TPTEST(Benchmark, CoroYield) {
+    int64_t count = 0;
+    run_benchmark("coro_yield", 100000, [&](int64_t iters) {
+        for (int64_t i = 0; i < iters; ++i) {
+            coro_t::yield();
+            ++count;
+        }
+    });
+    ASSERT_GT(count, 0);
+}
+
+}  // namespace unittest
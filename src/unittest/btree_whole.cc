@@ -173,6 +173,38 @@ public:
         set(key, value, repli_timestamp_t::distant_past);
     }
 
+    void set_sorted_run(
+            const std::vector<std::pair<store_key_t, std::string> > &pairs,
+            repli_timestamp_t timestamp) {
+        run_txn_fn(true, [&](scoped_ptr_t<real_superblock_t> &&superblock){
+            noop_value_deleter_t deleter;
+
+            // `kvs` points into `value_bufs`, so the vector must not
+            // reallocate after the first `data()` call.
+            std::vector<short_value_buffer_t> value_bufs;
+            value_bufs.reserve(pairs.size());
+            std::vector<std::pair<const btree_key_t *, const void *> > kvs;
+            kvs.reserve(pairs.size());
+            for (const auto &pair : pairs) {
+                value_bufs.emplace_back(pair.second);
+                kvs.push_back(std::make_pair(pair.first.btree_key(),
+                                             value_bufs.back().data()));
+            }
+
+            apply_sorted_keyvalue_inserts(
+                sizer.get(), superblock.get(), kvs, timestamp, &deleter);
+        });
+
+        for (const auto &pair : pairs) {
+            kv[pair.first] = pair.second;
+        }
+    }
+
+    void set_sorted_run(
+            const std::vector<std::pair<store_key_t, std::string> > &pairs) {
+        set_sorted_run(pairs, repli_timestamp_t::distant_past);
+    }
+
     void remove(const store_key_t &key, repli_timestamp_t timestamp) {
         EXPECT_TRUE(should_have(key));
 
@@ -482,6 +514,117 @@ TPTEST(BTree, RemoveInOrder) {
     ctx.verify();
 }
 
+TPTEST(BTree, SortedRunBasics) {
+    BTreeTestContext ctx;
+
+    ctx.set_sorted_run({ {store_key_t("b"), "1"},
+                         {store_key_t("d"), "2"},
+                         {store_key_t("f"), "3"} });
+    ctx.get(store_key_t("b"));
+    ctx.get(store_key_t("d"));
+    ctx.get(store_key_t("f"));
+    ctx.verify();
+
+    // Fresh keys interleaved with existing ones, including new extremes.
+    ctx.set(store_key_t("e"), "4");
+    ctx.set_sorted_run({ {store_key_t("a"), "5"},
+                         {store_key_t("c"), "6"},
+                         {store_key_t("g"), "7"} });
+    ctx.verify();
+
+    // A single-key run.
+    ctx.set_sorted_run({ {store_key_t("h"), "8"} });
+    ctx.verify();
+}
+
+TPTEST(BTree, SortedRunMatchesIncremental) {
+    BTreeTestContext bulk;
+    BTreeTestContext incremental;
+    rng_t rng;
+
+    std::map<store_key_t, std::string> pairs;
+    while (pairs.size() < 1000) {
+        pairs[store_key_t(random_letter_string(&rng, 1, 250))] =
+            random_letter_string(&rng, 0, 250);
+    }
+    std::vector<std::pair<store_key_t, std::string> > sorted(
+        pairs.begin(), pairs.end());
+
+    // Feed the same sorted sequence to one tree in randomly sized bulk runs
+    // and to the other through individual `apply_keyvalue_change` calls.
+    // `verify()` checks both trees against the same shadow map, so this
+    // covers runs that cross leaf boundaries and runs that split a full
+    // leaf mid-run.
+    size_t i = 0;
+    while (i < sorted.size()) {
+        size_t run_len = 1 + rng.randint(200);
+        if (run_len > sorted.size() - i) {
+            run_len = sorted.size() - i;
+        }
+        bulk.set_sorted_run(std::vector<std::pair<store_key_t, std::string> >(
+            sorted.begin() + i, sorted.begin() + i + run_len));
+        i += run_len;
+    }
+
+    for (const auto &pair : sorted) {
+        incremental.set(pair.first, pair.second);
+    }
+
+    bulk.verify();
+    incremental.verify();
+}
+
+TPTEST(BTree, SortedRunIntoExistingTree) {
+    BTreeTestContext ctx;
+    rng_t rng;
+
+    for (int i = 0; i < 500; i++) {
+        ctx.set(store_key_t(random_letter_string(&rng, 1, 250)),
+                random_letter_string(&rng, 0, 250));
+    }
+
+    // Bulk runs of fresh keys scattered across the existing keyspace; each
+    // run has to stop at internal-node separators and re-descend.
+    for (int run = 0; run < 10; run++) {
+        std::map<store_key_t, std::string> fresh;
+        while (fresh.size() < 100) {
+            store_key_t key(random_letter_string(&rng, 1, 250));
+            if (!ctx.should_have(key)) {
+                fresh[key] = random_letter_string(&rng, 0, 250);
+            }
+        }
+        ctx.set_sorted_run(std::vector<std::pair<store_key_t, std::string> >(
+            fresh.begin(), fresh.end()));
+
+        if (run % 3 == 0) {
+            ctx.verify();
+        }
+    }
+
+    ctx.verify();
+}
+
+// The bulk-insert path `guarantee`s (in release builds too) that it never
+// overwrites an existing key.
+TEST(BTree, SortedRunRejectsExistingKey) {
+    EXPECT_DEATH(run_in_thread_pool([]() {
+        BTreeTestContext ctx;
+        ctx.set(store_key_t("a"), "1");
+        ctx.set_sorted_run({ {store_key_t("a"), "2"} });
+    }), "already present");
+}
+
+#ifndef NDEBUG
+// The strict-ascending precondition is only checked by `rassert`.
+TEST(BTree, SortedRunRejectsUnsortedKeys) {
+    EXPECT_DEATH(run_in_thread_pool([]() {
+        BTreeTestContext ctx;
+        ctx.set_sorted_run({ {store_key_t("b"), "1"},
+                             {store_key_t("a"), "2"} });
+    }), "strictly ascending");
+}
+#endif
+
 TPTEST(BTree, RemoveRandomOrder) {
     BTreeTestContext ctx;
     rng_t rng;
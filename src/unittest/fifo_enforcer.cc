@@ -99,6 +99,34 @@ TPTEST(FIFOEnforcer, DummyEntry) {
     fifo_enforcer_sink_t::exit_write_t(&sink, source.enter_write());
 }
 
+/* In-order tokens should be pulsed immediately upon construction, and an
+out-of-order token must still wait for the gap to be filled. */
+TPTEST(FIFOEnforcer, InOrderFastPath) {
+    fifo_enforcer_source_t source;
+    fifo_enforcer_sink_t sink;
+
+    fifo_enforcer_write_token_t tok1 = source.enter_write();
+    fifo_enforcer_read_token_t tok2 = source.enter_read();
+    fifo_enforcer_write_token_t tok3 = source.enter_write();
+
+    {
+        fifo_enforcer_sink_t::exit_write_t exit3(&sink, tok3);
+        EXPECT_FALSE(exit3.is_pulsed());
+
+        fifo_enforcer_sink_t::exit_write_t exit1(&sink, tok1);
+        EXPECT_TRUE(exit1.is_pulsed());
+        EXPECT_FALSE(exit3.is_pulsed());
+        exit1.end();
+
+        fifo_enforcer_sink_t::exit_read_t exit2(&sink, tok2);
+        EXPECT_TRUE(exit2.is_pulsed());
+        EXPECT_FALSE(exit3.is_pulsed());
+        exit2.end();
+
+        EXPECT_TRUE(exit3.is_pulsed());
+    }
+}
+
 TPTEST(FIFOEnforcer, QueueEquivalence) {
     fifo_enforcer_source_t source;
     fifo_enforcer_sink_t sink;
@@ -110,6 +110,23 @@ TEST(UTF8ValidationTest, NullBytes) {
     ASSERT_STREQ("Invalid initial byte seen", reason.explanation);
 }
 
+TEST(UTF8ValidationTest, LongAsciiRuns) {
+    utf8::reason_t reason;
+
+    // Long ASCII runs take the word-at-a-time fast path; make sure multibyte
+    // characters and errors after such a run are still handled, at every
+    // offset relative to the eight-byte stride.
+    const std::string ascii(64, 'a');
+    for (size_t i = 0; i < 16; ++i) {
+        std::string prefix = ascii.substr(0, 17 + i);
+        ASSERT_TRUE(utf8::is_valid(prefix));
+        ASSERT_TRUE(utf8::is_valid(prefix + "\xe2\x82\xac" + ascii));
+        ASSERT_FALSE(utf8::is_valid(prefix + "\xff", &reason));
+        ASSERT_EQ(prefix.size(), reason.position);
+        ASSERT_STREQ("Invalid initial byte seen", reason.explanation);
+    }
+}
+
 TEST(UTF8ValidationTest, IllegalCharacters) {
     utf8::reason_t reason;
 